@@ -0,0 +1,52 @@
+// Allocation trace format shared by bench_trace_record.c and
+// bench_trace_replay.c.
+//
+// File layout: one BenchTraceHeader, then BenchTraceRecord entries in
+// per-thread blocks. Blocks from different threads interleave, but the
+// records of one thread stay in call order. Replay merges them by ts_ns.
+//
+// Timestamps are taken so that address reuse orders correctly:
+//   alloc ops   after the real call returned
+//   free        before the real call
+//   realloc     after return; the old pointer was released lead_ns earlier
+
+#ifndef BENCH_TRACE_FORMAT_H
+#define BENCH_TRACE_FORMAT_H
+
+#include <stdint.h>
+
+#define BENCH_TRACE_MAGIC "HZTRACE1"
+#define BENCH_TRACE_MAGIC_BYTES 8u
+#define BENCH_TRACE_VERSION 1u
+#define BENCH_TRACE_MAX_THREADS 65535u
+
+enum {
+    BENCH_TRACE_OP_MALLOC = 1,
+    BENCH_TRACE_OP_CALLOC = 2,
+    BENCH_TRACE_OP_REALLOC = 3,
+    BENCH_TRACE_OP_FREE = 4,
+    // posix_memalign / aligned_alloc / memalign; aux holds the alignment.
+    BENCH_TRACE_OP_ALIGNED = 5
+};
+
+typedef struct BenchTraceHeader {
+    char magic[BENCH_TRACE_MAGIC_BYTES];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t pid;
+} BenchTraceHeader;
+
+typedef struct BenchTraceRecord {
+    uint64_t ts_ns;     // CLOCK_MONOTONIC, relative to recorder start
+    uint64_t ptr;       // returned pointer, or the pointer passed to free
+    uint64_t aux;       // realloc: old pointer; aligned: alignment
+    uint64_t size;      // requested bytes (calloc: nmemb * size)
+    uint16_t thread;    // recorder thread index, 0 = first thread seen
+    uint8_t op;         // BENCH_TRACE_OP_*
+    uint8_t reserved;
+    uint32_t lead_ns;   // realloc: ts_ns minus the time the call started
+} BenchTraceRecord;
+
+typedef char BenchTraceRecordSizeCheck[sizeof(BenchTraceRecord) == 40 ? 1 : -1];
+
+#endif
@@ -0,0 +1,455 @@
+// Allocation trace recorder (Linux LD_PRELOAD).
+//
+// Usage:
+//   BENCH_TRACE_OUT=app.%p.trace LD_PRELOAD=.../libbench_trace_record.so app
+//
+// Interposes malloc / calloc / realloc / free / posix_memalign /
+// aligned_alloc / memalign / valloc, forwards to the next allocator in the
+// link chain, and appends one BenchTraceRecord per call to a per-thread
+// buffer. Buffers are written to the trace file when full, at thread exit,
+// and at process exit. "%p" in BENCH_TRACE_OUT expands to the pid; the
+// default is bench_trace.<pid>.bin in the working directory.
+//
+// Forked children stop recording (they would share the parent's thread
+// indices). Allocations made before the constructor ran are not recorded;
+// the replayer skips their frees.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "bench_trace_format.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_TRACE_EXPORT __attribute__((visibility("default")))
+#define BENCH_TRACE_TLS __thread __attribute__((tls_model("initial-exec")))
+
+#define BENCH_TRACE_BUFFER_RECORDS 4096u
+#define BENCH_TRACE_BOOTSTRAP_BYTES (64u * 1024u)
+#define BENCH_TRACE_PATH_BYTES 4096u
+
+typedef void* (*BenchMallocFn)(size_t);
+typedef void* (*BenchCallocFn)(size_t, size_t);
+typedef void* (*BenchReallocFn)(void*, size_t);
+typedef void (*BenchFreeFn)(void*);
+typedef int (*BenchPosixMemalignFn)(void**, size_t, size_t);
+typedef void* (*BenchAlignedAllocFn)(size_t, size_t);
+typedef void* (*BenchVallocFn)(size_t);
+
+typedef struct BenchTraceBuffer {
+    struct BenchTraceBuffer* next;
+    uint32_t count;
+    uint16_t thread;
+    BenchTraceRecord records[BENCH_TRACE_BUFFER_RECORDS];
+} BenchTraceBuffer;
+
+static BenchMallocFn g_real_malloc;
+static BenchCallocFn g_real_calloc;
+static BenchReallocFn g_real_realloc;
+static BenchFreeFn g_real_free;
+static BenchPosixMemalignFn g_real_posix_memalign;
+static BenchAlignedAllocFn g_real_aligned_alloc;
+static BenchAlignedAllocFn g_real_memalign;
+static BenchVallocFn g_real_valloc;
+
+// dlsym may allocate before the real functions are known.
+static unsigned char g_bootstrap[BENCH_TRACE_BOOTSTRAP_BYTES]
+    __attribute__((aligned(64)));
+static size_t g_bootstrap_used;
+static int g_resolving;
+
+static atomic_int g_enabled;
+static int g_fd = -1;
+static uint64_t g_start_ns;
+static atomic_uint g_next_thread;
+static pthread_mutex_t g_write_lock = PTHREAD_MUTEX_INITIALIZER;
+static BenchTraceBuffer* g_buffers;
+static pthread_key_t g_exit_key;
+
+static BENCH_TRACE_TLS BenchTraceBuffer* t_buffer;
+static BENCH_TRACE_TLS int t_busy;
+static BENCH_TRACE_TLS int t_untraced;
+
+static uint64_t bench_trace_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void* bench_trace_bootstrap_alloc(size_t size) {
+    size_t offset = (g_bootstrap_used + 15u) & ~(size_t)15u;
+    if (offset + size > sizeof(g_bootstrap)) {
+        return NULL;
+    }
+    g_bootstrap_used = offset + size;
+    return g_bootstrap + offset;
+}
+
+static int bench_trace_is_bootstrap(const void* ptr) {
+    const unsigned char* p = (const unsigned char*)ptr;
+    return p >= g_bootstrap && p < g_bootstrap + sizeof(g_bootstrap);
+}
+
+static void bench_trace_resolve(void) {
+    if (g_real_free || g_resolving) {
+        return;
+    }
+    g_resolving = 1;
+    g_real_malloc = (BenchMallocFn)dlsym(RTLD_NEXT, "malloc");
+    g_real_calloc = (BenchCallocFn)dlsym(RTLD_NEXT, "calloc");
+    g_real_realloc = (BenchReallocFn)dlsym(RTLD_NEXT, "realloc");
+    g_real_posix_memalign =
+        (BenchPosixMemalignFn)dlsym(RTLD_NEXT, "posix_memalign");
+    g_real_aligned_alloc =
+        (BenchAlignedAllocFn)dlsym(RTLD_NEXT, "aligned_alloc");
+    g_real_memalign = (BenchAlignedAllocFn)dlsym(RTLD_NEXT, "memalign");
+    g_real_valloc = (BenchVallocFn)dlsym(RTLD_NEXT, "valloc");
+    g_real_free = (BenchFreeFn)dlsym(RTLD_NEXT, "free");
+    g_resolving = 0;
+}
+
+static void bench_trace_write_all(const void* data, size_t bytes) {
+    const unsigned char* p = (const unsigned char*)data;
+    while (bytes > 0) {
+        ssize_t n = write(g_fd, p, bytes);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        p += (size_t)n;
+        bytes -= (size_t)n;
+    }
+}
+
+static void bench_trace_flush_locked(BenchTraceBuffer* buffer) {
+    if (buffer->count == 0 || g_fd < 0) {
+        buffer->count = 0;
+        return;
+    }
+    bench_trace_write_all(buffer->records,
+                          (size_t)buffer->count * sizeof(BenchTraceRecord));
+    buffer->count = 0;
+}
+
+static void bench_trace_thread_exit(void* arg) {
+    BenchTraceBuffer* buffer = (BenchTraceBuffer*)arg;
+    BenchTraceBuffer** link;
+    t_busy = 1;
+    pthread_mutex_lock(&g_write_lock);
+    bench_trace_flush_locked(buffer);
+    for (link = &g_buffers; *link; link = &(*link)->next) {
+        if (*link == buffer) {
+            *link = buffer->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_write_lock);
+    t_buffer = NULL;
+    t_untraced = 1;
+    munmap(buffer, sizeof(*buffer));
+}
+
+static BenchTraceBuffer* bench_trace_thread_buffer(void) {
+    BenchTraceBuffer* buffer = t_buffer;
+    unsigned index;
+    if (buffer) {
+        return buffer;
+    }
+    if (t_untraced) {
+        return NULL;
+    }
+    index = atomic_fetch_add_explicit(&g_next_thread, 1u,
+                                      memory_order_relaxed);
+    if (index >= BENCH_TRACE_MAX_THREADS) {
+        t_untraced = 1;
+        return NULL;
+    }
+    buffer = (BenchTraceBuffer*)mmap(NULL, sizeof(*buffer),
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED) {
+        t_untraced = 1;
+        return NULL;
+    }
+    buffer->count = 0;
+    buffer->thread = (uint16_t)index;
+    pthread_mutex_lock(&g_write_lock);
+    buffer->next = g_buffers;
+    g_buffers = buffer;
+    pthread_mutex_unlock(&g_write_lock);
+    pthread_setspecific(g_exit_key, buffer);
+    t_buffer = buffer;
+    return buffer;
+}
+
+static int bench_trace_begin(void) {
+    if (t_busy || !atomic_load_explicit(&g_enabled, memory_order_relaxed)) {
+        return 0;
+    }
+    t_busy = 1;
+    return 1;
+}
+
+static void bench_trace_emit(uint8_t op,
+                             uint64_t ts_ns,
+                             const void* ptr,
+                             uint64_t aux,
+                             uint64_t size,
+                             uint32_t lead_ns) {
+    BenchTraceBuffer* buffer = bench_trace_thread_buffer();
+    BenchTraceRecord* record;
+    if (buffer) {
+        record = &buffer->records[buffer->count++];
+        record->ts_ns = ts_ns - g_start_ns;
+        record->ptr = (uint64_t)(uintptr_t)ptr;
+        record->aux = aux;
+        record->size = size;
+        record->thread = buffer->thread;
+        record->op = op;
+        record->reserved = 0;
+        record->lead_ns = lead_ns;
+        if (buffer->count == BENCH_TRACE_BUFFER_RECORDS) {
+            pthread_mutex_lock(&g_write_lock);
+            bench_trace_flush_locked(buffer);
+            pthread_mutex_unlock(&g_write_lock);
+        }
+    }
+    t_busy = 0;
+}
+
+static void bench_trace_fork_child(void) {
+    atomic_store_explicit(&g_enabled, 0, memory_order_relaxed);
+    if (g_fd >= 0) {
+        close(g_fd);
+        g_fd = -1;
+    }
+}
+
+static void bench_trace_format_path(char* out, size_t cap) {
+    const char* pattern = getenv("BENCH_TRACE_OUT");
+    char pid_text[24];
+    size_t pid_len = 0;
+    size_t used = 0;
+    long pid = (long)getpid();
+    char digits[24];
+    size_t ndigits = 0;
+
+    do {
+        digits[ndigits++] = (char)('0' + (pid % 10));
+        pid /= 10;
+    } while (pid > 0 && ndigits < sizeof(digits));
+    while (ndigits > 0) {
+        pid_text[pid_len++] = digits[--ndigits];
+    }
+    pid_text[pid_len] = '\0';
+
+    if (!pattern || pattern[0] == '\0') {
+        pattern = "bench_trace.%p.bin";
+    }
+    for (; *pattern && used + 1 < cap; ++pattern) {
+        if (pattern[0] == '%' && pattern[1] == 'p') {
+            size_t i;
+            for (i = 0; i < pid_len && used + 1 < cap; ++i) {
+                out[used++] = pid_text[i];
+            }
+            ++pattern;
+            continue;
+        }
+        out[used++] = *pattern;
+    }
+    out[used] = '\0';
+}
+
+__attribute__((constructor)) static void bench_trace_init(void) {
+    char path[BENCH_TRACE_PATH_BYTES];
+    BenchTraceHeader header;
+
+    t_busy = 1;
+    bench_trace_resolve();
+    bench_trace_format_path(path, sizeof(path));
+    g_fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (g_fd < 0 || pthread_key_create(&g_exit_key,
+                                       bench_trace_thread_exit) != 0) {
+        t_busy = 0;
+        return;
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BENCH_TRACE_MAGIC, BENCH_TRACE_MAGIC_BYTES);
+    header.version = BENCH_TRACE_VERSION;
+    header.record_size = (uint32_t)sizeof(BenchTraceRecord);
+    header.pid = (uint64_t)getpid();
+    bench_trace_write_all(&header, sizeof(header));
+    pthread_atfork(NULL, NULL, bench_trace_fork_child);
+    g_start_ns = bench_trace_now_ns();
+    atomic_store_explicit(&g_enabled, 1, memory_order_release);
+    t_busy = 0;
+}
+
+// Threads still running at exit lose at most the records they append while
+// the final flush runs.
+__attribute__((destructor)) static void bench_trace_fini(void) {
+    BenchTraceBuffer* buffer;
+    if (!atomic_exchange_explicit(&g_enabled, 0, memory_order_acq_rel)) {
+        return;
+    }
+    t_busy = 1;
+    pthread_mutex_lock(&g_write_lock);
+    for (buffer = g_buffers; buffer; buffer = buffer->next) {
+        bench_trace_flush_locked(buffer);
+    }
+    close(g_fd);
+    g_fd = -1;
+    pthread_mutex_unlock(&g_write_lock);
+    t_busy = 0;
+}
+
+BENCH_TRACE_EXPORT void* malloc(size_t size) {
+    void* ptr;
+    bench_trace_resolve();
+    if (!g_real_malloc) {
+        return bench_trace_bootstrap_alloc(size);
+    }
+    ptr = g_real_malloc(size);
+    if (ptr && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_MALLOC, bench_trace_now_ns(), ptr, 0,
+                         size, 0);
+    }
+    return ptr;
+}
+
+BENCH_TRACE_EXPORT void* calloc(size_t nmemb, size_t size) {
+    void* ptr;
+    bench_trace_resolve();
+    if (!g_real_calloc) {
+        if (size != 0 && nmemb > SIZE_MAX / size) {
+            return NULL;
+        }
+        // Bootstrap memory is static and therefore already zeroed.
+        return bench_trace_bootstrap_alloc(nmemb * size);
+    }
+    ptr = g_real_calloc(nmemb, size);
+    if (ptr && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_CALLOC, bench_trace_now_ns(), ptr, 0,
+                         (uint64_t)nmemb * (uint64_t)size, 0);
+    }
+    return ptr;
+}
+
+BENCH_TRACE_EXPORT void* realloc(void* old, size_t size) {
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint64_t lead_ns;
+    void* ptr;
+    bench_trace_resolve();
+    if (bench_trace_is_bootstrap(old)) {
+        ptr = malloc(size);
+        if (ptr) {
+            size_t room = (size_t)(g_bootstrap + sizeof(g_bootstrap) -
+                                   (unsigned char*)old);
+            memcpy(ptr, old, size < room ? size : room);
+        }
+        return ptr;
+    }
+    if (!g_real_realloc) {
+        return bench_trace_bootstrap_alloc(size);
+    }
+    start_ns = bench_trace_now_ns();
+    ptr = g_real_realloc(old, size);
+    // A failed realloc leaves old live; realloc(old, 0) returning NULL
+    // released it.
+    if ((ptr || (old && size == 0)) && bench_trace_begin()) {
+        end_ns = bench_trace_now_ns();
+        lead_ns = end_ns - start_ns;
+        bench_trace_emit(BENCH_TRACE_OP_REALLOC, end_ns, ptr,
+                         (uint64_t)(uintptr_t)old, size,
+                         lead_ns > UINT32_MAX ? UINT32_MAX : (uint32_t)lead_ns);
+    }
+    return ptr;
+}
+
+BENCH_TRACE_EXPORT void free(void* ptr) {
+    if (!ptr || bench_trace_is_bootstrap(ptr)) {
+        return;
+    }
+    bench_trace_resolve();
+    if (!g_real_free) {
+        return;
+    }
+    if (bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_FREE, bench_trace_now_ns(), ptr, 0, 0,
+                         0);
+    }
+    g_real_free(ptr);
+}
+
+BENCH_TRACE_EXPORT int posix_memalign(void** memptr,
+                                      size_t alignment,
+                                      size_t size) {
+    int rc;
+    bench_trace_resolve();
+    if (!g_real_posix_memalign) {
+        return ENOMEM;
+    }
+    rc = g_real_posix_memalign(memptr, alignment, size);
+    if (rc == 0 && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_ALIGNED, bench_trace_now_ns(), *memptr,
+                         alignment, size, 0);
+    }
+    return rc;
+}
+
+BENCH_TRACE_EXPORT void* aligned_alloc(size_t alignment, size_t size) {
+    void* ptr;
+    bench_trace_resolve();
+    if (!g_real_aligned_alloc) {
+        return NULL;
+    }
+    ptr = g_real_aligned_alloc(alignment, size);
+    if (ptr && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_ALIGNED, bench_trace_now_ns(), ptr,
+                         alignment, size, 0);
+    }
+    return ptr;
+}
+
+BENCH_TRACE_EXPORT void* memalign(size_t alignment, size_t size) {
+    void* ptr;
+    bench_trace_resolve();
+    if (!g_real_memalign) {
+        return NULL;
+    }
+    ptr = g_real_memalign(alignment, size);
+    if (ptr && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_ALIGNED, bench_trace_now_ns(), ptr,
+                         alignment, size, 0);
+    }
+    return ptr;
+}
+
+BENCH_TRACE_EXPORT void* valloc(size_t size) {
+    void* ptr;
+    bench_trace_resolve();
+    if (!g_real_valloc) {
+        return NULL;
+    }
+    ptr = g_real_valloc(size);
+    if (ptr && bench_trace_begin()) {
+        bench_trace_emit(BENCH_TRACE_OP_ALIGNED, bench_trace_now_ns(), ptr,
+                         (uint64_t)sysconf(_SC_PAGESIZE), size, 0);
+    }
+    return ptr;
+}
@@ -0,0 +1,699 @@
+// Deterministic multi-threaded replay of a bench_trace_record.c trace.
+// Usage: bench_trace_replay <trace.bin> [--no-touch]
+//
+// Every recorded thread becomes one replay thread that issues the same
+// calls in the same order. An object freed (or realloc'ed) by another
+// thread than the one that allocated it waits until the allocating thread
+// has published it, so the original cross-thread free pattern is kept
+// without replaying the original timing.
+//
+// Backend selection (compile time):
+//   default                    malloc / free from the process (use
+//                              LD_PRELOAD or bench/run_compare.sh for the
+//                              preload lines: hz3, hz4, hz5, hz6, hz8,
+//                              hz10, hz11)
+//   -DBENCH_TRACE_USE_HZ3=1    hz3_* direct API; aligned ops replay as
+//                              plain hz3_malloc (hz3 has no aligned entry)
+//   -DBENCH_TRACE_USE_H8=1     h8_* direct API
+//   -DBENCH_TRACE_USE_HZ12=1   hz12_* direct API
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "bench_trace_format.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef BENCH_TRACE_USE_HZ3
+#define BENCH_TRACE_USE_HZ3 0
+#endif
+#ifndef BENCH_TRACE_USE_H8
+#define BENCH_TRACE_USE_H8 0
+#endif
+#ifndef BENCH_TRACE_USE_HZ12
+#define BENCH_TRACE_USE_HZ12 0
+#endif
+
+#if BENCH_TRACE_USE_HZ3
+#include "hz3.h"
+#define BENCH_TRACE_BACKEND "hz3"
+#elif BENCH_TRACE_USE_H8
+#include "h8.h"
+#define BENCH_TRACE_BACKEND "h8"
+#elif BENCH_TRACE_USE_HZ12
+#include "hz12.h"
+#define BENCH_TRACE_BACKEND "hz12"
+#else
+#define BENCH_TRACE_BACKEND "crt"
+#endif
+
+static inline void* replay_malloc(size_t size) {
+#if BENCH_TRACE_USE_HZ3
+    return hz3_malloc(size);
+#elif BENCH_TRACE_USE_H8
+    return h8_malloc(size);
+#elif BENCH_TRACE_USE_HZ12
+    return hz12_malloc(size);
+#else
+    return malloc(size);
+#endif
+}
+
+static inline void* replay_calloc(size_t size) {
+#if BENCH_TRACE_USE_HZ3
+    return hz3_calloc(1, size);
+#elif BENCH_TRACE_USE_H8
+    return h8_calloc(1, size);
+#elif BENCH_TRACE_USE_HZ12
+    return hz12_calloc(1, size);
+#else
+    return calloc(1, size);
+#endif
+}
+
+static inline void* replay_realloc(void* ptr, size_t size) {
+#if BENCH_TRACE_USE_HZ3
+    return hz3_realloc(ptr, size);
+#elif BENCH_TRACE_USE_H8
+    return h8_realloc(ptr, size);
+#elif BENCH_TRACE_USE_HZ12
+    return hz12_realloc(ptr, size);
+#else
+    return realloc(ptr, size);
+#endif
+}
+
+static inline void* replay_aligned(size_t alignment, size_t size) {
+    void* ptr = NULL;
+#if BENCH_TRACE_USE_HZ3
+    (void)alignment;
+    ptr = hz3_malloc(size);
+#elif BENCH_TRACE_USE_H8
+    if (h8_posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = NULL;
+    }
+#elif BENCH_TRACE_USE_HZ12
+    if (hz12_posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = NULL;
+    }
+#else
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = NULL;
+    }
+#endif
+    return ptr;
+}
+
+static inline void replay_free(void* ptr) {
+#if BENCH_TRACE_USE_HZ3
+    hz3_free(ptr);
+#elif BENCH_TRACE_USE_H8
+    h8_free(ptr);
+#elif BENCH_TRACE_USE_HZ12
+    hz12_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+#define REPLAY_NO_OBJECT UINT32_MAX
+// Slot states besides a live pointer.
+#define REPLAY_SLOT_FAILED ((void*)(uintptr_t)1)
+#define REPLAY_SLOT_FREED ((void*)(uintptr_t)2)
+
+typedef struct ReplayOp {
+    uint64_t size;
+    uint64_t alignment;
+    uint32_t obj_old;   // object released by this op (free / realloc)
+    uint32_t obj_new;   // object produced by this op (alloc / realloc)
+    uint8_t op;
+} ReplayOp;
+
+typedef struct ReplayThread {
+    ReplayOp* ops;
+    size_t count;
+    size_t cap;
+    size_t waits;
+    size_t failed;
+} ReplayThread;
+
+typedef struct ReplayEvent {
+    uint64_t ts;
+    uint32_t record;
+    uint8_t release;
+} ReplayEvent;
+
+typedef struct ReplayMapEntry {
+    uint64_t addr;      // 0 = empty
+    uint32_t obj;
+} ReplayMapEntry;
+
+typedef struct ReplayMap {
+    ReplayMapEntry* entries;
+    size_t mask;
+    size_t live;
+} ReplayMap;
+
+typedef struct ReplayTrace {
+    BenchTraceRecord* records;
+    size_t record_count;
+    uint32_t* obj_old;
+    uint32_t* obj_new;
+    uint16_t* obj_thread;
+    size_t object_count;
+    size_t thread_count;
+    size_t ops_by_kind[BENCH_TRACE_OP_ALIGNED + 1];
+    size_t remote_releases;
+    size_t unknown_releases;
+    size_t address_conflicts;
+} ReplayTrace;
+
+static _Atomic(void*)* g_slots;
+static atomic_size_t g_ready;
+static atomic_int g_go;
+static int g_touch = 1;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static size_t peak_working_set_kb(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return (size_t)usage.ru_maxrss;
+}
+
+static size_t current_resident_set_kb(void) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    unsigned long total_pages = 0;
+    unsigned long resident_pages = 0;
+    FILE* file;
+    int scanned;
+    if (page_size <= 0) {
+        return 0;
+    }
+    file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+    scanned = fscanf(file, "%lu %lu", &total_pages, &resident_pages);
+    fclose(file);
+    if (scanned != 2) {
+        return 0;
+    }
+    return (size_t)((resident_pages * (unsigned long)page_size) / 1024ul);
+}
+
+static uint64_t map_hash(uint64_t addr) {
+    addr ^= addr >> 33;
+    addr *= 0xff51afd7ed558ccdULL;
+    addr ^= addr >> 33;
+    return addr;
+}
+
+static int map_init(ReplayMap* map, size_t cap) {
+    map->entries = (ReplayMapEntry*)calloc(cap, sizeof(ReplayMapEntry));
+    map->mask = cap - 1u;
+    map->live = 0;
+    return map->entries != NULL;
+}
+
+static size_t map_find_slot(const ReplayMap* map, uint64_t addr) {
+    size_t i = (size_t)map_hash(addr) & map->mask;
+    while (map->entries[i].addr != 0 && map->entries[i].addr != addr) {
+        i = (i + 1u) & map->mask;
+    }
+    return i;
+}
+
+static int map_grow(ReplayMap* map) {
+    ReplayMap bigger;
+    size_t i;
+    if (!map_init(&bigger, (map->mask + 1u) * 2u)) {
+        return 0;
+    }
+    for (i = 0; i <= map->mask; ++i) {
+        if (map->entries[i].addr != 0) {
+            bigger.entries[map_find_slot(&bigger, map->entries[i].addr)] =
+                map->entries[i];
+        }
+    }
+    bigger.live = map->live;
+    free(map->entries);
+    *map = bigger;
+    return 1;
+}
+
+// Returns the previous object at addr, or REPLAY_NO_OBJECT.
+static uint32_t map_put(ReplayMap* map, uint64_t addr, uint32_t obj) {
+    size_t i;
+    uint32_t previous = REPLAY_NO_OBJECT;
+    if ((map->live + 1u) * 2u > map->mask + 1u && !map_grow(map)) {
+        fprintf(stderr, "address map grow failed\n");
+        exit(1);
+    }
+    i = map_find_slot(map, addr);
+    if (map->entries[i].addr == addr) {
+        previous = map->entries[i].obj;
+    } else {
+        map->live++;
+    }
+    map->entries[i].addr = addr;
+    map->entries[i].obj = obj;
+    return previous;
+}
+
+// Linear-probing delete with backward shift, so lookups need no tombstones.
+static uint32_t map_take(ReplayMap* map, uint64_t addr) {
+    size_t i = map_find_slot(map, addr);
+    size_t j;
+    uint32_t obj;
+    if (map->entries[i].addr == 0) {
+        return REPLAY_NO_OBJECT;
+    }
+    obj = map->entries[i].obj;
+    map->entries[i].addr = 0;
+    map->live--;
+    j = i;
+    for (;;) {
+        size_t home;
+        j = (j + 1u) & map->mask;
+        if (map->entries[j].addr == 0) {
+            break;
+        }
+        home = (size_t)map_hash(map->entries[j].addr) & map->mask;
+        if (((j - home) & map->mask) >= ((j - i) & map->mask)) {
+            map->entries[i] = map->entries[j];
+            map->entries[j].addr = 0;
+            i = j;
+        }
+    }
+    return obj;
+}
+
+static int event_compare(const void* a, const void* b) {
+    const ReplayEvent* x = (const ReplayEvent*)a;
+    const ReplayEvent* y = (const ReplayEvent*)b;
+    if (x->ts != y->ts) {
+        return x->ts < y->ts ? -1 : 1;
+    }
+    // A release and an acquire at the same instant: the address was free
+    // first, otherwise the acquire could not have returned it.
+    if (x->release != y->release) {
+        return x->release ? -1 : 1;
+    }
+    return x->record < y->record ? -1 : (x->record > y->record ? 1 : 0);
+}
+
+static int op_allocates(uint8_t op) {
+    return op == BENCH_TRACE_OP_MALLOC || op == BENCH_TRACE_OP_CALLOC ||
+           op == BENCH_TRACE_OP_ALIGNED;
+}
+
+static int trace_load(const char* path, ReplayTrace* trace) {
+    FILE* file = fopen(path, "rb");
+    BenchTraceHeader header;
+    long bytes;
+    size_t i;
+
+    memset(trace, 0, sizeof(*trace));
+    if (!file) {
+        fprintf(stderr, "open trace failed: %s\n", path);
+        return 0;
+    }
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, BENCH_TRACE_MAGIC, BENCH_TRACE_MAGIC_BYTES) != 0 ||
+        header.version != BENCH_TRACE_VERSION ||
+        header.record_size != sizeof(BenchTraceRecord)) {
+        fprintf(stderr, "not a v%u allocation trace: %s\n",
+                BENCH_TRACE_VERSION, path);
+        fclose(file);
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    bytes = ftell(file) - (long)sizeof(header);
+    fseek(file, (long)sizeof(header), SEEK_SET);
+    trace->record_count = bytes > 0 ? (size_t)bytes / sizeof(BenchTraceRecord)
+                                    : 0;
+    if (trace->record_count >= REPLAY_NO_OBJECT) {
+        fprintf(stderr, "trace too large: %zu records\n", trace->record_count);
+        fclose(file);
+        return 0;
+    }
+    trace->records = (BenchTraceRecord*)malloc(
+        (trace->record_count ? trace->record_count : 1u) *
+        sizeof(BenchTraceRecord));
+    if (!trace->records ||
+        fread(trace->records, sizeof(BenchTraceRecord), trace->record_count,
+              file) != trace->record_count) {
+        fprintf(stderr, "read trace failed: %s\n", path);
+        fclose(file);
+        return 0;
+    }
+    fclose(file);
+
+    for (i = 0; i < trace->record_count; ++i) {
+        const BenchTraceRecord* record = &trace->records[i];
+        if (record->op < BENCH_TRACE_OP_MALLOC ||
+            record->op > BENCH_TRACE_OP_ALIGNED) {
+            fprintf(stderr, "bad op %u at record %zu\n", record->op, i);
+            return 0;
+        }
+        trace->ops_by_kind[record->op]++;
+        if ((size_t)record->thread + 1u > trace->thread_count) {
+            trace->thread_count = (size_t)record->thread + 1u;
+        }
+    }
+    return 1;
+}
+
+// Turns recorded addresses into object ids. Addresses are reused, so the
+// mapping walks every acquire and release in recorded time order.
+static int trace_resolve_objects(ReplayTrace* trace) {
+    size_t n = trace->record_count;
+    ReplayEvent* events = (ReplayEvent*)malloc((n ? n : 1u) * 2u *
+                                               sizeof(ReplayEvent));
+    size_t event_count = 0;
+    ReplayMap map;
+    size_t i;
+
+    trace->obj_old = (uint32_t*)malloc((n ? n : 1u) * sizeof(uint32_t));
+    trace->obj_new = (uint32_t*)malloc((n ? n : 1u) * sizeof(uint32_t));
+    trace->obj_thread = (uint16_t*)malloc((n ? n : 1u) * sizeof(uint16_t));
+    if (!events || !trace->obj_old || !trace->obj_new || !trace->obj_thread ||
+        !map_init(&map, 1024u)) {
+        fprintf(stderr, "alloc object map failed\n");
+        return 0;
+    }
+
+    for (i = 0; i < n; ++i) {
+        const BenchTraceRecord* record = &trace->records[i];
+        uint64_t release_addr = 0;
+        uint64_t release_ts = record->ts_ns;
+        uint64_t acquire_addr = 0;
+        trace->obj_old[i] = REPLAY_NO_OBJECT;
+        trace->obj_new[i] = REPLAY_NO_OBJECT;
+        if (op_allocates(record->op)) {
+            acquire_addr = record->ptr;
+        } else if (record->op == BENCH_TRACE_OP_FREE) {
+            release_addr = record->ptr;
+        } else {
+            release_addr = record->aux;
+            acquire_addr = record->ptr;
+            release_ts = record->ts_ns >= record->lead_ns
+                             ? record->ts_ns - record->lead_ns
+                             : 0;
+        }
+        if (release_addr != 0) {
+            events[event_count].ts = release_ts;
+            events[event_count].record = (uint32_t)i;
+            events[event_count].release = 1;
+            event_count++;
+        }
+        if (acquire_addr != 0) {
+            events[event_count].ts = record->ts_ns;
+            events[event_count].record = (uint32_t)i;
+            events[event_count].release = 0;
+            event_count++;
+        }
+    }
+    qsort(events, event_count, sizeof(ReplayEvent), event_compare);
+
+    for (i = 0; i < event_count; ++i) {
+        const BenchTraceRecord* record = &trace->records[events[i].record];
+        uint32_t r = events[i].record;
+        if (events[i].release) {
+            uint64_t addr = record->op == BENCH_TRACE_OP_FREE ? record->ptr
+                                                              : record->aux;
+            uint32_t obj = map_take(&map, addr);
+            if (obj == REPLAY_NO_OBJECT) {
+                trace->unknown_releases++;
+                continue;
+            }
+            trace->obj_old[r] = obj;
+            if (trace->obj_thread[obj] != record->thread) {
+                trace->remote_releases++;
+            }
+        } else {
+            uint32_t obj = (uint32_t)trace->object_count++;
+            trace->obj_new[r] = obj;
+            trace->obj_thread[obj] = record->thread;
+            // A live address handed out again means its release was lost
+            // (for example a free from an untraced thread). The old object
+            // stays live until the end of the replay.
+            if (map_put(&map, record->ptr, obj) != REPLAY_NO_OBJECT) {
+                trace->address_conflicts++;
+            }
+        }
+    }
+    free(map.entries);
+    free(events);
+    return 1;
+}
+
+static int thread_push(ReplayThread* thread, const ReplayOp* op) {
+    if (thread->count == thread->cap) {
+        size_t cap = thread->cap ? thread->cap * 2u : 256u;
+        ReplayOp* ops = (ReplayOp*)realloc(thread->ops, cap * sizeof(ReplayOp));
+        if (!ops) {
+            return 0;
+        }
+        thread->ops = ops;
+        thread->cap = cap;
+    }
+    thread->ops[thread->count++] = *op;
+    return 1;
+}
+
+// Per-thread op lists in recorded call order; the recorder writes each
+// thread's records in order, so file order within a thread is call order.
+static ReplayThread* trace_build_threads(const ReplayTrace* trace,
+                                         size_t* op_count) {
+    ReplayThread* threads = (ReplayThread*)calloc(
+        trace->thread_count ? trace->thread_count : 1u, sizeof(ReplayThread));
+    size_t i;
+    *op_count = 0;
+    if (!threads) {
+        return NULL;
+    }
+    for (i = 0; i < trace->record_count; ++i) {
+        const BenchTraceRecord* record = &trace->records[i];
+        ReplayOp op;
+        op.size = record->size;
+        op.alignment = record->op == BENCH_TRACE_OP_ALIGNED ? record->aux : 0;
+        op.obj_old = trace->obj_old[i];
+        op.obj_new = trace->obj_new[i];
+        op.op = record->op;
+        if (op.obj_old == REPLAY_NO_OBJECT && op.obj_new == REPLAY_NO_OBJECT) {
+            continue;
+        }
+        if (!thread_push(&threads[record->thread], &op)) {
+            fprintf(stderr, "alloc replay ops failed\n");
+            return NULL;
+        }
+        (*op_count)++;
+    }
+    return threads;
+}
+
+static void* replay_wait_object(uint32_t obj, size_t* waits) {
+    void* ptr = atomic_load_explicit(&g_slots[obj], memory_order_acquire);
+    unsigned spins = 0;
+    if (ptr) {
+        return ptr;
+    }
+    (*waits)++;
+    while (!(ptr = atomic_load_explicit(&g_slots[obj],
+                                        memory_order_acquire))) {
+        if (++spins >= 64u) {
+            sched_yield();
+            spins = 0;
+        }
+    }
+    return ptr;
+}
+
+static void replay_publish(uint32_t obj, void* ptr, size_t size,
+                           size_t* failed) {
+    if (!ptr) {
+        (*failed)++;
+        ptr = REPLAY_SLOT_FAILED;
+    } else if (g_touch && size > 0) {
+        *(volatile unsigned char*)ptr = 0xA5;
+    }
+    atomic_store_explicit(&g_slots[obj], ptr, memory_order_release);
+}
+
+static void* replay_thread_main(void* arg) {
+    ReplayThread* thread = (ReplayThread*)arg;
+    size_t i;
+
+    atomic_fetch_add_explicit(&g_ready, 1u, memory_order_acq_rel);
+    while (!atomic_load_explicit(&g_go, memory_order_acquire)) {
+        sched_yield();
+    }
+
+    for (i = 0; i < thread->count; ++i) {
+        const ReplayOp* op = &thread->ops[i];
+        void* old = NULL;
+        void* ptr;
+        if (op->obj_old != REPLAY_NO_OBJECT) {
+            old = replay_wait_object(op->obj_old, &thread->waits);
+            atomic_store_explicit(&g_slots[op->obj_old], REPLAY_SLOT_FREED,
+                                  memory_order_relaxed);
+            if (old == REPLAY_SLOT_FAILED) {
+                old = NULL;
+            }
+        }
+        switch (op->op) {
+            case BENCH_TRACE_OP_MALLOC:
+                ptr = replay_malloc((size_t)op->size);
+                replay_publish(op->obj_new, ptr, (size_t)op->size,
+                               &thread->failed);
+                break;
+            case BENCH_TRACE_OP_CALLOC:
+                ptr = replay_calloc((size_t)op->size);
+                replay_publish(op->obj_new, ptr, (size_t)op->size,
+                               &thread->failed);
+                break;
+            case BENCH_TRACE_OP_ALIGNED:
+                ptr = replay_aligned((size_t)op->alignment, (size_t)op->size);
+                replay_publish(op->obj_new, ptr, (size_t)op->size,
+                               &thread->failed);
+                break;
+            case BENCH_TRACE_OP_FREE:
+                if (old) {
+                    replay_free(old);
+                }
+                break;
+            case BENCH_TRACE_OP_REALLOC:
+                if (op->obj_new == REPLAY_NO_OBJECT) {
+                    // realloc(p, 0) that freed p.
+                    if (old) {
+                        replay_free(old);
+                    }
+                    break;
+                }
+                ptr = replay_realloc(old, (size_t)op->size);
+                if (!ptr && old) {
+                    replay_free(old);
+                }
+                replay_publish(op->obj_new, ptr, (size_t)op->size,
+                               &thread->failed);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    ReplayTrace trace;
+    ReplayThread* threads;
+    pthread_t* tids;
+    size_t op_count = 0;
+    size_t waits = 0;
+    size_t failed = 0;
+    size_t leaked = 0;
+    size_t base_kb;
+    size_t end_kb;
+    uint64_t start;
+    uint64_t end;
+    double sec;
+    size_t i;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <trace.bin> [--no-touch]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2 && strcmp(argv[2], "--no-touch") == 0) {
+        g_touch = 0;
+    }
+    if (!trace_load(argv[1], &trace) || !trace_resolve_objects(&trace)) {
+        return 1;
+    }
+    threads = trace_build_threads(&trace, &op_count);
+    g_slots = (_Atomic(void*)*)calloc(
+        trace.object_count ? trace.object_count : 1u, sizeof(*g_slots));
+    tids = (pthread_t*)calloc(trace.thread_count ? trace.thread_count : 1u,
+                              sizeof(pthread_t));
+    if (!threads || !g_slots || !tids) {
+        fprintf(stderr, "alloc replay state failed\n");
+        return 1;
+    }
+    free(trace.records);
+    trace.records = NULL;
+
+    base_kb = current_resident_set_kb();
+    for (i = 0; i < trace.thread_count; ++i) {
+        if (pthread_create(&tids[i], NULL, replay_thread_main, &threads[i]) !=
+            0) {
+            fprintf(stderr, "pthread_create failed at thread %zu\n", i);
+            return 1;
+        }
+    }
+    while (atomic_load_explicit(&g_ready, memory_order_acquire) <
+           trace.thread_count) {
+        sched_yield();
+    }
+    start = now_ns();
+    atomic_store_explicit(&g_go, 1, memory_order_release);
+    for (i = 0; i < trace.thread_count; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    end = now_ns();
+    end_kb = current_resident_set_kb();
+
+    for (i = 0; i < trace.object_count; ++i) {
+        void* ptr = atomic_load_explicit(&g_slots[i], memory_order_relaxed);
+        if (ptr && ptr != REPLAY_SLOT_FAILED && ptr != REPLAY_SLOT_FREED) {
+            replay_free(ptr);
+            leaked++;
+        }
+    }
+    for (i = 0; i < trace.thread_count; ++i) {
+        waits += threads[i].waits;
+        failed += threads[i].failed;
+        free(threads[i].ops);
+    }
+
+    sec = (double)(end - start) / 1000000000.0;
+    printf("trace=%s backend=%s threads=%zu ops=%zu objects=%zu "
+           "malloc=%zu calloc=%zu realloc=%zu free=%zu aligned=%zu "
+           "remote_free=%zu unknown_free=%zu addr_conflict=%zu "
+           "waits=%zu failed=%zu live_at_end=%zu\n",
+           argv[1], BENCH_TRACE_BACKEND, trace.thread_count, op_count,
+           trace.object_count, trace.ops_by_kind[BENCH_TRACE_OP_MALLOC],
+           trace.ops_by_kind[BENCH_TRACE_OP_CALLOC],
+           trace.ops_by_kind[BENCH_TRACE_OP_REALLOC],
+           trace.ops_by_kind[BENCH_TRACE_OP_FREE],
+           trace.ops_by_kind[BENCH_TRACE_OP_ALIGNED], trace.remote_releases,
+           trace.unknown_releases, trace.address_conflicts, waits, failed,
+           leaked);
+    printf("time=%.3f ops/s=%.3f peak_kb=%zu base_kb=%zu end_kb=%zu\n", sec,
+           sec > 0.0 ? (double)op_count / sec : 0.0, peak_working_set_kb(),
+           base_kb, end_kb);
+
+    free(tids);
+    free((void*)g_slots);
+    free(threads);
+    free(trace.obj_old);
+    free(trace.obj_new);
+    free(trace.obj_thread);
+    return failed ? 2 : 0;
+}
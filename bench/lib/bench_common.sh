@@ -138,6 +138,18 @@ bench_find_hz8_library() {
     "${ROOT_DIR}/hakozuna-hz8/libhakozuna_hz8_preload.so"
 }
 
+bench_find_hz10_library() {
+  bench_find_first_existing \
+    "${HZ10_SO:-}" \
+    "${ROOT_DIR}/hakozuna-hz10/libhz10.so"
+}
+
+bench_find_hz11_library() {
+  bench_find_first_existing \
+    "${HZ11_SO:-}" \
+    "${ROOT_DIR}/hakozuna-hz11/libhz11.so"
+}
+
 bench_find_hz6_preload_output() {
   local env_var="$1"
   local out_dir="$2"
@@ -468,6 +480,12 @@ bench_find_allocator_library() {
     hz8)
       bench_find_hz8_library
       ;;
+    hz10)
+      bench_find_hz10_library
+      ;;
+    hz11)
+      bench_find_hz11_library
+      ;;
     hz6-toy-target|hz6_toy_target)
       bench_find_hz6_toy_target_library
       ;;
@@ -630,6 +648,12 @@ bench_print_allocator_hints() {
     hz8)
       echo "hint: build HZ8 preload with 'make -C hakozuna-hz8 preload-smoke' or set HZ8_SO" >&2
       ;;
+    hz10)
+      echo "hint: build HZ10 preload with 'make -C hakozuna-hz10 preload' or set HZ10_SO" >&2
+      ;;
+    hz11)
+      echo "hint: build HZ11 preload with 'make -C hakozuna-hz11 preload' or set HZ11_SO" >&2
+      ;;
     hz6-toy-target|hz6_toy_target)
       echo "hint: build the HZ6 Toy target lane with './hakozuna-hz6/linux/build_hz6_preload_toy_target.sh' or set HZ6_TOY_TARGET_PRELOAD_SO" >&2
       ;;
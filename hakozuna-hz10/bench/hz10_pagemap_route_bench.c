@@ -187,11 +187,123 @@ static int hz10_bench_run(const char* mech, int use_pagemap, uint64_t iters,
   return 0;
 }
 
+/*
+ * HZ10RouteRecip-L1 interior-check variants (MODE=3). All three run the
+ * same inlined copy of hz10_pagemap_route_local_fast()'s record read and
+ * bounds checks against the real pagemap; they differ only in the
+ * multi-slot interior check:
+ *   modulo     -- offset % slot_size (the pre-L1 product check)
+ *   skip_check -- no interior check (HZ10_DIAG_SKIP_LOCAL_INTERIOR_MOD_CHECK)
+ *   recip      -- hz10_pagemap_recip_divides() on rec->slot_recip (product)
+ * Half the queried pointers are interior, so the checking variants must
+ * reject them and skip_check must (wrongly) accept them -- the expected
+ * checksum differs per variant and is verified, which keeps the check
+ * itself from being dead-code eliminated.
+ */
+typedef enum Hz10BenchInterior {
+  HZ10_BENCH_INTERIOR_MODULO = 0,
+  HZ10_BENCH_INTERIOR_SKIP = 1,
+  HZ10_BENCH_INTERIOR_RECIP = 2
+} Hz10BenchInterior;
+
+static inline __attribute__((always_inline)) int hz10_bench_local_route(
+    const void* ptr, Hz10BenchInterior variant) {
+  uintptr_t addr = (uintptr_t)ptr;
+  uint32_t page_index = hz10_pagemap_page_index(addr);
+  H10Leaf* leaf =
+      hz10_pagemap_leaf_load(hz10_pagemap_root_index(page_index));
+  if (!leaf) {
+    return 0;
+  }
+  const H10PageRecord* rec =
+      &leaf->entries[hz10_pagemap_leaf_index(page_index)];
+  uint32_t slot_size = __atomic_load_n(&rec->slot_size, __ATOMIC_ACQUIRE);
+  if (slot_size == 0u) {
+    return 0;
+  }
+  void* base = __atomic_load_n(&rec->base, __ATOMIC_RELAXED);
+  uint32_t slot_count = __atomic_load_n(&rec->slot_count, __ATOMIC_RELAXED);
+  uint32_t flags = __atomic_load_n(&rec->flags, __ATOMIC_RELAXED);
+  uint32_t slot_recip = __atomic_load_n(&rec->slot_recip, __ATOMIC_RELAXED);
+  if (flags != 0u) {
+    return 0;
+  }
+  uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
+  uint64_t offset = (uint64_t)(addr - (uintptr_t)base);
+  if (offset >= span || (offset & (HZ10_MIN_ALIGN - 1u)) != 0u) {
+    return 0;
+  }
+  if (slot_count == 1u) {
+    return offset == 0u;
+  }
+  switch (variant) {
+    case HZ10_BENCH_INTERIOR_MODULO:
+      return (offset % slot_size) == 0u;
+    case HZ10_BENCH_INTERIOR_SKIP:
+      return 1;
+    case HZ10_BENCH_INTERIOR_RECIP:
+    default:
+      return hz10_pagemap_recip_divides(offset, slot_recip);
+  }
+}
+
+static int hz10_bench_interior_run(const char* mech,
+                                   Hz10BenchInterior variant, uint64_t iters,
+                                   uint32_t queries, void** qaddrs,
+                                   uint32_t run_index, uint32_t run_count,
+                                   uint32_t threads) {
+  uint64_t accepted = 0;
+  uint64_t start = hz10_platform_now_ns();
+  for (uint64_t i = 0; i < iters; ++i) {
+    uint32_t q = (uint32_t)(i % queries);
+    switch (variant) {
+      case HZ10_BENCH_INTERIOR_MODULO:
+        accepted += (uint64_t)hz10_bench_local_route(
+            qaddrs[q], HZ10_BENCH_INTERIOR_MODULO);
+        break;
+      case HZ10_BENCH_INTERIOR_SKIP:
+        accepted += (uint64_t)hz10_bench_local_route(
+            qaddrs[q], HZ10_BENCH_INTERIOR_SKIP);
+        break;
+      case HZ10_BENCH_INTERIOR_RECIP:
+      default:
+        accepted += (uint64_t)hz10_bench_local_route(
+            qaddrs[q], HZ10_BENCH_INTERIOR_RECIP);
+        break;
+    }
+  }
+  uint64_t elapsed_ns = hz10_platform_now_ns() - start;
+  /* Even query indexes are slot boundaries, odd ones are interior. */
+  uint64_t boundaries = (iters / queries) * ((queries + 1u) / 2u) +
+                        ((iters % queries) + 1u) / 2u;
+  uint64_t expected =
+      variant == HZ10_BENCH_INTERIOR_SKIP ? iters : boundaries;
+  if (accepted != expected) {
+    fprintf(stderr, "%s: accepted %llu, expected %llu\n", mech,
+            (unsigned long long)accepted, (unsigned long long)expected);
+    return 1;
+  }
+  double seconds = hz10_bench_seconds(elapsed_ns);
+  if (seconds <= 0.0) {
+    seconds = 1e-9;
+  }
+  printf(
+      "hz10_pagemap_route mech=%s threads=%u iters=%llu run=%u/%u "
+      "queries=%u seconds=%.6f ops_per_s=%.2f checksum=%llu\n",
+      mech, threads, (unsigned long long)iters, run_index, run_count,
+      queries, seconds, (double)iters / seconds,
+      (unsigned long long)accepted);
+  return 0;
+}
+
 int main(void) {
   uint64_t iters = hz10_bench_env_u64("ITERS", 20000000ull);
   uint32_t pages = (uint32_t)hz10_bench_env_u64("PAGES", 4096ull);
   uint32_t runs = (uint32_t)hz10_bench_env_u64("RUNS", 1ull);
-  uint32_t mode = (uint32_t)hz10_bench_env_u64("MODE", 2ull); /* 2 = both */
+  /* 0 = pagemap, 1 = hash baseline, 2 = both, 3 = interior-check variants
+   * (modulo / skip_check / recip) over SLOT_SIZE-byte multi-slot pages. */
+  uint32_t mode = (uint32_t)hz10_bench_env_u64("MODE", 2ull);
+  uint32_t slot_size = (uint32_t)hz10_bench_env_u64("SLOT_SIZE", 48ull);
   uint32_t threads = 1u; /* Box 1 is single-threaded; recorded per bench/README.md */
 
   if (pages == 0u) {
@@ -228,7 +340,53 @@ int main(void) {
   }
 
   int failed = 0;
-  for (uint32_t run = 1; run <= runs && !failed; ++run) {
+  if (mode == 3u) {
+    if (slot_size < HZ10_MIN_ALIGN || slot_size % HZ10_MIN_ALIGN != 0u ||
+        slot_size > HZ10_PAGE_QUANTUM / 8u) {
+      fprintf(stderr, "SLOT_SIZE must be a 16-byte multiple <= %u\n",
+              HZ10_PAGE_QUANTUM / 8u);
+      return 1;
+    }
+    uint32_t queries = pages * 2u;
+    void** qaddrs = calloc(queries, sizeof(*qaddrs));
+    if (!qaddrs) {
+      fprintf(stderr, "allocation failure\n");
+      return 1;
+    }
+    /* Separate address range from the setup above, so both coexist. */
+    for (uint32_t i = 0; i < pages; ++i) {
+      char* base = (char*)((uintptr_t)0x0000710000000000ULL +
+                           (uintptr_t)i * HZ10_PAGE_QUANTUM);
+      if (hz10_pagemap_register(base, slot_size,
+                                HZ10_PAGE_QUANTUM / slot_size) == 0u) {
+        fprintf(stderr, "setup: register failed at page %u\n", i);
+        free(qaddrs);
+        return 1;
+      }
+      uint32_t slot = 1u + (i % ((HZ10_PAGE_QUANTUM / slot_size) - 2u));
+      qaddrs[2u * i] = base + (size_t)slot * slot_size;
+      qaddrs[2u * i + 1u] = base + (size_t)slot * slot_size + HZ10_MIN_ALIGN;
+    }
+    for (uint32_t run = 1; run <= runs && !failed; ++run) {
+      failed |= hz10_bench_interior_run("local_modulo",
+                                        HZ10_BENCH_INTERIOR_MODULO, iters,
+                                        queries, qaddrs, run, runs, threads);
+      if (!failed) {
+        failed |= hz10_bench_interior_run("local_skip_check",
+                                          HZ10_BENCH_INTERIOR_SKIP, iters,
+                                          queries, qaddrs, run, runs,
+                                          threads);
+      }
+      if (!failed) {
+        failed |= hz10_bench_interior_run("local_recip",
+                                          HZ10_BENCH_INTERIOR_RECIP, iters,
+                                          queries, qaddrs, run, runs,
+                                          threads);
+      }
+    }
+    free(qaddrs);
+  }
+  for (uint32_t run = 1; run <= runs && !failed && mode != 3u; ++run) {
     if (mode == 0u || mode == 2u) {
       failed |= hz10_bench_run("hz10_pagemap", 1, iters, pages, addrs, gens,
                               run, runs, threads);
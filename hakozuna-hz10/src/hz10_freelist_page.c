@@ -7,7 +7,7 @@
 #if !defined(_WIN32)
 /*
  * How many quanta to reserve in one go (see hz10_freelist_reserve_aligned_
- * quantum() below). Real, measured motivation, not a guess: strace on the
+ * quanta() below). Real, measured motivation, not a guess: strace on the
  * slot_count=1/REMOTE_PCT=90 isolating case (current_task.md) showed
  * ~152K mmap + ~152K munmap over 8M ops -- roughly one genuine miss (a
  * class with nothing to reuse, needing a truly fresh quantum) per 53
@@ -114,9 +114,15 @@ static void hz10_metadata_page_free(Hz10FreelistPage* page) {
  * on a sub-range of a larger mapping is valid POSIX munmap usage, and the
  * bump cursor only ever moves forward, so nothing is ever handed out twice)
  * -- this only changes how a *fresh* quantum is obtained, not how one is
- * given back. */
-static void* hz10_freelist_reserve_aligned_quantum(void) {
-  size_t bytes = HZ10_PAGE_QUANTUM;
+ * given back.
+ *
+ * HZ10MultiQuantumPage-L1: a multi-quantum page takes `quanta` contiguous
+ * quanta from the same region in one bump. If the region has fewer than
+ * that left, the remainder (at most HZ10_PAGE_MAX_QUANTA - 1 quanta) is
+ * abandoned at refill: it was never handed out, so never touched, so it
+ * costs address space only, not RSS. */
+static void* hz10_freelist_reserve_aligned_quanta(uint32_t quanta) {
+  size_t bytes = (size_t)HZ10_PAGE_QUANTUM * (size_t)quanta;
 #if defined(_WIN32)
   /* VirtualAlloc returns allocation-granularity aligned regions already,
    * and Windows cannot MEM_RELEASE arbitrary sub-ranges of a larger
@@ -132,12 +138,12 @@ static void* hz10_freelist_reserve_aligned_quantum(void) {
     /* A failed CAS already writes the current cursor value into `cursor`
      * for us, so retry directly against it instead of paying a fresh
      * atomic load -- `end` stays valid to compare against across those
-     * retries too: cursor can only ever reach `end` exactly (never
-     * overshoot it, since HZ10_PAGE_QUANTUM evenly divides the region),
-     * so a concurrent refill can only be in progress once cursor == end,
-     * which this loop's own condition already detects and falls through
-     * to the mutex-guarded refill path below for. */
-    while (cursor != end) {
+     * retries too: cursor can never overshoot `end` (every bump is checked
+     * against the room left), so a concurrent refill can only be in
+     * progress once less than `bytes` is left, which this loop's own
+     * condition already detects and falls through to the mutex-guarded
+     * refill path below for. */
+    while ((size_t)(end - cursor) >= bytes) {
       char* next = cursor + bytes;
       if (atomic_compare_exchange_weak_explicit(
               &hz10_quantum_region_cursor, &cursor, next,
@@ -154,9 +160,10 @@ static void* hz10_freelist_reserve_aligned_quantum(void) {
     cursor =
         atomic_load_explicit(&hz10_quantum_region_cursor, memory_order_acquire);
     end = atomic_load_explicit(&hz10_quantum_region_end, memory_order_acquire);
-    if (cursor == end) {
-      size_t region_bytes = bytes * (size_t)HZ10_QUANTUM_REGION_COUNT;
-      size_t raw_bytes = region_bytes + bytes;
+    if ((size_t)(end - cursor) < bytes) {
+      size_t quantum = HZ10_PAGE_QUANTUM;
+      size_t region_bytes = quantum * (size_t)HZ10_QUANTUM_REGION_COUNT;
+      size_t raw_bytes = region_bytes + quantum;
       void* raw = hz10_platform_reserve_rw(raw_bytes);
       if (!raw) {
         hz10_platform_mutex_unlock(&hz10_quantum_region_lock);
@@ -164,7 +171,7 @@ static void* hz10_freelist_reserve_aligned_quantum(void) {
       }
       uintptr_t raw_addr = (uintptr_t)raw;
       uintptr_t aligned_addr =
-          (raw_addr + (bytes - 1u)) & ~(uintptr_t)(bytes - 1u);
+          (raw_addr + (quantum - 1u)) & ~(uintptr_t)(quantum - 1u);
       size_t head_trim = (size_t)(aligned_addr - raw_addr);
       size_t tail_trim = raw_bytes - head_trim - region_bytes;
       if (head_trim > 0u) {
@@ -229,14 +236,16 @@ static Hz10FreelistPage* hz10_freelist_page_create_common(void* base,
   if (slot_size < sizeof(void*) || slot_count == 0u) {
     return NULL;
   }
-  uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
-  if (span > (uint64_t)HZ10_PAGE_QUANTUM) {
+  uint32_t quanta = hz10_freelist_page_quanta_for(slot_size, slot_count);
+  if (quanta > HZ10_PAGE_MAX_QUANTA || (base && quanta != 1u) ||
+      slot_count > HZ10_METADATA_PENDING_WORDS * 64u) {
     return NULL;
   }
+  size_t payload_bytes = (size_t)quanta * (size_t)HZ10_PAGE_QUANTUM;
 
   int owns_base = 0;
   if (!base) {
-    base = hz10_freelist_reserve_aligned_quantum();
+    base = hz10_freelist_reserve_aligned_quanta(quanta);
     if (!base) {
       return NULL;
     }
@@ -246,7 +255,7 @@ static Hz10FreelistPage* hz10_freelist_page_create_common(void* base,
   Hz10FreelistPage* page = hz10_metadata_page_alloc();
   if (!page) {
     if (owns_base) {
-      hz10_platform_release(base, HZ10_PAGE_QUANTUM);
+      hz10_platform_release(base, payload_bytes);
     }
     return NULL;
   }
@@ -270,7 +279,7 @@ static Hz10FreelistPage* hz10_freelist_page_create_common(void* base,
   if (generation == 0u) {
     hz10_metadata_page_free(page);
     if (owns_base) {
-      hz10_platform_release(base, HZ10_PAGE_QUANTUM);
+      hz10_platform_release(base, payload_bytes);
     }
     return NULL;
   }
@@ -319,10 +328,12 @@ void* hz10_freelist_page_destroy_reclaim_base(Hz10FreelistPage* page) {
 }
 
 void hz10_freelist_page_destroy(Hz10FreelistPage* page) {
-  void* base = hz10_freelist_page_destroy_reclaim_base(page);
-  if (base) {
-    hz10_platform_release(base, HZ10_PAGE_QUANTUM);
+  if (!page) {
+    return;
   }
+  size_t payload_bytes = hz10_freelist_page_payload_bytes(page);
+  void* base = hz10_freelist_page_destroy_reclaim_base(page);
+  hz10_platform_release(base, payload_bytes);
 }
 
 void hz10_freelist_metadata_stats(Hz10FreelistMetadataStats* stats_out) {
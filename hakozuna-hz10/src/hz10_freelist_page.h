@@ -5,6 +5,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "hz10_pagemap.h"
+
 #ifndef HZ10_ENABLE_STRIPE_SPREAD
 #define HZ10_ENABLE_STRIPE_SPREAD 1
 #endif
@@ -233,12 +235,34 @@ typedef struct Hz10FreelistPage {
   uint32_t retired_ready_generation;
 } Hz10FreelistPage;
 
+/*
+ * HZ10MultiQuantumPage-L1: a page's payload is slot_size * slot_count
+ * rounded up to whole quanta. Every page before this lane was exactly one
+ * quantum; a page covering 2..HZ10_PAGE_MAX_QUANTA quanta still has one
+ * Hz10FreelistPage header, and Box 1 copies its record into each covered
+ * quantum's leaf entry. Derived, not stored, so the struct layout above is
+ * unchanged.
+ */
+static inline uint32_t hz10_freelist_page_quanta_for(uint32_t slot_size,
+                                                     uint32_t slot_count) {
+  uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
+  return (uint32_t)((span + HZ10_PAGE_QUANTUM - 1u) / HZ10_PAGE_QUANTUM);
+}
+
+static inline size_t hz10_freelist_page_payload_bytes(
+    const Hz10FreelistPage* page) {
+  return (size_t)hz10_freelist_page_quanta_for(page->slot_size,
+                                               page->slot_count) *
+         (size_t)HZ10_PAGE_QUANTUM;
+}
+
 /*
  * Creates a page of slot_count slots of slot_size bytes each. Requires
  * slot_size >= sizeof(void*) (the freelist needs room for the intrusive
- * next-pointer) and slot_size * slot_count <= HZ10_PAGE_QUANTUM (Box 1's
- * single-quantum registration limit). Returns NULL on any failure (bad
- * arguments, mmap failure, or pagemap registration failure).
+ * next-pointer) and slot_size * slot_count <= HZ10_PAGE_MAX_QUANTA *
+ * HZ10_PAGE_QUANTUM (Box 1's multi-slot registration limit). Returns NULL
+ * on any failure (bad arguments, mmap failure, or pagemap registration
+ * failure).
  */
 Hz10FreelistPage* hz10_freelist_page_create(uint32_t slot_size,
                                             uint32_t slot_count);
@@ -289,8 +313,10 @@ static inline _Atomic(void*)* hz10_freelist_page_remote_head(
 
 /* Same as hz10_freelist_page_create(), but if base is non-NULL, uses that
  * (already HZ10_PAGE_QUANTUM-aligned, HZ10_PAGE_QUANTUM-sized) block
- * instead of reserving a fresh mapping. base == NULL behaves identically
- * to hz10_freelist_page_create(). */
+ * instead of reserving a fresh mapping. A caller-supplied base is only
+ * ever one quantum, so a non-NULL base with a multi-quantum shape is
+ * rejected. base == NULL behaves identically to
+ * hz10_freelist_page_create(). */
 Hz10FreelistPage* hz10_freelist_page_create_with_base(void* base,
                                                       uint32_t slot_size,
                                                       uint32_t slot_count);
@@ -306,8 +332,9 @@ Hz10FreelistPage* hz10_freelist_page_create_with_base_and_owner(
 
 /* Same as hz10_freelist_page_destroy(), but returns the underlying base
  * pointer to the caller instead of unmapping it (NULL if page was NULL).
- * The caller now owns that HZ10_PAGE_QUANTUM block and must either reuse
- * it or release it (hz10_platform_release(base, HZ10_PAGE_QUANTUM)). */
+ * The caller now owns that block -- hz10_freelist_page_payload_bytes(page)
+ * bytes, read before this call -- and must either reuse it or release it
+ * (hz10_platform_release(base, bytes)). */
 void* hz10_freelist_page_destroy_reclaim_base(Hz10FreelistPage* page);
 
 typedef struct Hz10FreelistMetadataStats {
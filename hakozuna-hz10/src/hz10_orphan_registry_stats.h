@@ -10,6 +10,7 @@ typedef struct Hz10OrphanRegistryPurgeStats {
   uint64_t pages_busy;
   uint64_t pages_skipped_live_owner;
   uint64_t slots_merged;
+  uint64_t pages_skipped_young; /* trim only: orphaned_at_ns < min age */
 } Hz10OrphanRegistryPurgeStats;
 
 #endif
@@ -9,6 +9,7 @@ typedef struct Hz10PagePoolNode {
   struct Hz10PagePoolNode* next;
   uint64_t released_at_ns; /* hz10_platform_now_ns() at release() time, for
                             * hz10_page_pool_purge_idle()'s aging sweep */
+  uint32_t decommitted;    /* set by hz10_page_pool_decommit_idle() */
 } Hz10PagePoolNode;
 
 static hz10_platform_mutex_t hz10_pool_lock = HZ10_PLATFORM_MUTEX_INIT;
@@ -22,6 +23,7 @@ static uint32_t hz10_pool_cap = HZ10_PAGE_POOL_DEFAULT_CAP;
 static uint64_t hz10_pool_reuse_count;
 static uint64_t hz10_pool_release_count;
 static uint64_t hz10_pool_purged_count;
+static uint64_t hz10_pool_decommitted_count;
 
 void* hz10_page_pool_try_acquire(void) {
   /* Real, measured motivation (current_task.md): a perf stat + strace pass
@@ -58,6 +60,7 @@ int hz10_page_pool_release(void* base) {
     Hz10PagePoolNode* node = (Hz10PagePoolNode*)base;
     node->next = hz10_pool_head;
     node->released_at_ns = hz10_platform_now_ns();
+    node->decommitted = 0u;
     hz10_pool_head = node;
     hz10_pool_count += 1u;
   } else {
@@ -128,6 +131,27 @@ uint32_t hz10_page_pool_purge_idle(uint64_t max_idle_ns) {
   return purged;
 }
 
+uint32_t hz10_page_pool_decommit_idle(uint64_t min_idle_ns) {
+  uint32_t decommitted = 0u;
+  hz10_platform_mutex_lock(&hz10_pool_lock);
+  uint64_t now = hz10_platform_now_ns();
+  for (Hz10PagePoolNode* node =
+           atomic_load_explicit(&hz10_pool_head, memory_order_relaxed);
+       node; node = node->next) {
+    if (node->decommitted || now - node->released_at_ns < min_idle_ns) {
+      continue;
+    }
+    (void)hz10_platform_purge(
+        (char*)node + HZ10_PAGE_POOL_DECOMMIT_KEEP_BYTES,
+        HZ10_PAGE_QUANTUM - HZ10_PAGE_POOL_DECOMMIT_KEEP_BYTES);
+    node->decommitted = 1u;
+    decommitted += 1u;
+  }
+  hz10_pool_decommitted_count += decommitted;
+  hz10_platform_mutex_unlock(&hz10_pool_lock);
+  return decommitted;
+}
+
 uint32_t hz10_page_pool_set_cap(uint32_t cap) {
   hz10_platform_mutex_lock(&hz10_pool_lock);
   uint32_t previous = hz10_pool_cap;
@@ -164,6 +188,25 @@ uint64_t hz10_page_pool_purged_count(void) {
   return count;
 }
 
+uint64_t hz10_page_pool_decommitted_count(void) {
+  hz10_platform_mutex_lock(&hz10_pool_lock);
+  uint64_t count = hz10_pool_decommitted_count;
+  hz10_platform_mutex_unlock(&hz10_pool_lock);
+  return count;
+}
+
+void hz10_page_pool_atfork_prepare(void) {
+  hz10_platform_mutex_lock(&hz10_pool_lock);
+}
+
+void hz10_page_pool_atfork_parent(void) {
+  hz10_platform_mutex_unlock(&hz10_pool_lock);
+}
+
+void hz10_page_pool_atfork_child(void) {
+  hz10_platform_mutex_unlock(&hz10_pool_lock);
+}
+
 void hz10_page_pool_reset_for_tests(void) {
   hz10_platform_mutex_lock(&hz10_pool_lock);
   Hz10PagePoolNode* node = hz10_pool_head;
@@ -173,6 +216,7 @@ void hz10_page_pool_reset_for_tests(void) {
   hz10_pool_reuse_count = 0u;
   hz10_pool_release_count = 0u;
   hz10_pool_purged_count = 0u;
+  hz10_pool_decommitted_count = 0u;
   hz10_platform_mutex_unlock(&hz10_pool_lock);
   while (node) {
     Hz10PagePoolNode* next = node->next;
@@ -34,10 +34,11 @@ void* hz10_page_pool_try_acquire(void);
  * returns/decommits pages" line: cached blocks under the cap still sit
  * resident forever with no expiry, which is fine for a cap of 64 blocks
  * (4MiB) but would not be for a much larger cap or a workload with long
- * idle stretches between bursts. HZ10 has no background-thread/timer
- * infrastructure (see current_task.md), so this is deliberately an
- * explicit, caller-invoked sweep -- like glibc's malloc_trim() -- rather
- * than an automatic one: hz10_page_pool_purge_idle(max_idle_ns) walks the
+ * idle stretches between bursts. The allocator core has no timer of its
+ * own (see current_task.md), so this is deliberately an explicit,
+ * caller-invoked sweep -- like glibc's malloc_trim() -- rather than an
+ * automatic one (the LD_PRELOAD shim's opt-in maintenance thread,
+ * HZ10_SHIM_MAINT_MS, is one such caller): hz10_page_pool_purge_idle(max_idle_ns) walks the
  * cache (bounded by the cap, so this is cheap even if called often, not
  * an unbounded per-op cost) and really releases (hz10_platform_release)
  * any block that has been sitting idle longer than max_idle_ns, removing
@@ -45,6 +46,21 @@ void* hz10_page_pool_try_acquire(void);
  */
 uint32_t hz10_page_pool_purge_idle(uint64_t max_idle_ns);
 
+/*
+ * Softer first stage of the same aging policy, for callers (the shim's
+ * opt-in maintenance thread, HZ10_SHIM_MAINT_MS) that want idle RSS back
+ * without giving up the cached address range yet: every cached block that
+ * has been idle at least min_idle_ns and is not already decommitted gets
+ * hz10_platform_purge() on everything past its first
+ * HZ10_PAGE_POOL_DECOMMIT_KEEP_BYTES (the pool node header lives there).
+ * The block stays cached and is reused as-is by try_acquire() -- a purged
+ * range simply refaults as zero pages. Runs under the pool lock so a block
+ * can never be decommitted after a concurrent try_acquire() handed it out.
+ * Returns the number of blocks decommitted by this call.
+ */
+#define HZ10_PAGE_POOL_DECOMMIT_KEEP_BYTES 4096u
+uint32_t hz10_page_pool_decommit_idle(uint64_t min_idle_ns);
+
 /*
  * Offers base (a HZ10_PAGE_QUANTUM block the caller no longer needs) back
  * to the pool. If the pool is under its cap, base is cached and this
@@ -63,6 +79,13 @@ uint32_t hz10_page_pool_cached_count(void);
 uint64_t hz10_page_pool_reuse_count(void);   /* successful acquire-from-pool */
 uint64_t hz10_page_pool_release_count(void); /* real hz10_platform_release calls */
 uint64_t hz10_page_pool_purged_count(void);  /* real releases via purge_idle */
+uint64_t hz10_page_pool_decommitted_count(void); /* decommit_idle purges */
+
+/* LD_PRELOAD shim atfork hooks for the pool lock (the shim's maintenance
+ * thread may hold it at fork time). */
+void hz10_page_pool_atfork_prepare(void);
+void hz10_page_pool_atfork_parent(void);
+void hz10_page_pool_atfork_child(void);
 
 /* Test/bench only: releases every currently cached block for real and
  * resets all counters and the cap to HZ10_PAGE_POOL_DEFAULT_CAP. */
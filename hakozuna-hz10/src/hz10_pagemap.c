@@ -8,7 +8,7 @@ static hz10_platform_mutex_t hz10_pagemap_lock = HZ10_PLATFORM_MUTEX_INIT;
 
 /* Lazily mmap's the leaf backing this root slot. Demand-paging means only
  * the 4KiB pages actually touched by later register() calls ever cost RSS,
- * even though the leaf's virtual reservation is ~24MiB. */
+ * even though the leaf's virtual reservation is ~40MiB. */
 static H10Leaf* hz10_pagemap_ensure_leaf(uint32_t root_idx) {
   H10Leaf* leaf = hz10_pagemap_leaf_load(root_idx);
   if (leaf) {
@@ -28,12 +28,42 @@ static H10Leaf* hz10_pagemap_ensure_leaf(uint32_t root_idx) {
   return leaf;
 }
 
+/* hz10_pagemap_slot_recip()'s exactness bound: offsets inside a multi-slot
+ * page, in HZ10_MIN_ALIGN units, must fit in 14 bits so that 14 + log2 of
+ * the largest two-slot slot_size (17 bits) stays within the 32-bit
+ * reciprocal. */
+_Static_assert(((uint64_t)HZ10_PAGE_MAX_QUANTA * HZ10_PAGE_QUANTUM >>
+                HZ10_MIN_ALIGN_SHIFT) <= (UINT64_C(1) << 14),
+               "multi-slot span too large for the 32-bit slot reciprocal");
+
+static H10PageRecord* hz10_pagemap_record_at(uintptr_t addr, int ensure) {
+  uint32_t page_index = hz10_pagemap_page_index(addr);
+  uint32_t root_idx = hz10_pagemap_root_index(page_index);
+  uint32_t leaf_idx = hz10_pagemap_leaf_index(page_index);
+  H10Leaf* leaf = ensure ? hz10_pagemap_ensure_leaf(root_idx)
+                         : hz10_pagemap_leaf_load(root_idx);
+  return leaf ? &leaf->entries[leaf_idx] : NULL;
+}
+
+/* How many quanta a registration's leaf records cover. Single-slot
+ * registrations (large allocations) only ever register their base quantum,
+ * whatever their byte span; see the register() comment below. */
+static uint32_t hz10_pagemap_record_quanta(uint32_t slot_size,
+                                           uint32_t slot_count) {
+  if (slot_count <= 1u) {
+    return 1u;
+  }
+  uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
+  return (uint32_t)((span + HZ10_PAGE_QUANTUM - 1u) / HZ10_PAGE_QUANTUM);
+}
+
 uint32_t hz10_pagemap_register_with_owner_and_flags(void* base,
                                                     uint32_t slot_size,
                                                     uint32_t slot_count,
                                                     void* owner,
                                                     uint32_t flags) {
-  if (!base || slot_size == 0u || slot_count == 0u) {
+  if (!base || slot_size == 0u || slot_count == 0u ||
+      slot_count > UINT16_MAX || flags > UINT16_MAX) {
     return 0u;
   }
   uintptr_t addr = (uintptr_t)base;
@@ -41,49 +71,68 @@ uint32_t hz10_pagemap_register_with_owner_and_flags(void* base,
     return 0u;
   }
   uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
-  /* The "fits in one quantum" limit only has to hold for slot_count > 1:
-   * a multi-slot page addresses every slot by (offset / slot_size) against
-   * a single leaf record keyed by base's own quantum index, so every slot
-   * has to live inside that one quantum for the addressing model to reach
-   * it at all. A single-slot (slot_count == 1) registration has no such
+  /* The HZ10_PAGE_MAX_QUANTA limit only has to hold for slot_count > 1:
+   * a multi-slot page addresses every slot by (offset / slot_size) from
+   * whichever covered quantum the pointer lands in, so each of those quanta
+   * needs its own copy of the record (HZ10MultiQuantumPage-L1), and the
+   * copy loop is bounded. A single-slot (slot_count == 1) registration has no such
    * requirement -- there is only one slot, index 0, at offset 0 -- so it
    * may span any number of quanta. This is exactly the relaxation the
    * original design doc anticipated ("multi-quantum span registration is
    * a natural Box 2+ extension"): src/hz10_large_alloc.h is the first
    * caller that needs it, registering a direct-mmap allocation bigger than
    * one quantum as a single slot whose slot_size is the whole reservation. */
-  if (slot_count > 1u && span > (uint64_t)HZ10_PAGE_QUANTUM) {
+  if (slot_count > 1u &&
+      span > (uint64_t)HZ10_PAGE_MAX_QUANTA * (uint64_t)HZ10_PAGE_QUANTUM) {
     return 0u;
   }
 
-  uint32_t page_index = hz10_pagemap_page_index(addr);
-  uint32_t root_idx = hz10_pagemap_root_index(page_index);
-  uint32_t leaf_idx = hz10_pagemap_leaf_index(page_index);
-
-  H10Leaf* leaf = hz10_pagemap_ensure_leaf(root_idx);
-  if (!leaf) {
-    return 0u;
+  uint32_t quanta = hz10_pagemap_record_quanta(slot_size, slot_count);
+  H10PageRecord* recs[HZ10_PAGE_MAX_QUANTA];
+  for (uint32_t q = 0u; q < quanta; ++q) {
+    recs[q] = hz10_pagemap_record_at(addr + (uintptr_t)q * HZ10_PAGE_QUANTUM,
+                                     1);
+    if (!recs[q]) {
+      return 0u;
+    }
   }
 
-  H10PageRecord* rec = &leaf->entries[leaf_idx];
   hz10_platform_mutex_lock(&hz10_pagemap_lock);
-  void* old_base = __atomic_load_n(&rec->base, __ATOMIC_RELAXED);
-  uint32_t old_generation =
-      __atomic_load_n(&rec->generation, __ATOMIC_RELAXED);
-  uint32_t generation = (old_base == NULL && old_generation == 0u)
-                            ? 1u
-                            : old_generation + 1u;
-  __atomic_store_n(&rec->base, base, __ATOMIC_RELAXED);
-  __atomic_store_n(&rec->owner, owner, __ATOMIC_RELAXED);
-  __atomic_store_n(&rec->slot_count, slot_count, __ATOMIC_RELAXED);
-  __atomic_store_n(&rec->generation, generation, __ATOMIC_RELAXED);
-  __atomic_store_n(&rec->flags, flags, __ATOMIC_RELAXED);
-  /* slot_size is written last: route() treats slot_size==0 as "absent" and
-   * reads these fields without the lock, so publishing slot_size last keeps
-   * a concurrent lock-free reader from ever seeing a half-written record as
-   * present (this does not make route() fully race-free, see header notes,
-   * but avoids the cheapest way to observe torn state). */
-  __atomic_store_n(&rec->slot_size, slot_size, __ATOMIC_RELEASE);
+  uint32_t max_generation = 0u;
+  int seen = 0;
+  for (uint32_t q = 0u; q < quanta; ++q) {
+    void* old_base = __atomic_load_n(&recs[q]->base, __ATOMIC_RELAXED);
+    uint32_t old_generation =
+        __atomic_load_n(&recs[q]->generation, __ATOMIC_RELAXED);
+    if (old_base != NULL || old_generation != 0u) {
+      seen = 1;
+      if (old_generation > max_generation) {
+        max_generation = old_generation;
+      }
+    }
+  }
+  uint32_t generation = seen ? max_generation + 1u : 1u;
+  uint32_t slot_recip =
+      slot_count > 1u ? hz10_pagemap_slot_recip(slot_size) : 0u;
+  /* Tail quanta first, base quantum last: a concurrent route() through the
+   * base quantum is the one every owner/free path uses, so it is the last
+   * to turn present. */
+  for (uint32_t q = quanta; q > 0u; --q) {
+    H10PageRecord* rec = recs[q - 1u];
+    __atomic_store_n(&rec->base, base, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->owner, owner, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->slot_count, (uint16_t)slot_count,
+                     __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->generation, generation, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->flags, (uint16_t)flags, __ATOMIC_RELAXED);
+    __atomic_store_n(&rec->slot_recip, slot_recip, __ATOMIC_RELAXED);
+    /* slot_size is written last: route() treats slot_size==0 as "absent"
+     * and reads these fields without the lock, so publishing slot_size last
+     * keeps a concurrent lock-free reader from ever seeing a half-written
+     * record as present (this does not make route() fully race-free, see
+     * header notes, but avoids the cheapest way to observe torn state). */
+    __atomic_store_n(&rec->slot_size, slot_size, __ATOMIC_RELEASE);
+  }
   hz10_platform_mutex_unlock(&hz10_pagemap_lock);
   return generation;
 }
@@ -107,25 +156,31 @@ int hz10_pagemap_release(void* base) {
   if ((addr & (HZ10_PAGE_QUANTUM - 1u)) != 0u) {
     return 0;
   }
-  uint32_t page_index = hz10_pagemap_page_index(addr);
-  uint32_t root_idx = hz10_pagemap_root_index(page_index);
-  uint32_t leaf_idx = hz10_pagemap_leaf_index(page_index);
-
-  H10Leaf* leaf = hz10_pagemap_leaf_load(root_idx);
-  if (!leaf) {
+  H10PageRecord* rec = hz10_pagemap_record_at(addr, 0);
+  if (!rec) {
     return 0;
   }
 
-  H10PageRecord* rec = &leaf->entries[leaf_idx];
   hz10_platform_mutex_lock(&hz10_pagemap_lock);
   int released = 0;
   void* rec_base = __atomic_load_n(&rec->base, __ATOMIC_RELAXED);
   uint32_t slot_size = __atomic_load_n(&rec->slot_size, __ATOMIC_ACQUIRE);
   if (rec_base == base && slot_size != 0u) {
+    uint32_t quanta = hz10_pagemap_record_quanta(
+        slot_size, __atomic_load_n(&rec->slot_count, __ATOMIC_RELAXED));
     /* generation and base survive on purpose: a later register() at this
      * same address must be able to bump generation further, and a stale
-     * route() against the pre-release generation must keep failing. */
-    __atomic_store_n(&rec->slot_size, 0u, __ATOMIC_RELEASE);
+     * route() against the pre-release generation must keep failing. Base
+     * quantum first, mirroring register()'s publish order. */
+    for (uint32_t q = 0u; q < quanta; ++q) {
+      H10PageRecord* cover =
+          q == 0u ? rec
+                  : hz10_pagemap_record_at(
+                        addr + (uintptr_t)q * HZ10_PAGE_QUANTUM, 0);
+      if (cover && __atomic_load_n(&cover->base, __ATOMIC_RELAXED) == base) {
+        __atomic_store_n(&cover->slot_size, 0u, __ATOMIC_RELEASE);
+      }
+    }
     released = 1;
   }
   hz10_platform_mutex_unlock(&hz10_pagemap_lock);
@@ -13,9 +13,12 @@
  * does address arithmetic against metadata this module owns, so callers
  * may register/query synthetic addresses that were never mmap'd.
  *
- * L0 scope: multi-slot registrations must still fit in one quantum
- * (slot_size * slot_count <= HZ10_PAGE_QUANTUM); a single-slot
- * (slot_count == 1) registration may span more quanta than that -- see
+ * Multi-slot registrations may span up to HZ10_PAGE_MAX_QUANTA contiguous
+ * quanta (HZ10MultiQuantumPage-L1): the same record (same base) is written
+ * into every covered quantum's leaf entry, so route() stays a single
+ * leaf load and keeps computing offsets relative to the page's first
+ * quantum. A single-slot (slot_count == 1) registration may span more
+ * quanta than that, but only its base quantum is registered -- see
  * hz10_pagemap_register_with_owner_and_flags() and src/hz10_large_alloc.h.
  * No allocator malloc/free behavior lives here.
  */
@@ -23,6 +26,10 @@
 #define HZ10_PAGE_SHIFT 16u
 #define HZ10_PAGE_QUANTUM (1u << HZ10_PAGE_SHIFT)
 #define HZ10_MIN_ALIGN 16u
+#define HZ10_MIN_ALIGN_SHIFT 4u
+/* Upper bound on how many contiguous quanta one multi-slot page may cover.
+ * Small enough that register/release's per-quantum loop stays trivial. */
+#define HZ10_PAGE_MAX_QUANTA 4u
 #define HZ10_GENERATION_ANY 0u
 
 #define HZ10_ROOT_BITS 11u
@@ -32,10 +39,12 @@
 #define HZ10_ROOT_MASK (HZ10_ROOT_SIZE - 1u)
 #define HZ10_LEAF_MASK (HZ10_LEAF_SIZE - 1u)
 
-/* Diagnostic only: skips the local-fast interior slot alignment modulo check.
+/* Diagnostic only: skips the local-fast interior slot alignment check.
  * This weakens fail-closed pointer validation and must never be enabled in a
- * product/default lane. It exists to isolate the runtime division cost before
- * attempting another reciprocal-route implementation. */
+ * product/default lane. It exists to isolate the interior check's cost; the
+ * product lane now pays a multiply-compare on H10PageRecord.slot_recip
+ * instead of a runtime division (HZ10RouteRecip-L1,
+ * docs/HZ10_ROUTE_RECIP_L1.md). */
 #ifndef HZ10_DIAG_SKIP_LOCAL_INTERIOR_MOD_CHECK
 #define HZ10_DIAG_SKIP_LOCAL_INTERIOR_MOD_CHECK 0
 #endif
@@ -76,15 +85,24 @@ typedef struct H10RouteResult {
                    * see src/hz10_large_alloc.h) without a second lookup. */
 } H10RouteResult;
 
+/* slot_count and flags are stored as 16 bits so slot_recip fits in the
+ * 32-byte record; register() rejects wider values. A multi-slot page has at
+ * most 2^14 HZ10_MIN_ALIGN units (see hz10_pagemap.c), and single-slot
+ * registrations always have slot_count == 1. */
 typedef struct H10PageRecord {
   void* base;
   void* owner;
   uint32_t slot_size;
-  uint32_t slot_count;
+  uint16_t slot_count;
+  uint16_t flags;
   uint32_t generation;
-  uint32_t flags;
+  uint32_t slot_recip; /* hz10_pagemap_slot_recip(slot_size), multi-slot
+                        * registrations only (0 for single-slot) */
 } H10PageRecord;
 
+_Static_assert(sizeof(H10PageRecord) == 32,
+               "H10PageRecord must stay 32 bytes (two records per line)");
+
 typedef struct H10Leaf {
   H10PageRecord entries[HZ10_LEAF_SIZE];
 } H10Leaf;
@@ -110,8 +128,10 @@ typedef struct H10RouteLocalResult {
 /*
  * Registers `base` (must be HZ10_PAGE_QUANTUM-aligned) as a page holding
  * slot_count slots of slot_size bytes each. If slot_count > 1, slot_size *
- * slot_count must fit in one HZ10_PAGE_QUANTUM (every slot has to be
- * addressable through this one registration's single leaf entry). A
+ * slot_count must fit in HZ10_PAGE_MAX_QUANTA quanta; every covered
+ * quantum gets its own copy of the record, all carrying the same base and
+ * the same generation (one past the highest generation any of those
+ * quanta has seen, so a stale route through any of them keeps failing). A
  * single-slot registration (slot_count == 1) has no such limit and may
  * span any number of quanta -- see src/hz10_large_alloc.h, the first
  * caller that needs a span bigger than one quantum. Returns the new
@@ -141,7 +161,9 @@ uint32_t hz10_pagemap_register_with_owner(void* base, uint32_t slot_size,
  * flags word (e.g. a "kind of registration" tag) that hz10_pagemap_route()
  * later returns verbatim in H10RouteResult.flags. Box 1 never interprets
  * flags, same rule as owner. hz10_pagemap_register_with_owner() is a thin
- * wrapper for flags == 0, kept so existing callers need no change.
+ * wrapper for flags == 0, kept so existing callers need no change. flags
+ * and slot_count must each fit in 16 bits (H10PageRecord); wider values
+ * are rejected with 0.
  */
 uint32_t hz10_pagemap_register_with_owner_and_flags(void* base,
                                                     uint32_t slot_size,
@@ -150,7 +172,8 @@ uint32_t hz10_pagemap_register_with_owner_and_flags(void* base,
                                                     uint32_t flags);
 
 /*
- * Marks `base` as no longer holding a live page. The generation counter is
+ * Marks `base` as no longer holding a live page (every quantum a multi-slot
+ * registration covered, see register() above). The generation counter is
  * preserved (not reset) so a later register() at the same address can bump
  * it further; a stale route() against the pre-release generation must keep
  * failing even before any re-registration happens.
@@ -165,6 +188,37 @@ int hz10_pagemap_release(void* base);
  */
 H10RouteResult hz10_pagemap_route(const void* ptr, uint32_t expected_generation);
 
+/*
+ * HZ10RouteRecip-L1: division-free "is offset a whole number of slots"
+ * check for multi-slot pages (Lemire/Kaser/Kurz divisibility by a
+ * precomputed reciprocal). Callers have already rejected offsets that are
+ * not HZ10_MIN_ALIGN-aligned, so with n = offset >> HZ10_MIN_ALIGN_SHIFT:
+ *
+ *   offset % slot_size == 0  <=>  n % d == 0,  d = slot_size / gcd(slot_size, 16)
+ *   n % d == 0               <=>  (uint32_t)(n * c) <= c - 1,  c = ceil(2^32 / d)
+ *
+ * The second step is exact for every n < 2^N when 32 >= N + log2(d). A
+ * multi-slot page spans at most HZ10_PAGE_MAX_QUANTA quanta (n < 2^14) and
+ * has at least two slots (d <= 2^17), so 14 + 17 <= 32 holds for every page
+ * register() accepts, not just the current class tables. d == 1 wraps c to
+ * 0, which the "c - 1" form turns into "always divisible" -- correct, since
+ * every aligned offset is then a slot boundary.
+ */
+static inline uint32_t hz10_pagemap_slot_recip(uint32_t slot_size) {
+  uint32_t align_bits = (uint32_t)__builtin_ctz(slot_size);
+  if (align_bits > HZ10_MIN_ALIGN_SHIFT) {
+    align_bits = HZ10_MIN_ALIGN_SHIFT;
+  }
+  uint32_t d = slot_size >> align_bits;
+  return UINT32_MAX / d + 1u;
+}
+
+static inline int hz10_pagemap_recip_divides(uint64_t offset,
+                                             uint32_t slot_recip) {
+  uint32_t n = (uint32_t)(offset >> HZ10_MIN_ALIGN_SHIFT);
+  return (uint32_t)(n * slot_recip) <= slot_recip - 1u;
+}
+
 static inline uint32_t hz10_pagemap_page_index(uintptr_t addr) {
   return (uint32_t)(addr >> HZ10_PAGE_SHIFT);
 }
@@ -212,6 +266,7 @@ static inline int hz10_pagemap_route_local_fast(
   if (flags != 0u) {
     return 0;
   }
+  uint32_t slot_recip = __atomic_load_n(&rec->slot_recip, __ATOMIC_RELAXED);
 
   uint64_t span = (uint64_t)slot_size * (uint64_t)slot_count;
   uint64_t offset = (uint64_t)(addr - (uintptr_t)base);
@@ -226,7 +281,7 @@ static inline int hz10_pagemap_route_local_fast(
       return 0;
     }
   } else if (!HZ10_DIAG_SKIP_LOCAL_INTERIOR_MOD_CHECK &&
-             (offset % slot_size) != 0u) {
+             !hz10_pagemap_recip_divides(offset, slot_recip)) {
     return 0;
   }
 
@@ -1,9 +1,19 @@
 #include "hz10_pooled_page.h"
 #include "hz10_page_pool.h"
+#include "hz10_platform.h"
+
+/* The pool only caches single-quantum blocks; see hz10_pooled_page.h. */
+static inline void* hz10_pooled_page_try_acquire_base(uint32_t slot_size,
+                                                      uint32_t slot_count) {
+  if (hz10_freelist_page_quanta_for(slot_size, slot_count) != 1u) {
+    return NULL;
+  }
+  return hz10_page_pool_try_acquire();
+}
 
 Hz10FreelistPage* hz10_pooled_page_create(uint32_t slot_size,
                                           uint32_t slot_count) {
-  void* base = hz10_page_pool_try_acquire();
+  void* base = hz10_pooled_page_try_acquire_base(slot_size, slot_count);
   Hz10FreelistPage* page =
       hz10_freelist_page_create_with_base(base, slot_size, slot_count);
   if (!page && base) {
@@ -16,7 +26,7 @@ Hz10FreelistPage* hz10_pooled_page_create(uint32_t slot_size,
 
 Hz10FreelistPage* hz10_pooled_page_create_with_owner(uint32_t slot_size,
                                                      uint32_t slot_count) {
-  void* base = hz10_page_pool_try_acquire();
+  void* base = hz10_pooled_page_try_acquire_base(slot_size, slot_count);
   Hz10FreelistPage* page = hz10_freelist_page_create_with_base_and_owner(
       base, slot_size, slot_count);
   if (!page && base) {
@@ -26,8 +36,14 @@ Hz10FreelistPage* hz10_pooled_page_create_with_owner(uint32_t slot_size,
 }
 
 void hz10_pooled_page_destroy(Hz10FreelistPage* page) {
+  if (!page) {
+    return;
+  }
+  size_t payload_bytes = hz10_freelist_page_payload_bytes(page);
   void* base = hz10_freelist_page_destroy_reclaim_base(page);
-  if (base) {
-    hz10_page_pool_release(base);
+  if (payload_bytes != (size_t)HZ10_PAGE_QUANTUM) {
+    hz10_platform_release(base, payload_bytes);
+    return;
   }
+  hz10_page_pool_release(base);
 }
@@ -12,7 +12,9 @@
  * pool-agnostic (hz10_freelist_page_create_with_base/
  * destroy_reclaim_base don't know where a base comes from or where it
  * goes), and hz10_page_pool stays page-shape-agnostic (it only ever sees
- * raw HZ10_PAGE_QUANTUM blocks).
+ * raw HZ10_PAGE_QUANTUM blocks). Multi-quantum pages
+ * (HZ10MultiQuantumPage-L1) bypass the pool in both directions: they are
+ * reserved fresh and released straight back to the platform.
  */
 
 /*
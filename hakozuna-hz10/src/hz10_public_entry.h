@@ -260,4 +260,25 @@ void hz10_public_entry_flush_thread_cache_quiescent(
 void hz10_public_entry_purge_orphan_registry_quiescent(
     Hz10OrphanRegistryPurgeStats* stats_out);
 
+/*
+ * HZ10OrphanRegistryTrim-L1 (docs/HZ10_ORPHAN_REGISTRY_TRIM_POLICY_DESIGN_L0.md
+ * R1-R3): bounded, NON-quiescent sibling of the purge above, for the shim's
+ * opt-in maintenance thread (HZ10_SHIM_MAINT_MS). Walks each class list from
+ * the cold (tail) end under the registry lock, examining at most `budget`
+ * pages in total, and destroys only pages that (a) belong to an EXITED
+ * owner, (b) have sat in the registry for at least min_age_ns, and (c) are
+ * fully idle after a remote drain under the temporary owner token.
+ *
+ * Safe without a global quiescent boundary because the registry lock makes
+ * this the exclusive holder of every page it inspects (adoption pops under
+ * the same lock), and because free_count == slot_count cannot be observed
+ * while any remote free is between claim() and publish()
+ * (src/hz10_remote_stack.h) -- an idle page has no slot left for anyone to
+ * free. Pages that are busy, young or still owned are left registered as
+ * adoption candidates. stats_out may be NULL.
+ */
+void hz10_public_entry_trim_orphan_registry(
+    uint32_t budget, uint64_t min_age_ns,
+    Hz10OrphanRegistryPurgeStats* stats_out);
+
 #endif
@@ -548,3 +548,90 @@ void hz10_public_entry_purge_orphan_registry_quiescent(
     *stats_out = stats;
   }
 }
+
+void hz10_public_entry_trim_orphan_registry(
+    uint32_t budget, uint64_t min_age_ns,
+    Hz10OrphanRegistryPurgeStats* stats_out) {
+  Hz10OrphanRegistryPurgeStats stats = {0};
+  Hz10FreelistPage* destroy_head = NULL;
+#if HZ10_ENABLE_ORPHAN_ACTIVE_ADOPTION
+  uint64_t now_ns = hz10_platform_now_ns();
+  atomic_store_explicit(&hz10_orphan_drain_probe_owner.state,
+                        HZ10_THREAD_OWNER_STATE_LIVE, memory_order_release);
+  hz10_platform_mutex_lock(&hz10_orphan_lock);
+  for (uint32_t c = 0; c < HZ10_CLASS_COUNT && budget != 0u; ++c) {
+    /* Cold end first: adoption pops the head, so the tail holds the pages
+     * least likely to be asked for next. */
+    Hz10FreelistPage* page = hz10_orphan_active[c].tail;
+    while (page && budget != 0u) {
+      Hz10FreelistPage* prev = page->prev_in_owner_list;
+      budget -= 1u;
+      stats.pages_seen += 1u;
+      if (now_ns - page->orphaned_at_ns < min_age_ns) {
+        stats.pages_skipped_young += 1u;
+        page = prev;
+        continue;
+      }
+      Hz10OwnerRecord* old_owner =
+          (Hz10OwnerRecord*)hz10_freelist_page_owner_thread(page);
+      if (hz10_public_entry_owner_state(old_owner) !=
+          HZ10_THREAD_OWNER_STATE_EXITED) {
+        stats.pages_skipped_live_owner += 1u;
+        page = prev;
+        continue;
+      }
+
+      hz10_freelist_page_set_owner_thread(page,
+                                          &hz10_orphan_drain_probe_owner);
+      uint32_t merged = hz10_page_drain_remote(page);
+      stats.slots_merged += merged;
+      if (merged > 0u) {
+        stats.pages_drained += 1u;
+      }
+
+      if (page->free_count == page->slot_count) {
+        hz10_orphan_unlink_active_locked(c, page);
+        page->next_in_owner_list = destroy_head;
+        destroy_head = page;
+        stats.pages_reclaimed += 1u;
+      } else {
+        hz10_freelist_page_set_owner_thread(page, old_owner);
+        stats.pages_busy += 1u;
+      }
+      page = prev;
+    }
+  }
+  hz10_platform_mutex_unlock(&hz10_orphan_lock);
+#else
+  (void)budget;
+  (void)min_age_ns;
+#endif
+
+  while (destroy_head) {
+    Hz10FreelistPage* next = destroy_head->next_in_owner_list;
+    destroy_head->next_in_owner_list = NULL;
+    hz10_pooled_page_destroy(destroy_head);
+    destroy_head = next;
+  }
+  if (stats_out) {
+    *stats_out = stats;
+  }
+}
+
+void hz10_public_entry_owner_atfork_prepare(void) {
+#if HZ10_ENABLE_ORPHAN_ACTIVE_ADOPTION
+  hz10_platform_mutex_lock(&hz10_orphan_lock);
+#endif
+}
+
+void hz10_public_entry_owner_atfork_parent(void) {
+#if HZ10_ENABLE_ORPHAN_ACTIVE_ADOPTION
+  hz10_platform_mutex_unlock(&hz10_orphan_lock);
+#endif
+}
+
+void hz10_public_entry_owner_atfork_child(void) {
+#if HZ10_ENABLE_ORPHAN_ACTIVE_ADOPTION
+  hz10_platform_mutex_unlock(&hz10_orphan_lock);
+#endif
+}
@@ -107,6 +107,15 @@ void hz10_public_entry_orphan_registry_drain_probe_class_stats(
     uint32_t class_id, Hz10OrphanRegistryDrainProbeClassStats* out);
 void hz10_public_entry_purge_orphan_registry_quiescent(
     Hz10OrphanRegistryPurgeStats* stats_out);
+void hz10_public_entry_trim_orphan_registry(
+    uint32_t budget, uint64_t min_age_ns,
+    Hz10OrphanRegistryPurgeStats* stats_out);
 void hz10_public_entry_owner_exit_flush_front_cache(void);
 
+/* LD_PRELOAD shim atfork hooks for the orphan registry lock (held by thread
+ * exit publication and by the shim's maintenance-thread trim). */
+void hz10_public_entry_owner_atfork_prepare(void);
+void hz10_public_entry_owner_atfork_parent(void);
+void hz10_public_entry_owner_atfork_child(void);
+
 #endif
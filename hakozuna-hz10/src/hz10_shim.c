@@ -2,6 +2,7 @@
 #include "hz10_large_alloc.h"
 #include "hz10_page_pool.h"
 #include "hz10_pagemap.h"
+#include "hz10_platform.h"
 #include "hz10_public_entry.h"
 #include "hz10_public_entry_owner.h"
 #include "hz10_size_class.h"
@@ -14,6 +15,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #ifndef HZ10_ENABLE_SHIM_THREAD_EXIT_STATS
@@ -29,6 +31,10 @@ static int hz10_shim_thread_exit_stats;
 #endif
 static int hz10_shim_exit_stats_classes;
 static unsigned hz10_shim_census_sec;
+static unsigned hz10_shim_maint_ms;
+static unsigned hz10_shim_maint_idle_ms;
+static unsigned hz10_shim_maint_budget;
+static int hz10_shim_maint_started;
 #if HZ10_ENABLE_SHIM_THREAD_EXIT_STATS
 static pthread_once_t hz10_shim_thread_stats_once = PTHREAD_ONCE_INIT;
 static pthread_key_t hz10_shim_thread_stats_key;
@@ -37,14 +43,30 @@ static char hz10_shim_thread_stats_marker;
 #endif
 static _Thread_local int hz10_shim_in_stats_dump;
 
+typedef struct Hz10ShimMaintStats {
+  _Atomic(uint64_t) ticks;
+  _Atomic(uint64_t) busy_ns;
+  _Atomic(uint64_t) orphan_seen;
+  _Atomic(uint64_t) orphan_reclaimed;
+  _Atomic(uint64_t) orphan_busy;
+  _Atomic(uint64_t) orphan_young;
+  _Atomic(uint64_t) pool_decommitted;
+  _Atomic(uint64_t) pool_released;
+} Hz10ShimMaintStats;
+
+static Hz10ShimMaintStats hz10_shim_maint_stats;
+
 void hz10_shim_dump_orphan_registry_probe(void);
 void hz10_shim_dump_orphan_registry_drain_probe(void);
+static void hz10_shim_maint_start(void);
 
 static int hz10_shim_is_power_of_two(size_t value) {
   return value != 0u && (value & (value - 1u)) == 0u;
 }
 
 static void hz10_shim_atfork_prepare(void) {
+  hz10_public_entry_owner_atfork_prepare();
+  hz10_page_pool_atfork_prepare();
   hz10_pagemap_atfork_prepare();
   hz10_freelist_page_atfork_prepare();
 }
@@ -52,11 +74,19 @@ static void hz10_shim_atfork_prepare(void) {
 static void hz10_shim_atfork_parent(void) {
   hz10_freelist_page_atfork_parent();
   hz10_pagemap_atfork_parent();
+  hz10_page_pool_atfork_parent();
+  hz10_public_entry_owner_atfork_parent();
 }
 
 static void hz10_shim_atfork_child(void) {
   hz10_freelist_page_atfork_child();
   hz10_pagemap_atfork_child();
+  hz10_page_pool_atfork_child();
+  hz10_public_entry_owner_atfork_child();
+  /* Only the forking thread survives: the maintenance thread is gone, so
+   * start the child's own now that every shim lock is released. */
+  hz10_shim_maint_started = 0;
+  hz10_shim_maint_start();
 }
 
 static int hz10_shim_exit_stats_enabled(void) {
@@ -113,6 +143,35 @@ static unsigned hz10_shim_census_seconds(void) {
   return (unsigned)parsed;
 }
 
+/* HZ10ShimMaintThread-L1 (docs/HZ10_SHIM_MAINT_THREAD_L1.md), behavior
+ * knobs, all off unless HZ10_SHIM_MAINT_MS is set:
+ * - HZ10_SHIM_MAINT_MS=<1..60000> starts one detached maintenance thread
+ *   that wakes every N ms. Unset/0 means no thread at all.
+ * - HZ10_SHIM_MAINT_IDLE_MS=<0..3600000> (default 1000) is the age an
+ *   orphan-registry page or pool block must reach before it is trimmed or
+ *   decommitted; pool blocks are released outright at
+ *   HZ10_SHIM_MAINT_RELEASE_FACTOR times that age.
+ * - HZ10_SHIM_MAINT_BUDGET=<1..65536> (default 256) caps orphan-registry
+ *   pages examined per tick, which bounds the thread's CPU per period. */
+#define HZ10_SHIM_MAINT_RELEASE_FACTOR 4u
+
+static unsigned hz10_shim_env_unsigned(const char* name, unsigned fallback,
+                                       unsigned long max) {
+  const char* value = getenv(name);
+  if (!value || !value[0]) {
+    return fallback;
+  }
+  char* end = NULL;
+  unsigned long parsed = strtoul(value, &end, 10);
+  if (end == value || (end && *end != '\0')) {
+    return fallback;
+  }
+  if (parsed > max) {
+    parsed = max;
+  }
+  return (unsigned)parsed;
+}
+
 static void hz10_shim_write_all(const char* text, size_t len);
 
 static void hz10_shim_writef(const char* fmt, ...) {
@@ -147,6 +206,7 @@ void hz10_shim_dump_exit_stats(void) {
   uint64_t pool_purged = hz10_page_pool_purged_count();
 
   uint64_t active_pages = 0u;
+  uint64_t class_page_bytes = 0u;
   uint64_t retired_pages = 0u;
   uint64_t max_retired_pages = 0u;
   uint64_t eviction_count = 0u;
@@ -193,6 +253,9 @@ void hz10_shim_dump_exit_stats(void) {
     uint32_t slot_size = hz10_size_class_slot_size(c);
     uint32_t slot_count = hz10_size_class_slot_count(c);
     active_pages += stats.active_length;
+    class_page_bytes +=
+        (uint64_t)(stats.active_length + stats.retired_length) *
+        hz10_size_class_page_quanta(c) * HZ10_PAGE_QUANTUM;
     retired_pages += stats.retired_length;
     max_retired_pages += stats.max_retired_length;
     eviction_count += stats.eviction_count;
@@ -270,8 +333,7 @@ void hz10_shim_dump_exit_stats(void) {
       "reclaimed_sweep=%llu reclaimed_local_free=%llu\n",
       (unsigned long long)active_pages, (unsigned long long)retired_pages,
       (unsigned long long)max_retired_pages,
-      (unsigned long long)(active_pages + retired_pages) *
-          (unsigned long long)HZ10_PAGE_QUANTUM,
+      (unsigned long long)class_page_bytes,
       (unsigned long long)eviction_count, (unsigned long long)retired_count,
       (unsigned long long)ready_reclaimed,
       (unsigned long long)sweep_reclaimed,
@@ -288,6 +350,31 @@ void hz10_shim_dump_exit_stats(void) {
       (unsigned long long)orphan_reject_no_capacity,
       (unsigned long long)orphan_repush, (unsigned long long)orphan_depth,
       (unsigned long long)orphan_max_depth_sum);
+  if (hz10_shim_maint_ms != 0u) {
+    Hz10ShimMaintStats* maint = &hz10_shim_maint_stats;
+    hz10_shim_writef(
+        "hz10_shim_maint_stats period_ms=%u idle_ms=%u budget=%u "
+        "ticks=%llu busy_ns=%llu orphan_seen=%llu orphan_reclaimed=%llu "
+        "orphan_busy=%llu orphan_young=%llu pool_decommitted=%llu "
+        "pool_released=%llu\n",
+        hz10_shim_maint_ms, hz10_shim_maint_idle_ms, hz10_shim_maint_budget,
+        (unsigned long long)atomic_load_explicit(&maint->ticks,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->busy_ns,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->orphan_seen,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->orphan_reclaimed,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->orphan_busy,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->orphan_young,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->pool_decommitted,
+                                                 memory_order_relaxed),
+        (unsigned long long)atomic_load_explicit(&maint->pool_released,
+                                                 memory_order_relaxed));
+  }
   hz10_shim_in_stats_dump = 0;
 }
 
@@ -377,7 +464,7 @@ static void hz10_shim_census_add_page(Hz10ShimCensusTotals* totals,
   uint32_t live_slots = page->slot_count - free_count;
   uint32_t hidden_free = hz10_shim_census_popcount_pending(page);
   cell->pages += 1u;
-  cell->page_bytes += HZ10_PAGE_QUANTUM;
+  cell->page_bytes += hz10_freelist_page_payload_bytes(page);
   cell->slot_capacity += page->slot_count;
   cell->live_slots += live_slots;
   cell->free_slots += free_count;
@@ -502,6 +589,68 @@ static void* hz10_shim_census_thread(void* arg) {
   return NULL;
 }
 
+/* One maintenance pass. Only calls boxes that already own their locking
+ * (orphan registry lock, pool lock); it never touches a live owner's class
+ * lists, front cache or retired/ready stacks, so the malloc/free fast path
+ * neither sees nor pays for it. */
+static void hz10_shim_maint_tick(void) {
+  Hz10ShimMaintStats* maint = &hz10_shim_maint_stats;
+  uint64_t start_ns = hz10_platform_now_ns();
+  uint64_t idle_ns = (uint64_t)hz10_shim_maint_idle_ms * UINT64_C(1000000);
+  Hz10OrphanRegistryPurgeStats trim = {0};
+  hz10_public_entry_trim_orphan_registry(hz10_shim_maint_budget, idle_ns,
+                                         &trim);
+  uint32_t decommitted = hz10_page_pool_decommit_idle(idle_ns);
+  uint32_t released = hz10_page_pool_purge_idle(
+      idle_ns * HZ10_SHIM_MAINT_RELEASE_FACTOR);
+  (void)atomic_fetch_add_explicit(&maint->ticks, 1u, memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->busy_ns,
+                                  hz10_platform_now_ns() - start_ns,
+                                  memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->orphan_seen, trim.pages_seen,
+                                  memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->orphan_reclaimed,
+                                  trim.pages_reclaimed, memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->orphan_busy, trim.pages_busy,
+                                  memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->orphan_young,
+                                  trim.pages_skipped_young,
+                                  memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->pool_decommitted, decommitted,
+                                  memory_order_relaxed);
+  (void)atomic_fetch_add_explicit(&maint->pool_released, released,
+                                  memory_order_relaxed);
+}
+
+static void* hz10_shim_maint_thread(void* arg) {
+  unsigned period_ms = (unsigned)(uintptr_t)arg;
+  struct timespec period;
+  period.tv_sec = (time_t)(period_ms / 1000u);
+  period.tv_nsec = (long)(period_ms % 1000u) * 1000000L;
+  for (;;) {
+    (void)nanosleep(&period, NULL);
+    hz10_shim_maint_tick();
+  }
+  return NULL;
+}
+
+/* Called from the constructor and from the atfork child handler. A thread
+ * that cannot be created leaves maintenance off in this process. */
+static void hz10_shim_maint_start(void) {
+  if (hz10_shim_maint_ms == 0u || hz10_shim_maint_started) {
+    return;
+  }
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, hz10_shim_maint_thread,
+                     (void*)(uintptr_t)hz10_shim_maint_ms) == 0) {
+    (void)pthread_setname_np(thread, "hz10-maint");
+    (void)pthread_detach(thread);
+    hz10_shim_maint_started = 1;
+  } else {
+    hz10_shim_maint_ms = 0u;
+  }
+}
+
 #if HZ10_ENABLE_SHIM_THREAD_EXIT_STATS
 static void hz10_shim_thread_stats_destructor(void* value) {
   if (!value || !hz10_shim_thread_exit_stats) {
@@ -554,6 +703,15 @@ __attribute__((constructor)) static void hz10_shim_init(void) {
 #endif
   hz10_shim_exit_stats_classes = hz10_shim_exit_stats_classes_enabled();
   hz10_shim_census_sec = hz10_shim_census_seconds();
+  hz10_shim_maint_ms =
+      hz10_shim_env_unsigned("HZ10_SHIM_MAINT_MS", 0u, 60000ul);
+  hz10_shim_maint_idle_ms =
+      hz10_shim_env_unsigned("HZ10_SHIM_MAINT_IDLE_MS", 1000u, 3600000ul);
+  hz10_shim_maint_budget =
+      hz10_shim_env_unsigned("HZ10_SHIM_MAINT_BUDGET", 256u, 65536ul);
+  if (hz10_shim_maint_budget == 0u) {
+    hz10_shim_maint_budget = 1u;
+  }
   (void)pthread_atfork(hz10_shim_atfork_prepare, hz10_shim_atfork_parent,
                        hz10_shim_atfork_child);
   if (hz10_shim_orphan_registry_drain_probe) {
@@ -572,6 +730,7 @@ __attribute__((constructor)) static void hz10_shim_init(void) {
       (void)pthread_detach(thread);
     }
   }
+  hz10_shim_maint_start();
 }
 
 static size_t hz10_shim_request_size(size_t size) {
@@ -97,7 +97,7 @@ void hz10_shim_dump_orphan_registry_drain_probe(void) {
   uint64_t total_depth = 0u, total_already_idle = 0u, total_drain_idle = 0u;
   uint64_t total_drain_capacity = 0u, total_truly_live = 0u;
   uint64_t total_skipped_live_owner = 0u, total_pending_before = 0u;
-  uint64_t total_merged = 0u;
+  uint64_t total_merged = 0u, total_drain_idle_bytes = 0u;
 
   for (uint32_t c = 0; c < HZ10_CLASS_COUNT; ++c) {
     Hz10OrphanRegistryDrainProbeClassStats stats = {0};
@@ -106,6 +106,10 @@ void hz10_shim_dump_orphan_registry_drain_probe(void) {
     total_depth += stats.depth;
     total_already_idle += stats.already_idle_pages;
     total_drain_idle += stats.drain_idle_pages;
+    uint64_t drain_idle_bytes = stats.drain_idle_pages *
+                                hz10_size_class_page_quanta(c) *
+                                HZ10_PAGE_QUANTUM;
+    total_drain_idle_bytes += drain_idle_bytes;
     total_drain_capacity += stats.drain_capacity_pages;
     total_truly_live += stats.truly_live_pinned_pages;
     total_skipped_live_owner += stats.skipped_live_owner_pages;
@@ -127,7 +131,7 @@ void hz10_shim_dump_orphan_registry_drain_probe(void) {
         (unsigned long long)stats.skipped_live_owner_pages,
         (unsigned long long)stats.pending_before_slots,
         (unsigned long long)stats.merged_slots,
-        (unsigned long long)(stats.drain_idle_pages * HZ10_PAGE_QUANTUM));
+        (unsigned long long)drain_idle_bytes);
   }
 
   hz10_probe_writef(
@@ -144,6 +148,6 @@ void hz10_shim_dump_orphan_registry_drain_probe(void) {
       (unsigned long long)total_skipped_live_owner,
       (unsigned long long)total_pending_before,
       (unsigned long long)total_merged,
-      (unsigned long long)(total_drain_idle * HZ10_PAGE_QUANTUM));
+      (unsigned long long)total_drain_idle_bytes);
   hz10_probe_in_dump = 0;
 }
@@ -10,10 +10,19 @@
  * - 16, 32, 48 preserve the tiny band.
  * - 64..8192 uses quarter-step classes: 1.0/1.25/1.5/1.75 per octave.
  * - 8192..65536 keeps the old 1.5x/2x large band to avoid wasting
- *   single-quantum page tail on quarter classes.
+ *   single-quantum page tail on quarter classes, unless
+ *   HZ10MultiQuantumPage-L1 is also on, in which case the quarter steps
+ *   continue up to 65536.
  */
 const uint32_t hz10_size_class_table[HZ10_CLASS_COUNT] = {
-#if HZ10_ENABLE_FINE_SIZE_CLASSES
+#if HZ10_ENABLE_FINE_SIZE_CLASSES && HZ10_ENABLE_MULTI_QUANTUM_PAGES
+    16u,    32u,    48u,    64u,    80u,    96u,    112u,   128u,
+    160u,   192u,   224u,   256u,   320u,   384u,   448u,   512u,
+    640u,   768u,   896u,   1024u,  1280u,  1536u,  1792u,  2048u,
+    2560u,  3072u,  3584u,  4096u,  5120u,  6144u,  7168u,  8192u,
+    10240u, 12288u, 14336u, 16384u, 20480u, 24576u, 28672u, 32768u,
+    40960u, 49152u, 57344u, 65536u
+#elif HZ10_ENABLE_FINE_SIZE_CLASSES
     16u,    32u,    48u,    64u,    80u,    96u,    112u,   128u,
     160u,   192u,   224u,   256u,   320u,   384u,   448u,   512u,
     640u,   768u,   896u,   1024u,  1280u,  1536u,  1792u,  2048u,
@@ -25,3 +34,26 @@ const uint32_t hz10_size_class_table[HZ10_CLASS_COUNT] = {
     6144u,  8192u,  12288u, 16384u, 24576u,  32768u,  49152u,  65536u
 #endif
 };
+
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+/*
+ * HZ10MultiQuantumPage-L1: quanta per page, the N in 1..HZ10_PAGE_MAX_QUANTA
+ * with the smallest (N * HZ10_PAGE_QUANTUM) % slot_size / (N * quantum)
+ * tail fraction, ties to the smaller N. Classes <= 8192 stay at 1.
+ * tests/hz10_size_class_smoke.c re-derives every entry.
+ */
+const uint8_t hz10_size_class_quanta_table[HZ10_CLASS_COUNT] = {
+#if HZ10_ENABLE_FINE_SIZE_CLASSES
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    3u, 3u, 2u, 1u, 1u, 3u, 4u, 1u, /* 10240 .. 32768 */
+    2u, 3u, 1u, 1u                  /* 40960 .. 65536 */
+#else
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+    1u, 1u, 3u, 1u, 3u, 1u, 3u, 1u /* 12288 .. 65536 */
+#endif
+};
+#endif
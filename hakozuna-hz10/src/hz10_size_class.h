@@ -43,19 +43,38 @@
  * supported by this box -- that would need spanning multiple quanta per
  * allocation, which is out of scope here (see current_task.md's
  * large-object-path follow-up).
+ *
+ * HZ10MultiQuantumPage-L1 opt-in (`HZ10_ENABLE_MULTI_QUANTUM_PAGES=1`):
+ * a class's page may cover 1..HZ10_PAGE_MAX_QUANTA contiguous quanta
+ * (hz10_size_class_page_quanta()), picked per class to minimize page tail
+ * slack -- 49152 becomes a 3-quantum page of exactly 4 slots instead of
+ * one slot plus 16 KiB of dead tail. Classes <= 8192 keep single-quantum
+ * pages (their tail slack is already <= 1/16 of a page). Combined with
+ * fine classes, the quarter-step band then continues past 8192 up to
+ * HZ10_PAGE_QUANTUM: 44 classes, worst remaining tail slack 1/8 of a page
+ * (57344, one slot per quantum). Individual allocations still never
+ * exceed HZ10_PAGE_QUANTUM; only the page holding them grows.
  */
 
 #ifndef HZ10_ENABLE_FINE_SIZE_CLASSES
 #define HZ10_ENABLE_FINE_SIZE_CLASSES 0
 #endif
+#ifndef HZ10_ENABLE_MULTI_QUANTUM_PAGES
+#define HZ10_ENABLE_MULTI_QUANTUM_PAGES 0
+#endif
 
-#if HZ10_ENABLE_FINE_SIZE_CLASSES
+#if HZ10_ENABLE_FINE_SIZE_CLASSES && HZ10_ENABLE_MULTI_QUANTUM_PAGES
+#define HZ10_CLASS_COUNT 44u
+#elif HZ10_ENABLE_FINE_SIZE_CLASSES
 #define HZ10_CLASS_COUNT 38u
 #else
 #define HZ10_CLASS_COUNT 24u
 #endif
 
 extern const uint32_t hz10_size_class_table[HZ10_CLASS_COUNT];
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+extern const uint8_t hz10_size_class_quanta_table[HZ10_CLASS_COUNT];
+#endif
 
 /* Returns the class index [0, HZ10_CLASS_COUNT) whose slot_size is the
  * smallest one >= size, or HZ10_CLASS_COUNT (invalid) if size is 0 or
@@ -77,14 +96,14 @@ static inline uint32_t hz10_size_class_for(size_t size) {
   if (size <= 64u) {
     return 3u;
   }
-  /* size is in (64, 8192]. Find e such that 2^e < size <= 2^(e+1), then
-   * pick the quarter-step boundary in that octave. The exact powers of two
-   * fall out as the previous octave's +4 result, e.g. size==128 maps from
-   * the 64-octave to class 7. */
-  if (size <= 8192u) {
+  /* size is in (64, 8192] (or (64, 65536] with multi-quantum pages). Find
+   * e such that 2^e < size <= 2^(e+1), then pick the quarter-step boundary
+   * in that octave. The exact powers of two fall out as the previous
+   * octave's +4 result, e.g. size==128 maps from the 64-octave to class 7. */
+  if (HZ10_ENABLE_MULTI_QUANTUM_PAGES || size <= 8192u) {
     unsigned long long rounded = (unsigned long long)size - 1ull;
     unsigned bits = 64u - (unsigned)__builtin_clzll(rounded);
-    unsigned e = bits - 1u; /* 6..12 */
+    unsigned e = bits - 1u; /* 6..12, or 6..15 */
     uint64_t low_pow = (uint64_t)1u << e;
     unsigned quarter_shift = e - 2u;
     uint64_t quarter = low_pow >> 2u;
@@ -131,12 +150,26 @@ static inline uint32_t hz10_size_class_slot_size(uint32_t class_id) {
   return hz10_size_class_table[class_id];
 }
 
+/* Quanta per page for class_id: always 1 unless multi-quantum pages are
+ * enabled, 0 for an out-of-range class_id. */
+static inline uint32_t hz10_size_class_page_quanta(uint32_t class_id) {
+  if (class_id >= HZ10_CLASS_COUNT) {
+    return 0u;
+  }
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+  return hz10_size_class_quanta_table[class_id];
+#else
+  return 1u;
+#endif
+}
+
 static inline uint32_t hz10_size_class_slot_count(uint32_t class_id) {
   uint32_t slot_size = hz10_size_class_slot_size(class_id);
   if (slot_size == 0u) {
     return 0u;
   }
-  return HZ10_PAGE_QUANTUM / slot_size;
+  return (hz10_size_class_page_quanta(class_id) * HZ10_PAGE_QUANTUM) /
+         slot_size;
 }
 
 #endif
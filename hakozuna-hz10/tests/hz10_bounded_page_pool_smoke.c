@@ -239,6 +239,58 @@ static int check_purge_idle(void) {
   return failed;
 }
 
+/* Case 6: hz10_page_pool_decommit_idle(), the maintenance thread's soft
+ * stage. Same two-ends threshold trick as case 5; additionally checks that
+ * a decommitted block stays cached, is not decommitted twice, and comes
+ * back from try_acquire() with its tail refaulting as zero pages. */
+static int check_decommit_idle(void) {
+  hz10_page_pool_reset_for_tests();
+  hz10_page_pool_set_cap(HZ10_SMOKE_POOL_CAP);
+
+  for (uint32_t i = 0; i < HZ10_SMOKE_POOL_CAP; ++i) {
+    unsigned char* block =
+        (unsigned char*)hz10_platform_reserve_rw(HZ10_PAGE_QUANTUM);
+    if (!block) {
+      fprintf(stderr, "decommit_idle: setup reserve %u failed\n", i);
+      return 1;
+    }
+    block[HZ10_PAGE_QUANTUM - 1u] = 0xa5u;
+    if (!hz10_page_pool_release(block)) {
+      fprintf(stderr, "decommit_idle: setup release %u failed\n", i);
+      return 1;
+    }
+  }
+
+  int failed = 0;
+  if (hz10_page_pool_decommit_idle(UINT64_MAX) != 0u) {
+    fprintf(stderr, "decommit_idle: a huge threshold decommitted blocks\n");
+    failed = 1;
+  }
+  uint32_t decommitted = hz10_page_pool_decommit_idle(0u);
+  if (decommitted != HZ10_SMOKE_POOL_CAP ||
+      hz10_page_pool_cached_count() != HZ10_SMOKE_POOL_CAP) {
+    fprintf(stderr, "decommit_idle: decommitted %u cached %u, expected %u\n",
+            decommitted, hz10_page_pool_cached_count(), HZ10_SMOKE_POOL_CAP);
+    failed = 1;
+  }
+  if (hz10_page_pool_decommit_idle(0u) != 0u ||
+      hz10_page_pool_decommitted_count() != HZ10_SMOKE_POOL_CAP) {
+    fprintf(stderr, "decommit_idle: blocks decommitted twice\n");
+    failed = 1;
+  }
+#if !defined(_WIN32)
+  unsigned char* reused = (unsigned char*)hz10_page_pool_try_acquire();
+  if (!reused || reused[HZ10_PAGE_QUANTUM - 1u] != 0u) {
+    fprintf(stderr, "decommit_idle: reused block tail was not purged\n");
+    failed = 1;
+  }
+  if (reused) {
+    hz10_platform_release(reused, HZ10_PAGE_QUANTUM);
+  }
+#endif
+  return failed;
+}
+
 int main(void) {
   hz10_pagemap_reset_for_tests();
 
@@ -257,6 +309,9 @@ int main(void) {
   if (check_purge_idle()) {
     return 6;
   }
+  if (check_decommit_idle()) {
+    return 7;
+  }
 
   puts("hz10_bounded_page_pool_smoke ok");
   return 0;
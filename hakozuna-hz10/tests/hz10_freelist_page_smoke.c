@@ -214,6 +214,75 @@ static int check_pending_storage_shape(void) {
   return failed;
 }
 
+/* Case 6: HZ10MultiQuantumPage-L1 shape. A 4 x 49152 page covers three
+ * contiguous quanta under one header: every slot is writable and routes
+ * back to this page from its own quantum, a caller-supplied single-quantum
+ * base is refused for it, and destroy releases every covered quantum. */
+static int check_multi_quantum_page(void) {
+  Hz10FreelistPage* page =
+      hz10_freelist_page_create_with_base_and_owner(NULL, 49152u, 4u);
+  if (!page) {
+    fprintf(stderr, "multi_quantum: create failed\n");
+    return 1;
+  }
+  int failed = 0;
+  if (((uintptr_t)page->base & (HZ10_PAGE_QUANTUM - 1u)) != 0u ||
+      hz10_freelist_page_payload_bytes(page) != 3u * HZ10_PAGE_QUANTUM) {
+    fprintf(stderr, "multi_quantum: bad base/payload shape\n");
+    failed = 1;
+  }
+  void* slots[4];
+  for (uint32_t i = 0u; i < 4u; ++i) {
+    slots[i] = hz10_freelist_page_alloc(page);
+    if (!slots[i]) {
+      fprintf(stderr, "multi_quantum: alloc %u failed\n", i);
+      hz10_freelist_page_destroy(page);
+      return 1;
+    }
+    memset(slots[i], (int)(0xA0u + i), 49152u);
+    H10RouteResult route = hz10_pagemap_route(slots[i], page->generation);
+    if (route.kind != H10_ROUTE_VALID || route.owner != page ||
+        route.page_base != page->base) {
+      fprintf(stderr, "multi_quantum: slot %u did not route to its page\n",
+              i);
+      failed = 1;
+    }
+  }
+  if (hz10_freelist_page_alloc(page) != NULL) {
+    fprintf(stderr, "multi_quantum: page handed out a fifth slot\n");
+    failed = 1;
+  }
+  for (uint32_t i = 0u; i < 4u; ++i) {
+    hz10_freelist_page_free(page, slots[i]);
+  }
+  if (page->free_count != page->slot_count) {
+    fprintf(stderr, "multi_quantum: page not idle after freeing all slots\n");
+    failed = 1;
+  }
+
+  char* base = (char*)page->base;
+  hz10_freelist_page_destroy(page);
+  for (uint32_t q = 0u; q < 3u; ++q) {
+    H10RouteResult gone = hz10_pagemap_route(
+        base + q * (uintptr_t)HZ10_PAGE_QUANTUM, HZ10_GENERATION_ANY);
+    if (gone.kind == H10_ROUTE_VALID) {
+      fprintf(stderr, "multi_quantum: quantum %u still routes after destroy\n",
+              q);
+      failed = 1;
+    }
+  }
+
+  void* one_quantum = malloc((size_t)HZ10_PAGE_QUANTUM * 2u);
+  char* aligned = (char*)(((uintptr_t)one_quantum + HZ10_PAGE_QUANTUM - 1u) &
+                          ~(uintptr_t)(HZ10_PAGE_QUANTUM - 1u));
+  if (hz10_freelist_page_create_with_base(aligned, 49152u, 4u) != NULL) {
+    fprintf(stderr, "multi_quantum: accepted a one-quantum caller base\n");
+    failed = 1;
+  }
+  free(one_quantum);
+  return failed;
+}
+
 int main(void) {
   hz10_pagemap_reset_for_tests();
 
@@ -241,6 +310,9 @@ int main(void) {
   if (check_pending_storage_shape()) {
     return 6;
   }
+  if (check_multi_quantum_page()) {
+    return 7;
+  }
 
   puts("hz10_freelist_page_smoke ok");
   return 0;
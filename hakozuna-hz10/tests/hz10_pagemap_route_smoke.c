@@ -114,9 +114,8 @@ static int check_tail_slack_invalid(void) {
 
 /* Bonus: a single-slot (slot_count == 1) registration may span more than
  * one HZ10_PAGE_QUANTUM -- the relaxation src/hz10_large_alloc.h needs.
- * A multi-slot (slot_count > 1) registration must still be rejected if its
- * span exceeds one quantum (the relaxation must not silently widen to
- * cases where it would break addressing of the later slots). Also checks
+ * Only its base quantum is registered, unlike a multi-slot page (see
+ * check_multi_quantum_multi_slot below). Also checks
  * that flags round-trips through route() alongside owner, unaffected by
  * either fact above. */
 static int check_multi_quantum_single_slot(void) {
@@ -170,14 +169,166 @@ static int check_multi_quantum_single_slot(void) {
     failed = 1;
   }
 
-  /* A multi-slot registration must still be rejected if its span exceeds
-   * one quantum -- the relaxation is single-slot only. */
-  void* base4 = (char*)HZ10_SMOKE_BASE1 + 8u * (uintptr_t)HZ10_PAGE_QUANTUM;
-  uint32_t rejected_gen = hz10_pagemap_register(base4, 4096u, 20u);
-  if (rejected_gen != 0u) {
+  return failed;
+}
+
+/* Bonus: HZ10MultiQuantumPage-L1. A multi-slot registration covering 3
+ * quanta (4 x 49152) routes every slot from whichever quantum it lands in,
+ * still rejects interior/tail pointers in the later quanta, releases all
+ * quanta at once, and re-registers with a generation above every covered
+ * quantum's history. A span beyond HZ10_PAGE_MAX_QUANTA stays rejected. */
+static int check_multi_quantum_multi_slot(void) {
+  char* base = (char*)HZ10_SMOKE_BASE1 + 16u * (uintptr_t)HZ10_PAGE_QUANTUM;
+  char* tail_quantum = base + 2u * (uintptr_t)HZ10_PAGE_QUANTUM;
+  /* Give the third quantum some generation history of its own first. */
+  uint32_t old_gen = 0u;
+  for (int i = 0; i < 3; ++i) {
+    old_gen = hz10_pagemap_register(tail_quantum, 64u, 16u);
+  }
+  if (old_gen == 0u || !hz10_pagemap_release(tail_quantum)) {
+    fprintf(stderr, "multi_slot: tail-quantum history setup failed\n");
+    return 1;
+  }
+
+  int sentinel_owner;
+  uint32_t gen =
+      hz10_pagemap_register_with_owner(base, 49152u, 4u, &sentinel_owner);
+  if (gen == 0u || gen <= old_gen) {
+    fprintf(stderr, "multi_slot: register gen=%u (old tail gen %u)\n", gen,
+            old_gen);
+    return 1;
+  }
+
+  int failed = 0;
+  for (uint32_t slot = 0u; slot < 4u; ++slot) {
+    H10RouteResult route = hz10_pagemap_route(base + slot * 49152u, gen);
+    failed |= expect(H10_ROUTE_VALID, H10_REASON_NONE, route, "multi_slot");
+    failed |= expect_slot(slot, route, "multi_slot");
+    if (route.page_base != base || route.owner != &sentinel_owner) {
+      fprintf(stderr, "multi_slot: slot %u base/owner mismatch\n", slot);
+      failed = 1;
+    }
+    H10RouteLocalResult local;
+    if (!hz10_pagemap_route_local_fast(base + slot * 49152u, &local) ||
+        local.slot_size != 49152u || local.generation != gen) {
+      fprintf(stderr, "multi_slot: local-fast route missed slot %u\n", slot);
+      failed = 1;
+    }
+  }
+  /* Quantum 1 starts mid-slot: its first byte is interior to slot 1. */
+  H10RouteResult interior =
+      hz10_pagemap_route(base + HZ10_PAGE_QUANTUM, gen);
+  failed |= expect(H10_ROUTE_INVALID, H10_REASON_INTERIOR, interior,
+                   "multi_slot/interior");
+  if (hz10_pagemap_route_local_fast(base + HZ10_PAGE_QUANTUM, NULL)) {
+    fprintf(stderr, "multi_slot: local-fast accepted an interior pointer\n");
+    failed = 1;
+  }
+  /* 4 x 49152 fills 3 quanta exactly, so past the end is the next quantum. */
+  H10RouteResult past_end =
+      hz10_pagemap_route(base + 3u * (uintptr_t)HZ10_PAGE_QUANTUM, gen);
+  if (past_end.kind != H10_ROUTE_MISS) {
+    fprintf(stderr, "multi_slot: past-end kind=%d\n", (int)past_end.kind);
+    failed = 1;
+  }
+
+  if (!hz10_pagemap_release(base)) {
+    fprintf(stderr, "multi_slot: release failed\n");
+    return 1;
+  }
+  for (uint32_t q = 0u; q < 3u; ++q) {
+    H10RouteResult gone = hz10_pagemap_route(
+        base + q * (uintptr_t)HZ10_PAGE_QUANTUM, HZ10_GENERATION_ANY);
+    failed |= expect(H10_ROUTE_MISS, H10_REASON_LEAF_ABSENT, gone,
+                     "multi_slot/released");
+  }
+
+  if (hz10_pagemap_register(base, 4096u,
+                            (HZ10_PAGE_MAX_QUANTA * HZ10_PAGE_QUANTUM) /
+                                    4096u +
+                                1u) != 0u) {
     fprintf(stderr,
-            "multi_quantum: multi-slot registration spanning more than "
-            "one quantum should still be rejected\n");
+            "multi_slot: span beyond HZ10_PAGE_MAX_QUANTA should be "
+            "rejected\n");
+    failed = 1;
+  }
+  return failed;
+}
+
+/* Case 10: HZ10RouteRecip-L1. hz10_pagemap_slot_recip()'s bound covers
+ * every multi-slot page register() accepts, so check it beyond the class
+ * tables: every slot size up to 4096 (including ones that are not
+ * HZ10_MIN_ALIGN multiples) and every 16-byte multiple up to the largest
+ * two-slot page, at every aligned offset inside HZ10_PAGE_MAX_QUANTA quanta.
+ * Then confirm the local-fast route uses it: an interior pointer into a
+ * 48-byte multi-slot page is rejected, slot boundaries are accepted. */
+static int check_slot_recip(void) {
+  uint32_t max_slot = (HZ10_PAGE_MAX_QUANTA * HZ10_PAGE_QUANTUM) / 2u;
+  uint32_t max_n = (HZ10_PAGE_MAX_QUANTA * HZ10_PAGE_QUANTUM) >>
+                   HZ10_MIN_ALIGN_SHIFT;
+  for (uint32_t slot_size = 1u; slot_size <= max_slot;
+       slot_size += slot_size < 4096u ? 1u : HZ10_MIN_ALIGN) {
+    uint32_t recip = hz10_pagemap_slot_recip(slot_size);
+    for (uint32_t n = 0u; n < max_n; ++n) {
+      uint64_t offset = (uint64_t)n << HZ10_MIN_ALIGN_SHIFT;
+      int expected = (offset % slot_size) == 0u;
+      if (hz10_pagemap_recip_divides(offset, recip) != expected) {
+        fprintf(stderr, "slot_recip: slot_size=%u offset=%llu got %d\n",
+                slot_size, (unsigned long long)offset, !expected);
+        return 1;
+      }
+    }
+  }
+
+  char* base = (char*)(uintptr_t)0x00006f0000000000ULL;
+  if (hz10_pagemap_register(base, 48u, HZ10_PAGE_QUANTUM / 48u) == 0u) {
+    fprintf(stderr, "slot_recip: register failed\n");
+    return 1;
+  }
+  int failed = 0;
+  H10RouteLocalResult local;
+  if (!hz10_pagemap_route_local_fast(base + 7u * 48u, &local) ||
+      local.slot_size != 48u) {
+    fprintf(stderr, "slot_recip: slot boundary rejected\n");
+    failed = 1;
+  }
+  if (hz10_pagemap_route_local_fast(base + 7u * 48u + 16u, NULL) ||
+      hz10_pagemap_route_local_fast(base + 32u, NULL)) {
+    fprintf(stderr, "slot_recip: interior pointer accepted\n");
+    failed = 1;
+  }
+  if (!hz10_pagemap_release(base)) {
+    fprintf(stderr, "slot_recip: release failed\n");
+    failed = 1;
+  }
+  return failed;
+}
+
+/* Case 11: H10PageRecord packs slot_count and flags into 16 bits each;
+ * register() refuses wider values instead of truncating them, and the
+ * widest accepted flags word round-trips through route(). */
+static int check_packed_fields(void) {
+  char* base = (char*)(uintptr_t)0x00006e0000000000ULL;
+  if (hz10_pagemap_register_with_owner_and_flags(base, 64u, 16u, NULL,
+                                                 UINT16_MAX + 1u) != 0u) {
+    fprintf(stderr, "packed: 17-bit flags accepted\n");
+    return 1;
+  }
+  if (hz10_pagemap_register(base, 1u, UINT16_MAX + 1u) != 0u) {
+    fprintf(stderr, "packed: 17-bit slot_count accepted\n");
+    return 1;
+  }
+  uint32_t gen = hz10_pagemap_register_with_owner_and_flags(
+      base, 64u, 16u, NULL, UINT16_MAX);
+  H10RouteResult r = hz10_pagemap_route(base + 64u, gen);
+  int failed = expect(H10_ROUTE_VALID, H10_REASON_NONE, r, "packed");
+  if (r.flags != UINT16_MAX || r.slot_count != 16u) {
+    fprintf(stderr, "packed: flags=%u slot_count=%u\n", r.flags,
+            r.slot_count);
+    failed = 1;
+  }
+  if (!hz10_pagemap_release(base)) {
+    fprintf(stderr, "packed: release failed\n");
     failed = 1;
   }
   return failed;
@@ -213,6 +364,15 @@ int main(void) {
   if (check_multi_quantum_single_slot()) {
     return 8;
   }
+  if (check_multi_quantum_multi_slot()) {
+    return 9;
+  }
+  if (check_slot_recip()) {
+    return 10;
+  }
+  if (check_packed_fields()) {
+    return 11;
+  }
 
   puts("hz10_pagemap_route_smoke ok");
   return 0;
@@ -112,6 +112,76 @@ static int check_orphan_registry_quiescent_purge_reclaims_drained_page(void) {
   }
   return 0;
 }
+
+/* HZ10OrphanRegistryTrim-L1: the maintenance-thread trim must leave young
+ * and live-pinned orphan pages registered, then reclaim the same page once
+ * its last slot is remote-freed and it is old enough. */
+static int check_orphan_registry_trim_skips_young_and_busy(void) {
+  OrphanPurgeState state = {0};
+  pthread_t owner_thread;
+  void* ret = NULL;
+  if (pthread_create(&owner_thread, NULL, alloc_orphan_purge_thread, &state) ||
+      pthread_join(owner_thread, &ret) || ret) {
+    fprintf(stderr, "orphan_trim: owner setup failed\n");
+    return 1;
+  }
+  H10RouteResult before =
+      hz10_pagemap_route(state.ptrs[0], HZ10_GENERATION_ANY);
+  if (before.kind != H10_ROUTE_VALID || !before.owner) {
+    fprintf(stderr, "orphan_trim: route before free failed\n");
+    return 1;
+  }
+  for (uint32_t i = 1; i < 128u; ++i) {
+    if (!hz10_free(state.ptrs[i])) {
+      fprintf(stderr, "orphan_trim: remote free failed\n");
+      return 1;
+    }
+  }
+
+  Hz10OrphanRegistryPurgeStats stats = {0};
+  hz10_public_entry_trim_orphan_registry(1024u, UINT64_MAX, &stats);
+  if (stats.pages_seen == 0u || stats.pages_skipped_young != stats.pages_seen ||
+      stats.pages_reclaimed != 0u) {
+    fprintf(stderr, "orphan_trim: young pages not skipped (seen=%llu "
+                    "young=%llu reclaimed=%llu)\n",
+            (unsigned long long)stats.pages_seen,
+            (unsigned long long)stats.pages_skipped_young,
+            (unsigned long long)stats.pages_reclaimed);
+    return 1;
+  }
+
+  hz10_public_entry_trim_orphan_registry(1024u, 0u, &stats);
+  if (stats.pages_busy == 0u || stats.slots_merged < 127u) {
+    fprintf(stderr, "orphan_trim: live page not kept busy (busy=%llu "
+                    "slots=%llu)\n",
+            (unsigned long long)stats.pages_busy,
+            (unsigned long long)stats.slots_merged);
+    return 1;
+  }
+  H10RouteResult pinned =
+      hz10_pagemap_route(state.ptrs[0], HZ10_GENERATION_ANY);
+  if (pinned.kind != H10_ROUTE_VALID || pinned.owner != before.owner) {
+    fprintf(stderr, "orphan_trim: busy page was destroyed\n");
+    return 1;
+  }
+
+  if (!hz10_free(state.ptrs[0])) {
+    fprintf(stderr, "orphan_trim: last remote free failed\n");
+    return 1;
+  }
+  hz10_public_entry_trim_orphan_registry(1024u, 0u, &stats);
+  if (stats.pages_reclaimed == 0u) {
+    fprintf(stderr, "orphan_trim: idle page not reclaimed\n");
+    return 1;
+  }
+  H10RouteResult after =
+      hz10_pagemap_route(state.ptrs[0], HZ10_GENERATION_ANY);
+  if (after.kind == H10_ROUTE_VALID && after.owner == before.owner) {
+    fprintf(stderr, "orphan_trim: page still routes after trim\n");
+    return 1;
+  }
+  return 0;
+}
 #endif
 
 #if HZ10_ENABLE_PARTIAL_ORPHAN_ADOPTION
@@ -319,6 +389,9 @@ int main(void) {
   if (check_orphan_registry_quiescent_purge_reclaims_drained_page()) {
     return 7;
   }
+  if (check_orphan_registry_trim_skips_young_and_busy()) {
+    return 8;
+  }
 #endif
 #if HZ10_ENABLE_PARTIAL_ORPHAN_ADOPTION
   if (check_partial_orphan_adoption_reuses_capacity()) {
@@ -745,6 +745,80 @@ static int check_front_cache_duplicate_remote_free_rejected(void) {
 }
 #endif /* HZ10_ENABLE_FRONT_CACHE */
 
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+/* Case 16: HZ10MultiQuantumPage-L1. For every class whose page spans more
+ * than one quantum, fill a page plus one object (so a second page is
+ * created), write every byte, and free them all; a slot whose start lies
+ * in a later quantum of its page must reject an interior free and accept
+ * a foreign-thread free. */
+static int check_multi_quantum_classes(void) {
+  enum { kMaxObjects = 64 };
+  int failed = 0;
+  for (uint32_t c = 0u; c < HZ10_CLASS_COUNT; ++c) {
+    if (hz10_size_class_page_quanta(c) <= 1u) {
+      continue;
+    }
+    uint32_t slot_size = hz10_size_class_slot_size(c);
+    uint32_t count = hz10_size_class_slot_count(c) + 1u;
+    if (count > kMaxObjects) {
+      fprintf(stderr, "multi_quantum: class %u has too many slots\n", c);
+      return 1;
+    }
+    void* ptrs[kMaxObjects];
+    void* later_quantum = NULL;
+    for (uint32_t i = 0u; i < count; ++i) {
+      ptrs[i] = hz10_malloc(slot_size);
+      if (!ptrs[i]) {
+        fprintf(stderr, "multi_quantum: malloc(%u) #%u failed\n", slot_size,
+                i);
+        return 1;
+      }
+      memset(ptrs[i], (int)(0x40u + i), slot_size);
+      H10RouteResult route = hz10_pagemap_route(ptrs[i], HZ10_GENERATION_ANY);
+      if (route.kind != H10_ROUTE_VALID || route.slot_size != slot_size) {
+        fprintf(stderr, "multi_quantum: class %u object %u did not route\n",
+                c, i);
+        failed = 1;
+      }
+      if (!later_quantum &&
+          (uintptr_t)ptrs[i] - (uintptr_t)route.page_base >=
+              (uintptr_t)HZ10_PAGE_QUANTUM) {
+        later_quantum = ptrs[i];
+      }
+    }
+    if (!later_quantum) {
+      fprintf(stderr, "multi_quantum: class %u never used a later quantum\n",
+              c);
+      failed = 1;
+    } else if (hz10_free((char*)later_quantum + HZ10_MIN_ALIGN) != 0) {
+      fprintf(stderr, "multi_quantum: class %u accepted an interior free\n",
+              c);
+      failed = 1;
+    }
+    for (uint32_t i = 0u; i < count; ++i) {
+      if (ptrs[i] == later_quantum) {
+        pthread_t thread;
+        void* ret = NULL;
+        if (pthread_create(&thread, NULL, hz10_smoke_free_in_other_thread,
+                           &ptrs[i]) != 0) {
+          return 1;
+        }
+        pthread_join(thread, &ret);
+        if ((intptr_t)ret != 1) {
+          fprintf(stderr, "multi_quantum: class %u remote free rejected\n",
+                  c);
+          failed = 1;
+        }
+      } else if (!hz10_free(ptrs[i])) {
+        fprintf(stderr, "multi_quantum: class %u free #%u rejected\n", c, i);
+        failed = 1;
+      }
+    }
+  }
+  return failed;
+}
+#endif /* HZ10_ENABLE_MULTI_QUANTUM_PAGES */
+
 int main(void) {
   hz10_pagemap_reset_for_tests();
 
@@ -794,6 +868,11 @@ int main(void) {
     return 14;
   }
 #endif
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+  if (check_multi_quantum_classes()) {
+    return 16;
+  }
+#endif
 
   puts("hz10_public_entry_smoke ok");
   return 0;
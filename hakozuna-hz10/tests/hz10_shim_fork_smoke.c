@@ -0,0 +1,122 @@
+#include <dirent.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* HZ10ShimMaintThread-L1 across fork(): with HZ10_SHIM_MAINT_MS set, the
+ * parent, a forked child and a grandchild forked from that child must each
+ * run exactly one "hz10-maint" thread, and the shim must still allocate in
+ * both descendants. Threads are counted from /proc/self/task/<tid>/comm. */
+
+typedef void* (*hz10_malloc_fn)(size_t);
+typedef void (*hz10_free_fn)(void*);
+
+static hz10_malloc_fn shim_malloc;
+static hz10_free_fn shim_free;
+
+static void* load_symbol(void* handle, const char* name) {
+  dlerror();
+  void* sym = dlsym(handle, name);
+  const char* err = dlerror();
+  if (err || !sym) {
+    fprintf(stderr, "shim_fork: dlsym(%s) failed: %s\n", name,
+            err ? err : "NULL");
+    exit(2);
+  }
+  return sym;
+}
+
+static int count_maint_threads(void) {
+  DIR* dir = opendir("/proc/self/task");
+  if (!dir) {
+    return -1;
+  }
+  int count = 0;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != NULL) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    char path[300];
+    char comm[32] = {0};
+    snprintf(path, sizeof(path), "/proc/self/task/%s/comm", entry->d_name);
+    FILE* f = fopen(path, "r");
+    if (!f) {
+      continue;
+    }
+    if (fgets(comm, sizeof(comm), f) && strcmp(comm, "hz10-maint\n") == 0) {
+      count++;
+    }
+    fclose(f);
+  }
+  closedir(dir);
+  return count;
+}
+
+/* One maintenance thread and a working malloc/free in this process. */
+static int check_process(const char* who) {
+  int threads = count_maint_threads();
+  if (threads != 1) {
+    fprintf(stderr, "shim_fork: %s has %d hz10-maint threads, want 1\n", who,
+            threads);
+    return 1;
+  }
+  void* p = shim_malloc(256);
+  if (!p) {
+    fprintf(stderr, "shim_fork: %s malloc failed\n", who);
+    return 1;
+  }
+  memset(p, 0x5a, 256);
+  shim_free(p);
+  return 0;
+}
+
+static int wait_child(pid_t pid, const char* who) {
+  int status = 0;
+  if (pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != 0) {
+    fprintf(stderr, "shim_fork: %s failed\n", who);
+    return 1;
+  }
+  return 0;
+}
+
+static int child_main(void) {
+  if (check_process("child")) {
+    return 1;
+  }
+  pid_t pid = fork();
+  if (pid == 0) {
+    _exit(check_process("grandchild"));
+  }
+  return wait_child(pid, "grandchild");
+}
+
+int main(void) {
+  if (setenv("HZ10_SHIM_MAINT_MS", "10", 1) != 0) {
+    return 2;
+  }
+  void* handle = dlopen("./libhz10.so", RTLD_NOW | RTLD_LOCAL);
+  if (!handle) {
+    fprintf(stderr, "shim_fork: dlopen failed: %s\n", dlerror());
+    return 2;
+  }
+  shim_malloc = (hz10_malloc_fn)load_symbol(handle, "malloc");
+  shim_free = (hz10_free_fn)load_symbol(handle, "free");
+  if (check_process("parent")) {
+    return 1;
+  }
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    _exit(child_main());
+  }
+  if (wait_child(pid, "child") || check_process("parent after fork")) {
+    return 1;
+  }
+  printf("hz10_shim_fork_smoke ok\n");
+  return 0;
+}
@@ -4,10 +4,18 @@
 #include <stdio.h>
 
 /* Case 1: the table itself is exactly what hz10_size_class.h documents,
- * strictly increasing, and every class fits in one quantum. */
+ * strictly increasing, and every class fits in its page (one quantum
+ * unless multi-quantum pages are enabled). */
 static int check_table_shape(void) {
   static const uint32_t expected[HZ10_CLASS_COUNT] = {
-#if HZ10_ENABLE_FINE_SIZE_CLASSES
+#if HZ10_ENABLE_FINE_SIZE_CLASSES && HZ10_ENABLE_MULTI_QUANTUM_PAGES
+      16u,    32u,    48u,    64u,    80u,    96u,    112u,   128u,
+      160u,   192u,   224u,   256u,   320u,   384u,   448u,   512u,
+      640u,   768u,   896u,   1024u,  1280u,  1536u,  1792u,  2048u,
+      2560u,  3072u,  3584u,  4096u,  5120u,  6144u,  7168u,  8192u,
+      10240u, 12288u, 14336u, 16384u, 20480u, 24576u, 28672u, 32768u,
+      40960u, 49152u, 57344u, 65536u
+#elif HZ10_ENABLE_FINE_SIZE_CLASSES
       16u,    32u,    48u,    64u,    80u,    96u,    112u,   128u,
       160u,   192u,   224u,   256u,   320u,   384u,   448u,   512u,
       640u,   768u,   896u,   1024u,  1280u,  1536u,  1792u,  2048u,
@@ -33,9 +41,12 @@ static int check_table_shape(void) {
     }
     prev = slot_size;
     uint32_t slot_count = hz10_size_class_slot_count(c);
-    if ((uint64_t)slot_size * (uint64_t)slot_count >
-        (uint64_t)HZ10_PAGE_QUANTUM) {
-      fprintf(stderr, "table_shape: class %u overflows one quantum\n", c);
+    uint32_t quanta = hz10_size_class_page_quanta(c);
+    if (slot_count == 0u ||
+        (uint64_t)slot_size * (uint64_t)slot_count >
+            (uint64_t)quanta * (uint64_t)HZ10_PAGE_QUANTUM) {
+      fprintf(stderr, "table_shape: class %u overflows its %u-quantum page\n",
+              c, quanta);
       return 1;
     }
     if ((slot_size % 16u) != 0u) {
@@ -54,6 +65,77 @@ static int check_table_shape(void) {
   return 0;
 }
 
+/* Case 1b: every class's page quanta is the documented choice -- 1 for
+ * classes <= 8192 (and always 1 when multi-quantum pages are off),
+ * otherwise the N in 1..HZ10_PAGE_MAX_QUANTA with the smallest tail-slack
+ * fraction, ties to the smaller N -- and no page wastes more than 1/8. */
+static int check_page_quanta(void) {
+  for (uint32_t c = 0u; c < HZ10_CLASS_COUNT; ++c) {
+    uint32_t slot_size = hz10_size_class_slot_size(c);
+    uint32_t expected = 1u;
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+    if (slot_size > 8192u) {
+      uint64_t best_waste = 0u;
+      uint64_t best_bytes = 1u;
+      for (uint32_t n = 1u; n <= HZ10_PAGE_MAX_QUANTA; ++n) {
+        uint64_t bytes = (uint64_t)n * HZ10_PAGE_QUANTUM;
+        uint64_t waste = bytes % slot_size;
+        /* waste/bytes < best_waste/best_bytes, cross-multiplied. */
+        if (n == 1u || waste * best_bytes < best_waste * bytes) {
+          expected = n;
+          best_waste = waste;
+          best_bytes = bytes;
+        }
+      }
+    }
+#endif
+    uint32_t quanta = hz10_size_class_page_quanta(c);
+    if (quanta != expected) {
+      fprintf(stderr, "page_quanta: class %u (slot_size=%u) quanta=%u want %u\n",
+              c, slot_size, quanta, expected);
+      return 1;
+    }
+#if HZ10_ENABLE_MULTI_QUANTUM_PAGES
+    uint64_t page_bytes = (uint64_t)quanta * HZ10_PAGE_QUANTUM;
+    uint64_t used = (uint64_t)slot_size * hz10_size_class_slot_count(c);
+    if ((page_bytes - used) * 8u > page_bytes) {
+      fprintf(stderr, "page_quanta: class %u wastes %llu of %llu bytes\n", c,
+              (unsigned long long)(page_bytes - used),
+              (unsigned long long)page_bytes);
+      return 1;
+    }
+#endif
+  }
+  if (hz10_size_class_page_quanta(HZ10_CLASS_COUNT) != 0u) {
+    fprintf(stderr, "page_quanta: out-of-range class_id should return 0\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Case 1c: HZ10RouteRecip-L1 -- for every class in the table this build
+ * compiled (default, fine, or fine + multi-quantum), the page reciprocal
+ * must agree with offset % slot_size at every aligned offset a page of
+ * that class can route, not just at slot boundaries. */
+static int check_slot_recip_exact(void) {
+  for (uint32_t c = 0u; c < HZ10_CLASS_COUNT; ++c) {
+    uint32_t slot_size = hz10_size_class_slot_size(c);
+    uint32_t recip = hz10_pagemap_slot_recip(slot_size);
+    uint64_t span = (uint64_t)hz10_size_class_page_quanta(c) *
+                    HZ10_PAGE_QUANTUM;
+    for (uint64_t offset = 0u; offset < span; offset += HZ10_MIN_ALIGN) {
+      int expected = (offset % slot_size) == 0u;
+      if (hz10_pagemap_recip_divides(offset, recip) != expected) {
+        fprintf(stderr,
+                "slot_recip: class %u (slot_size=%u) offset %llu got %d\n",
+                c, slot_size, (unsigned long long)offset, !expected);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
 /* Case 2: exhaustive classification check. For every byte size from 1 to
  * HZ10_PAGE_QUANTUM, hz10_size_class_for() must return the class with the
  * SMALLEST slot_size that is still >= size -- verified against the table
@@ -104,6 +186,12 @@ int main(void) {
   if (check_table_shape()) {
     return 2;
   }
+  if (check_page_quanta()) {
+    return 5;
+  }
+  if (check_slot_recip_exact()) {
+    return 6;
+  }
   if (check_exhaustive_classification()) {
     return 3;
   }
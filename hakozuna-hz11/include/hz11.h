@@ -4,17 +4,24 @@
 #include <stddef.h>
 #include <stdint.h>
 
-/* HZ11ThreadCacheFastPath-L0 public API.
+/* HZ11 public API.
  *
- * L0 is a system-allocator-backed front-cache SHIM, not the HZ11 allocator
- * body. malloc/free use a per-thread object cache + pointer->class token table;
- * everything else (calloc/realloc/usable_size/align*, large allocs, token-miss
- * frees) falls through to the system allocator (dlsym RTLD_NEXT). See
- * docs/HZ11_THREAD_CACHE_FAST_PATH_L0.md.
+ * Default (span lane, HZ11_CLASSIFY_SPAN=1, HZ11MultiArenaClassify-L1): small
+ * objects come from chained 4 GiB span arenas (up to HZ11_ARENA_MAX) with
+ * direct-index classify. malloc/free, calloc, in-class realloc and the aligned
+ * family (alignment <= 4 KiB) are served from spans; only large (>64 KiB)
+ * requests, foreign pointers and the all-arenas-full fallback reach the
+ * system allocator (dlsym RTLD_NEXT). See docs/HZ11_SPAN_BACKED_ENTRIES_L1.md
+ * and docs/HZ11_MULTI_ARENA_CLASSIFY_L1.md.
+ *
+ * L0 token lane (HZ11_CLASSIFY_SPAN=0, A/B siblings only) is a
+ * system-allocator-backed front-cache SHIM: malloc/free use a per-thread
+ * object cache + pointer->class token table and everything else falls through
+ * to the system allocator. See docs/HZ11_THREAD_CACHE_FAST_PATH_L0.md.
  *
  * Speed mode (default): assumes a valid C program; no double-free / interior /
- * stale detection. Tokens are set on every malloc handout and NOT deleted on
- * free, so stale tokens are expected in stats. */
+ * stale detection. In the token lane, tokens are set on every malloc handout
+ * and NOT deleted on free, so stale tokens are expected in stats. */
 
 void* hz11_malloc(size_t size);
 void hz11_free(void* ptr);
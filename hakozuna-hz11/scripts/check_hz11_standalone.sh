@@ -56,13 +56,14 @@ if find "${CHECK_TREE[@]}" -type f \
 fi
 
 echo "[hz11-standalone] checking local build products are ignored"
-for product in hz11_thread_cache_smoke hz11_thread_cache_smoke_span \
-               hz11_thread_cache_smoke_stats hz11_thread_cache_smoke_span_stats \
-               hz11_thread_cache_smoke_top hz11_thread_cache_smoke_span_top \
-               hz11_thread_cache_smoke_tlsfast hz11_thread_cache_smoke_span_tlsfast \
-               hz11_thread_cache_smoke_nobytes hz11_thread_cache_smoke_span_nobytes \
-               hz11_thread_cache_smoke_soa hz11_thread_cache_smoke_span_soa \
+for product in hz11_thread_cache_smoke hz11_thread_cache_smoke_token \
+               hz11_thread_cache_smoke_stats hz11_thread_cache_smoke_token_stats \
+               hz11_thread_cache_smoke_top hz11_thread_cache_smoke_token_top \
+               hz11_thread_cache_smoke_tlsfast hz11_thread_cache_smoke_token_tlsfast \
+               hz11_thread_cache_smoke_nobytes hz11_thread_cache_smoke_token_nobytes \
+               hz11_thread_cache_smoke_soa hz11_thread_cache_smoke_token_soa \
                hz11_thread_cache_smoke_span_transfer hz11_thread_cache_smoke_span_return \
+               hz11_central_spill_smoke \
                hz11_fixed_local_bench libhz11.so libhz11_span.so \
                libhz11_stats.so libhz11_span_stats.so \
                libhz11_top.so libhz11_span_top.so \
@@ -75,6 +76,7 @@ for product in hz11_thread_cache_smoke hz11_thread_cache_smoke_span \
                libhz11_span_cache512_classbatch16.so \
                libhz11_span_cache512_classbatch32.so \
                libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq.so \
+               libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq_cs.so \
                libhz11_span_transfer_thread_exit_cap_batch32_fine128_cachecap64.so \
                libhz11_span_transfer_thread_exit_cap_batch32_fine128_cachecap128.so \
                libhz11_span_transfer_thread_exit_cap_batch32_fine128_cachecap256.so \
@@ -233,6 +233,8 @@ for alloc in "${requested_allocators[@]}"; do
       add_allocator hz11-thread-exit-cap-batch32-fine128 "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128.so" "" ;;
     hz11-thread-exit-cap-batch32-fine128-rseq)
       add_allocator hz11-thread-exit-cap-batch32-fine128-rseq "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq.so" "" ;;
+    hz11-thread-exit-cap-batch32-fine128-rseq-cs)
+      add_allocator hz11-thread-exit-cap-batch32-fine128-rseq-cs "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq_cs.so" "" ;;
     hz11-thread-exit-cap-batch32-fine128-cachecap256)
       add_allocator hz11-thread-exit-cap-batch32-fine128-cachecap256 "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_cachecap256.so" "" ;;
     hz11-thread-exit-cap-batch32-fine128-cachecap1024-bytes)
@@ -411,7 +413,7 @@ add_hz11_diag_env() {
     hz11-thread-exit-cap-batch32-fine128)
       cmd_ref+=(HZ11_DUMP_STATS=1 HZ11_DUMP_CURRENT_SPAN_POOL=1 \
         HZ11_DUMP_CENTRAL_CLASSES=1) ;;
-    hz11-thread-exit-cap-batch32-fine128-rseq)
+    hz11-thread-exit-cap-batch32-fine128-rseq|hz11-thread-exit-cap-batch32-fine128-rseq-cs)
       cmd_ref+=(HZ11_DUMP_STATS=1 HZ11_DUMP_CURRENT_SPAN_POOL=1 \
         HZ11_DUMP_CENTRAL_CLASSES=1) ;;
     hz11-thread-exit-cap-batch32-fine128-cachecap256)
@@ -111,6 +111,9 @@ allocator_lib() {
     hz11-thread-exit-cap-batch32-fine128-rseq)
       bench_find_first_existing "${HZ11_FINE128_RSEQ_SO:-}" \
         "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq.so" ;;
+    hz11-thread-exit-cap-batch32-fine128-rseq-cs)
+      bench_find_first_existing "${HZ11_FINE128_RSEQ_CS_SO:-}" \
+        "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_rseq_cs.so" ;;
     hz11-thread-exit-cap-batch32-fine128-cachecap1024-bytes)
       bench_find_first_existing "${HZ11_FINE128_CAP1024_BYTES_SO:-}" \
         "${ROOT}/libhz11_span_transfer_thread_exit_cap_batch32_fine128_cachecap1024_bytes.so" ;;
@@ -4,15 +4,20 @@
  * docs/HZ11_PERCPU_RSEQ_CACHE_PROTOTYPE_L2.md.
  *
  * HZ11PerCpuRseqCachePrototype-L2: correctness-first locked per-CPU cache.
+ * rseq selects the current CPU (glibc's per-thread rseq area `cpu_id`) and the
+ * per-CPU slab mutation is serialized by a small per-CPU spinlock.
  *
- * IMPORTANT: this prototype uses rseq ONLY to select the current CPU (glibc's
- * per-thread rseq area `cpu_id`). The per-CPU slab mutation is serialized by a
- * small per-CPU spinlock for correctness. There is NO hand-rolled rseq critical
- * section in this box. The lock-free single-commit rseq CS is explicitly deferred
- * to HZ11PerCpuRseqSingleCommitCS-L2, gated on this box's measurement.
+ * HZ11PerCpuRseqSingleCommitCS-L2 (HZ11_PERCPU_RSEQ_CS=1): the lock is replaced
+ * by a restartable sequence on the same glibc-registered area. Each push/pop
+ * publishes a static rseq_cs descriptor, re-checks cpu_id against the CPU the
+ * slab was picked for, and commits with one store to `count`. Preemption,
+ * migration or a signal inside the sequence makes the kernel jump to the abort
+ * handler, which restarts up to HZ11_PERCPU_RETRIES times and then reports a
+ * miss so the caller takes the thread-cache/transfer path.
  *
- * See docs/HZ11_PERCPU_RSEQ_CACHE_READINESS_L1.md and
- * docs/HZ11_PERCPU_RSEQ_CACHE_PROTOTYPE_L2.md for the boundary and gate. */
+ * See docs/HZ11_PERCPU_RSEQ_CACHE_READINESS_L1.md,
+ * docs/HZ11_PERCPU_RSEQ_CACHE_PROTOTYPE_L2.md and
+ * docs/HZ11_PERCPU_RSEQ_SINGLE_COMMIT_CS_L2.md for the boundary and gate. */
 
 #include "hz11_percpu_cache.h"
 
@@ -44,7 +49,9 @@
 _Atomic int hz11_percpu_enabled_flag = 0;
 
 static H11PerCpu g_percpu[HZ11_PERCPU_MAX_CPUS];
+#if !HZ11_PERCPU_RSEQ_CS
 static _Atomic int g_lock[HZ11_PERCPU_MAX_CPUS]; /* one spinlock per CPU */
+#endif
 
 /* Counters (relaxed; dumped via HZ11_PERCPU_STATS=1 atexit). */
 static _Atomic uint64_t c_rseq_enabled;
@@ -52,12 +59,22 @@ static _Atomic uint64_t c_rseq_fallback;
 static _Atomic uint64_t c_percpu_hit;
 static _Atomic uint64_t c_percpu_miss;
 static _Atomic uint64_t c_percpu_flush;
-static _Atomic uint64_t c_percpu_abort; /* reserved; locked lane does not abort */
+static _Atomic uint64_t c_percpu_abort; /* rseq restarts; locked lane is 0 */
 
 static inline void cnt_inc(_Atomic uint64_t* s) {
   atomic_fetch_add_explicit(s, 1u, memory_order_relaxed);
 }
 
+static inline void cnt_hot(_Atomic uint64_t* s) {
+#if HZ11_PERCPU_HOT_COUNTERS
+  cnt_inc(s);
+#else
+  (void)s;
+#endif
+}
+
+#if !HZ11_PERCPU_RSEQ_CS
+
 static inline void hz11_percpu_spin_lock(_Atomic int* l) {
   for (;;) {
     int expected = 0;
@@ -79,6 +96,7 @@ static inline void hz11_percpu_spin_lock(_Atomic int* l) {
 static inline void hz11_percpu_spin_unlock(_Atomic int* l) {
   atomic_store_explicit(l, 0, memory_order_release);
 }
+#endif /* !HZ11_PERCPU_RSEQ_CS */
 
 #if HZ11_PERCPU_HAVE_RSEQ
 static inline struct rseq* hz11_percpu_area(void) {
@@ -94,6 +112,97 @@ static inline int hz11_percpu_cpu_id(void) {
   }
   return c;
 }
+
+#if HZ11_PERCPU_RSEQ_CS
+/* Single-commit critical sections. Layout follows the kernel ABI: a 32-byte
+ * aligned struct rseq_cs {version, flags, start_ip, post_commit_offset,
+ * abort_ip} in __rseq_cs, and the abort handler preceded by RSEQ_SIG encoded in
+ * a ud1 instruction. `1` is the first instruction of the sequence, `2` is the
+ * post-commit address, `4` is the abort entry. Nothing before the commit store
+ * is visible to another thread on this CPU: pop only reads slots[count-1] and
+ * writes the caller's stack slot; push writes slots[count], which is above the
+ * live range until count is bumped. */
+#define HZ11_RSEQ_CS_DESC                                   \
+  ".pushsection __rseq_cs, \"aw\"\n\t"                     \
+  ".balign 32\n\t"                                          \
+  "3:\n\t"                                                  \
+  ".long 0x0, 0x0\n\t"                                      \
+  ".quad 1f, (2f - 1f), 4f\n\t"                             \
+  ".popsection\n\t"
+
+#define HZ11_RSEQ_CS_ABORT                                  \
+  ".pushsection __rseq_failure, \"ax\"\n\t"                \
+  ".byte 0x0f, 0xb9, 0x3d\n\t"                              \
+  ".long " HZ11_RSEQ_STR(RSEQ_SIG) "\n\t"                   \
+  "4:\n\t"                                                  \
+  "jmp %l[abort]\n\t"                                       \
+  ".popsection\n\t"
+
+#define HZ11_RSEQ_STR_(x) #x
+#define HZ11_RSEQ_STR(x) HZ11_RSEQ_STR_(x)
+
+/* 1 = popped into *out, 0 = slab empty, -1 = aborted (retry or fall back). */
+static inline int hz11_percpu_rseq_pop(struct rseq* rs, uint32_t cpu,
+                                       H11PerCpuClass* slab, void** out) {
+  __asm__ __volatile__ goto(
+      HZ11_RSEQ_CS_DESC
+      "leaq 3b(%%rip), %%rax\n\t"
+      "movq %%rax, %[rseq_cs]\n\t"
+      "1:\n\t"
+      "cmpl %[cpu], %[cpu_id]\n\t"
+      "jnz %l[abort]\n\t"
+      "movl %[count], %%ecx\n\t"
+      "testl %%ecx, %%ecx\n\t"
+      "jz %l[empty]\n\t"
+      "subl $1, %%ecx\n\t"
+      "movq (%[slots], %%rcx, 8), %%rax\n\t"
+      "movq %%rax, (%[out])\n\t"
+      "movl %%ecx, %[count]\n\t" /* commit */
+      "2:\n\t"
+      HZ11_RSEQ_CS_ABORT
+      :
+      : [cpu] "r"(cpu), [cpu_id] "m"(rs->cpu_id), [rseq_cs] "m"(rs->rseq_cs),
+        [count] "m"(slab->count), [slots] "r"(slab->slots), [out] "r"(out)
+      : "memory", "cc", "rax", "rcx"
+      : abort, empty);
+  return 1;
+empty:
+  return 0;
+abort:
+  return -1;
+}
+
+/* 1 = pushed, 0 = slab full, -1 = aborted (retry or fall back). */
+static inline int hz11_percpu_rseq_push(struct rseq* rs, uint32_t cpu,
+                                        H11PerCpuClass* slab, void* ptr) {
+  __asm__ __volatile__ goto(
+      HZ11_RSEQ_CS_DESC
+      "leaq 3b(%%rip), %%rax\n\t"
+      "movq %%rax, %[rseq_cs]\n\t"
+      "1:\n\t"
+      "cmpl %[cpu], %[cpu_id]\n\t"
+      "jnz %l[abort]\n\t"
+      "movl %[count], %%ecx\n\t"
+      "cmpl %[cap], %%ecx\n\t"
+      "jae %l[full]\n\t"
+      "movq %[ptr], (%[slots], %%rcx, 8)\n\t"
+      "addl $1, %%ecx\n\t"
+      "movl %%ecx, %[count]\n\t" /* commit */
+      "2:\n\t"
+      HZ11_RSEQ_CS_ABORT
+      :
+      : [cpu] "r"(cpu), [cpu_id] "m"(rs->cpu_id), [rseq_cs] "m"(rs->rseq_cs),
+        [count] "m"(slab->count), [slots] "r"(slab->slots), [ptr] "r"(ptr),
+        [cap] "i"(HZ11_PERCPU_CAP)
+      : "memory", "cc", "rax", "rcx"
+      : abort, full);
+  return 1;
+full:
+  return 0;
+abort:
+  return -1;
+}
+#endif /* HZ11_PERCPU_RSEQ_CS */
 #endif /* HZ11_PERCPU_HAVE_RSEQ */
 
 static _Atomic int hz11_percpu_probed = 0;
@@ -146,10 +255,33 @@ int hz11_percpu_pop(uint8_t cid, void** out) {
     return 0;
   }
   if (cid >= HZ11_PERCPU_NCLASSES) {
-    cnt_inc(&c_percpu_miss);
+    cnt_hot(&c_percpu_miss);
     return 0;
   }
-#if HZ11_PERCPU_HAVE_RSEQ
+#if HZ11_PERCPU_HAVE_RSEQ && HZ11_PERCPU_RSEQ_CS
+  struct rseq* rs = hz11_percpu_area();
+  for (uint32_t attempt = 0; attempt < HZ11_PERCPU_RETRIES; ++attempt) {
+    uint32_t cpu = __atomic_load_n(&rs->cpu_id_start, __ATOMIC_RELAXED);
+    if (cpu >= HZ11_PERCPU_MAX_CPUS) {
+      break;
+    }
+    void* p = NULL;
+    int r = hz11_percpu_rseq_pop(rs, cpu, &g_percpu[cpu].cls[cid], &p);
+    if (r > 0) {
+      if (out) {
+        *out = p;
+      }
+      cnt_hot(&c_percpu_hit);
+      return 1;
+    }
+    if (r == 0) {
+      cnt_hot(&c_percpu_miss);
+      return 0;
+    }
+    cnt_inc(&c_percpu_abort);
+  }
+  cnt_inc(&c_rseq_fallback); /* caller refills from thread cache / transfer */
+#elif HZ11_PERCPU_HAVE_RSEQ
   int cpu = hz11_percpu_cpu_id();
   if (cpu < 0 || (uint32_t)cpu >= HZ11_PERCPU_MAX_CPUS) {
     cnt_inc(&c_rseq_fallback);
@@ -169,10 +301,10 @@ int hz11_percpu_pop(uint8_t cid, void** out) {
     if (out) {
       *out = p;
     }
-    cnt_inc(&c_percpu_hit);
+    cnt_hot(&c_percpu_hit);
     return 1;
   }
-  cnt_inc(&c_percpu_miss);
+  cnt_hot(&c_percpu_miss);
 #else
   (void)cid;
 #endif
@@ -187,7 +319,26 @@ int hz11_percpu_push(uint8_t cid, void* ptr) {
   if (cid >= HZ11_PERCPU_NCLASSES) {
     return 0; /* ineligible: caller's thread-cache push handles it */
   }
-#if HZ11_PERCPU_HAVE_RSEQ
+#if HZ11_PERCPU_HAVE_RSEQ && HZ11_PERCPU_RSEQ_CS
+  struct rseq* rs = hz11_percpu_area();
+  for (uint32_t attempt = 0; attempt < HZ11_PERCPU_RETRIES; ++attempt) {
+    uint32_t cpu = __atomic_load_n(&rs->cpu_id_start, __ATOMIC_RELAXED);
+    if (cpu >= HZ11_PERCPU_MAX_CPUS) {
+      break;
+    }
+    int r = hz11_percpu_rseq_push(rs, cpu, &g_percpu[cpu].cls[cid], ptr);
+    if (r > 0) {
+      cnt_hot(&c_percpu_hit);
+      return 1;
+    }
+    if (r == 0) {
+      cnt_hot(&c_percpu_flush); /* full: caller pushes to the thread cache */
+      return 0;
+    }
+    cnt_inc(&c_percpu_abort);
+  }
+  cnt_inc(&c_rseq_fallback); /* caller frees into thread cache / transfer */
+#elif HZ11_PERCPU_HAVE_RSEQ
   int cpu = hz11_percpu_cpu_id();
   if (cpu < 0 || (uint32_t)cpu >= HZ11_PERCPU_MAX_CPUS) {
     cnt_inc(&c_rseq_fallback);
@@ -203,10 +354,10 @@ int hz11_percpu_push(uint8_t cid, void* ptr) {
   }
   hz11_percpu_spin_unlock(&g_lock[cpu]);
   if (ok) {
-    cnt_inc(&c_percpu_hit);
+    cnt_hot(&c_percpu_hit);
     return 1;
   }
-  cnt_inc(&c_percpu_flush); /* overflow: caller flushes to the thread cache */
+  cnt_hot(&c_percpu_flush); /* overflow: caller flushes to the thread cache */
 #else
   (void)cid;
   (void)ptr;
@@ -220,9 +371,9 @@ static void hz11_percpu_dump(void) {
     return;
   }
   fprintf(stderr,
-          "[hz11-percpu] enabled=%d rseq_enabled=%llu rseq_fallback=%llu "
+          "[hz11-percpu] enabled=%d cs=%d rseq_enabled=%llu rseq_fallback=%llu "
           "hit=%llu miss=%llu flush=%llu abort=%llu\n",
-          hz11_percpu_enabled() ? 1 : 0,
+          hz11_percpu_enabled() ? 1 : 0, HZ11_PERCPU_RSEQ_CS,
           (unsigned long long)atomic_load_explicit(&c_rseq_enabled,
                                                    memory_order_relaxed),
           (unsigned long long)atomic_load_explicit(&c_rseq_fallback,
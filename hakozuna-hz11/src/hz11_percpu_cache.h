@@ -7,12 +7,15 @@
  * transfer/central path, on the fine128 base. When HZ11_PERCPU_RSEQ=0 (default)
  * the layer is behaviorally disabled through no-op stubs.
  *
- * This prototype uses rseq only to select the current CPU. Slab mutation is
- * protected by a per-CPU spinlock; there is no hand-rolled rseq critical section
- * in this box. If the rseq area cannot be verified at runtime, the layer
- * self-disables and behaves as identity fine128.
- * See docs/HZ11_PERCPU_RSEQ_CACHE_READINESS_L1.md and
- * docs/HZ11_PERCPU_RSEQ_CACHE_PROTOTYPE_L2.md for the boundary and gate. */
+ * The L2 prototype uses rseq only to select the current CPU and protects slab
+ * mutation with a per-CPU spinlock. HZ11_PERCPU_RSEQ_CS=1 (x86-64 Linux) swaps
+ * the lock for a single-commit rseq critical section on glibc's registered rseq
+ * area: no atomics on the hit path, and an abort after HZ11_PERCPU_RETRIES
+ * restarts falls back to the thread-cache/transfer path. If the rseq area cannot
+ * be verified at runtime, the layer self-disables and behaves as identity fine128.
+ * See docs/HZ11_PERCPU_RSEQ_CACHE_READINESS_L1.md,
+ * docs/HZ11_PERCPU_RSEQ_CACHE_PROTOTYPE_L2.md and
+ * docs/HZ11_PERCPU_RSEQ_SINGLE_COMMIT_CS_L2.md for the boundary and gate. */
 
 #include <stdint.h>
 #include <stddef.h>
@@ -22,8 +25,20 @@
 #define HZ11_PERCPU_RSEQ 0
 #endif
 
+/* HZ11PerCpuRseqSingleCommitCS-L2: lock-free rseq critical section for the
+ * slab push/pop. Only meaningful with HZ11_PERCPU_RSEQ=1. */
+#ifndef HZ11_PERCPU_RSEQ_CS
+#define HZ11_PERCPU_RSEQ_CS 0
+#endif
+
 #if HZ11_PERCPU_RSEQ
 
+/* Hit/miss/flush counters are shared atomics; the CS lane compiles them out so
+ * the hit path stays atomic-free (abort/fallback are still counted). */
+#ifndef HZ11_PERCPU_HOT_COUNTERS
+#define HZ11_PERCPU_HOT_COUNTERS (!HZ11_PERCPU_RSEQ_CS)
+#endif
+
 /* Per-(cpu,class) slab capacity (pointers). Kept small on purpose. */
 #ifndef HZ11_PERCPU_CAP
 #define HZ11_PERCPU_CAP 32u
@@ -44,7 +59,7 @@
 #define HZ11_PERCPU_MAX_CPUS 128u
 #endif
 
-/* Bounded rseq retry count before falling back to the existing path. */
+/* Bounded rseq restart count before falling back to the existing path. */
 #ifndef HZ11_PERCPU_RETRIES
 #define HZ11_PERCPU_RETRIES 5u
 #endif
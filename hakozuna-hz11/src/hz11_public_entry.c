@@ -3,6 +3,7 @@
 #include "hz11_transfer_cache.h"
 #include "hz11_percpu_cache.h"
 
+#include <errno.h>
 #include <string.h>
 
 #if defined(__GNUC__) || defined(__clang__)
@@ -22,7 +23,7 @@ static inline void* hz11_malloc_fast_with_tc(H11ThreadCache* tc, size_t size) {
     return hz11_sys_malloc(size); /* large: system; free misses arena -> sys_free */
   }
 #if HZ11_PERCPU_RSEQ
-  /* Per-CPU front cache (locked prototype): rseq-selected CPU-local slab for
+  /* Per-CPU front cache (locked or rseq-CS lane): CPU-local slab for
    * eligible small classes, before the thread cache. pop self-probes and
    * self-disables, so call it unconditionally for eligible classes. */
   if (class_id < HZ11_PERCPU_NCLASSES) {
@@ -90,7 +91,7 @@ static inline void hz11_free_fast_with_tc(H11ThreadCache* tc, void* ptr) {
     HZ11_COUNT_INC(tc->direct_hit_count);
     hz11_live_footprint_free(class_id, ptr);
 #if HZ11_PERCPU_RSEQ
-    /* Per-CPU front cache (locked prototype): push to current CPU-local slab for
+    /* Per-CPU front cache (locked or rseq-CS lane): push to current CPU slab for
      * eligible small classes; on overflow fall through to the thread cache. push
      * self-probes and self-disables, so call it unconditionally for eligible. */
     if (class_id < HZ11_PERCPU_NCLASSES) {
@@ -193,12 +194,17 @@ void* hz11_realloc(void* ptr, size_t size) {
   }
 #if HZ11_CLASSIFY_SPAN
   if (hz11_arena_contains(ptr)) {
-    /* arena ptr: fixed-size slot, sys_realloc is NOT valid. malloc+copy+free. */
+    /* arena ptr: fixed-size slot, sys_realloc is NOT valid. A resize that
+     * stays in the same class keeps the slot; anything else is
+     * malloc+copy+free. */
+    uint8_t oc;
+    size_t old_slot =
+        hz11_span_classify(ptr, &oc) ? hz11_class_slot_size(oc) : 0u;
+    if (old_slot != 0u && hz11_size_class(size) == oc) {
+      return ptr;
+    }
     void* np = hz11_malloc(size);
     if (np) {
-      uint8_t oc;
-      size_t old_slot =
-          hz11_span_classify(ptr, &oc) ? hz11_class_slot_size(oc) : 0u;
       size_t copy = old_slot < size ? old_slot : size;
       memcpy(np, ptr, copy);
       hz11_free(ptr);
@@ -210,7 +216,13 @@ void* hz11_realloc(void* ptr, size_t size) {
   H11ThreadCache* tc = hz11_thread_cache_get();
   uint8_t old_class;
   int had_token = (tc != NULL) && hz11_token_lookup(tc->tokens, ptr, &old_class);
-  void* np = hz11_sys_realloc(ptr, size); /* L0 backing is system malloc */
+  /* L0 backing is system malloc. The token names a class, and a free pushes
+   * the chunk into that class's cache, so size the chunk to the full slot or a
+   * later malloc of the slot size overruns it. */
+  uint8_t new_class = hz11_size_class(size);
+  size_t chunk = new_class == HZ11_LARGE_CLASS ? size
+                                               : hz11_class_slot_size(new_class);
+  void* np = hz11_sys_realloc(ptr, chunk);
   if (!np) {
     return NULL; /* failure: old ptr + token stay valid */
   }
@@ -218,16 +230,78 @@ void* hz11_realloc(void* ptr, size_t size) {
     if (had_token) {
       hz11_token_invalidate(tc->tokens, ptr);
     }
-    hz11_token_set(tc->tokens, np, hz11_size_class(size));
+    hz11_token_set(tc->tokens, np, new_class);
   }
   return np;
 #endif
 }
 
+#if !HZ11_CLASSIFY_SPAN
+/* Token lane: a system pointer handed out by calloc/aligned can land on an
+ * address whose stale token (speed mode keeps tokens after free) names a
+ * cache class; drop it so the later free goes to sys_free, as realloc does. */
+static void* hz11_token_forget(void* p) {
+  if (p && !hz11_in_resolver()) {
+    H11ThreadCache* tc = hz11_thread_cache_get();
+    if (tc) {
+      hz11_token_invalidate(tc->tokens, p);
+    }
+  }
+  return p;
+}
+#endif
+
+#if HZ11_CLASSIFY_SPAN
+/* HZ11SpanBackedEntries-L1: calloc from the span lane. A slot that was just
+ * bumped out of a span that came straight off the arena cursor has never been
+ * written, so it is still the kernel's zero page and the memset is skipped.
+ * Everything else (cache/percpu/transfer/central hits, reused spans, the
+ * arena-full fallback) is zeroed over the requested bytes only. */
+static HZ11_NOINLINE void* hz11_calloc_span_with_tc(H11ThreadCache* tc,
+                                                   size_t total) {
+  uint8_t class_id = hz11_size_class(total);
+  const H11SpanCurrent* cs = &tc->current[class_id];
+  const char* base0 = cs->base;
+  uint32_t bump0 = cs->bump_index;
+  void* p = hz11_malloc_fast_with_tc(tc, total);
+  if (!p) {
+    return NULL;
+  }
+  if (cs->base && hz11_span_is_zeroed(cs->base)) {
+    size_t slot = hz11_class_slot_size(class_id);
+    const char* lo = cs->base == base0 ? base0 + (size_t)bump0 * slot : cs->base;
+    const char* hi = cs->base + (size_t)cs->bump_index * slot;
+    if ((const char*)p >= lo && (const char*)p < hi) {
+      return p; /* fresh bump slot: already zero */
+    }
+  }
+  memset(p, 0, total);
+  return p;
+}
+#endif
+
 void* hz11_calloc(size_t count, size_t size) {
-  /* Route to system. The result is a system pointer; a later free misses the
-   * arena/token table and hits sys_free, which is correct. */
+  if (size != 0u && count > SIZE_MAX / size) {
+    errno = ENOMEM;
+    return NULL;
+  }
+#if HZ11_CLASSIFY_SPAN
+  size_t total = count * size;
+  if (total <= HZ11_MAX_CACHED_SIZE && !hz11_in_resolver()) {
+    H11ThreadCache* tc = hz11_thread_cache_get();
+    if (tc) {
+      return hz11_calloc_span_with_tc(tc, total);
+    }
+  }
+#endif
+  /* Token lane / large / resolver: route to system. The result is a system
+   * pointer; a later free misses the arena/token table and hits sys_free,
+   * which is correct. Large calloc keeps glibc's fresh-mmap zero skip. */
+#if HZ11_CLASSIFY_SPAN
   return hz11_sys_calloc(count, size);
+#else
+  return hz11_token_forget(hz11_sys_calloc(count, size));
+#endif
 }
 
 size_t hz11_malloc_usable_size(void* ptr) {
@@ -246,16 +320,87 @@ size_t hz11_malloc_usable_size(void* ptr) {
   return hz11_sys_usable_size(ptr);
 }
 
+#if HZ11_CLASSIFY_SPAN
+/* HZ11SpanBackedEntries-L1: aligned carving from spans. Slots sit at
+ * span_base + i * slot_size and every span base is page aligned, so every slot
+ * of a class whose slot size is a multiple of `alignment` is aligned. Pick the
+ * first such class that also fits `size` and allocate through the normal
+ * malloc path; free/usable_size/realloc then need nothing special. */
+#define HZ11_ALIGNED_SPAN_MAX 4096u
+
+static void* hz11_aligned_span(size_t alignment, size_t size) {
+  size_t want = size > alignment ? size : alignment;
+  if (alignment > HZ11_ALIGNED_SPAN_MAX || want > HZ11_MAX_CACHED_SIZE ||
+      hz11_in_resolver()) {
+    return NULL;
+  }
+  uint8_t class_id = hz11_size_class(want);
+  while (class_id < HZ11_CLASS_COUNT &&
+         (hz11_class_slot_size(class_id) & (alignment - 1u)) != 0u) {
+    class_id++;
+  }
+  if (class_id >= HZ11_CLASS_COUNT) {
+    return NULL;
+  }
+  void* p = hz11_malloc(hz11_class_slot_size(class_id));
+  if (p && ((uintptr_t)p & (alignment - 1u)) != 0u) {
+    hz11_free(p); /* arena-full system fallback: not aligned, use sys */
+    return NULL;
+  }
+  return p;
+}
+#endif
+
+static inline int hz11_is_pow2(size_t x) {
+  return x != 0u && (x & (x - 1u)) == 0u;
+}
+
 int hz11_posix_memalign(void** memptr, size_t alignment, size_t size) {
-  return hz11_sys_posix_memalign(memptr, alignment, size);
+  if (!hz11_is_pow2(alignment) || (alignment % sizeof(void*)) != 0u) {
+    return EINVAL;
+  }
+#if HZ11_CLASSIFY_SPAN
+  void* p = hz11_aligned_span(alignment, size);
+  if (p) {
+    *memptr = p;
+    return 0;
+  }
+#endif
+  int rc = hz11_sys_posix_memalign(memptr, alignment, size);
+#if !HZ11_CLASSIFY_SPAN
+  if (rc == 0) {
+    (void)hz11_token_forget(*memptr);
+  }
+#endif
+  return rc;
 }
 
 void* hz11_aligned_alloc(size_t alignment, size_t size) {
+#if HZ11_CLASSIFY_SPAN
+  if (hz11_is_pow2(alignment)) {
+    void* p = hz11_aligned_span(alignment, size);
+    if (p) {
+      return p;
+    }
+  }
   return hz11_sys_aligned_alloc(alignment, size);
+#else
+  return hz11_token_forget(hz11_sys_aligned_alloc(alignment, size));
+#endif
 }
 
 void* hz11_memalign(size_t alignment, size_t size) {
+#if HZ11_CLASSIFY_SPAN
+  if (hz11_is_pow2(alignment)) {
+    void* p = hz11_aligned_span(alignment, size);
+    if (p) {
+      return p;
+    }
+  }
   return hz11_sys_memalign(alignment, size);
+#else
+  return hz11_token_forget(hz11_sys_memalign(alignment, size));
+#endif
 }
 
 void hz11_stats(H11Stats* out) {
@@ -15,6 +15,8 @@
 
 char* hz11_arena_base = NULL;
 uint8_t hz11_span_class[HZ11_SPAN_COUNT]; /* BSS zero-fill == uncarved */
+uint8_t hz11_span_dirty[HZ11_SPAN_COUNT]; /* BSS zero-fill == never reused */
+H11ArenaSlot hz11_arena_top[HZ11_ARENA_TOP_SLOTS];
 static _Atomic uint64_t hz11_span_create_count;
 #ifndef HZ11_SPAN_RETURNED_DIAG
 #define HZ11_SPAN_RETURNED_DIAG 0
@@ -25,8 +27,18 @@ static _Atomic uint64_t hz11_returned_pop_hit_count;
 static _Atomic uint64_t hz11_returned_pop_miss_count;
 #endif
 
-static char* hz11_arena_end = NULL;
-static _Atomic(char*) hz11_span_cursor;
+/* Span ids run across arenas: arena = id / HZ11_SPAN_COUNT. Arena 0 is the
+ * primary. hz11_span_limit drops to the mapped span count when a new arena
+ * cannot be mapped, so later carves fail fast instead of retrying mmap. */
+#define HZ11_ARENA_SPAN_BITS (HZ11_ARENA_SHIFT - HZ11_SPAN_SHIFT)
+#define HZ11_ARENA_PROBE_KEYS 4096u /* 16 TiB of 4 GiB-aligned candidates */
+static char* hz11_arena_bases[HZ11_ARENA_MAX];
+static uint8_t* hz11_arena_tables[HZ11_ARENA_MAX];
+static _Atomic uint32_t hz11_arena_count;
+static _Atomic uint32_t hz11_span_next;
+static _Atomic uint32_t hz11_span_limit;
+static uintptr_t hz11_arena_probe_key;
+static HZ11_MUTEX hz11_arena_grow_lock;
 #if defined(_WIN32)
 static INIT_ONCE hz11_span_init_once = INIT_ONCE_STATIC_INIT;
 #else
@@ -46,7 +58,6 @@ static void hz11_span_init_real(void) {
                             MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
   if (!base) {
     hz11_arena_base = NULL;
-    hz11_arena_end = NULL;
     return;
   }
 #else
@@ -54,7 +65,6 @@ static void hz11_span_init_real(void) {
                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
   if (base == MAP_FAILED) {
     hz11_arena_base = NULL;
-    hz11_arena_end = NULL;
     return;
   }
 #if HZ11_ARENA_NOHUGEPAGE
@@ -62,8 +72,15 @@ static void hz11_span_init_real(void) {
 #endif
 #endif
   hz11_arena_base = (char*)base;
-  hz11_arena_end = hz11_arena_base + HZ11_ARENA_BYTES;
-  atomic_store_explicit(&hz11_span_cursor, hz11_arena_base, memory_order_relaxed);
+  hz11_arena_bases[0] = hz11_arena_base;
+  hz11_arena_tables[0] = hz11_span_class;
+  hz11_arena_probe_key = (uintptr_t)base >> HZ11_ARENA_SHIFT;
+  hz11_mutex_init(&hz11_arena_grow_lock);
+  atomic_store_explicit(&hz11_span_next, 0u, memory_order_relaxed);
+  atomic_store_explicit(&hz11_span_limit,
+                        (uint32_t)HZ11_ARENA_MAX << HZ11_ARENA_SPAN_BITS,
+                        memory_order_relaxed);
+  atomic_store_explicit(&hz11_arena_count, 1u, memory_order_release);
   for (uint32_t i = 0; i < HZ11_CLASS_COUNT; ++i) {
     hz11_mutex_init(&hz11_returned[i].lock);
     hz11_returned[i].head = NULL;
@@ -93,27 +110,134 @@ void hz11_span_init(void) {
 #endif
 }
 
+#if HZ11_ARENA_MAX > 1u
+/* Raw mapping helpers for the secondary arenas and their side tables. */
+static void* hz11_arena_map_at(void* hint, size_t bytes) {
+#if defined(_WIN32)
+  return VirtualAlloc(hint, (SIZE_T)bytes, MEM_RESERVE | MEM_COMMIT,
+                      PAGE_READWRITE);
+#else
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+  if (hint) {
+    flags |= MAP_FIXED_NOREPLACE;
+  }
+  void* p = mmap(hint, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+  if (p == MAP_FAILED) {
+    return NULL;
+  }
+  if (hint && p != hint) { /* pre-4.17 kernel treated the flag as a hint */
+    (void)munmap(p, bytes);
+    return NULL;
+  }
+  return p;
+#endif
+}
+
+static void hz11_arena_unmap(void* p, size_t bytes) {
+#if defined(_WIN32)
+  (void)bytes;
+  (void)VirtualFree(p, 0, MEM_RELEASE);
+#else
+  (void)munmap(p, bytes);
+#endif
+}
+
+/* Map one 4 GiB-aligned arena whose top-level slot is free. Probes downward
+ * from the last arena (the mmap area grows down), skipping occupied slots.
+ * Caller holds hz11_arena_grow_lock. */
+static int hz11_arena_map_secondary(uint32_t index) {
+  uint8_t* table = (uint8_t*)hz11_arena_map_at(NULL, 2u * HZ11_SPAN_COUNT);
+  if (!table) {
+    return 0;
+  }
+  uintptr_t key = hz11_arena_probe_key;
+  for (uint32_t probe = 0u; probe < HZ11_ARENA_PROBE_KEYS && key > 1u;
+       ++probe) {
+    key -= 1u;
+    H11ArenaSlot* slot = &hz11_arena_top[key & (HZ11_ARENA_TOP_SLOTS - 1u)];
+    if (slot->key != 0u) {
+      continue;
+    }
+    char* base = (char*)hz11_arena_map_at((void*)(key << HZ11_ARENA_SHIFT),
+                                          HZ11_ARENA_BYTES);
+    if (!base) {
+      continue;
+    }
+#if HZ11_ARENA_NOHUGEPAGE && !defined(_WIN32)
+    (void)madvise(base, HZ11_ARENA_BYTES, MADV_NOHUGEPAGE);
+#endif
+    hz11_arena_bases[index] = base;
+    hz11_arena_tables[index] = table;
+    hz11_arena_probe_key = key;
+    slot->span_class = table;
+    atomic_thread_fence(memory_order_release);
+    slot->key = key + 1u;
+    return 1;
+  }
+  hz11_arena_unmap(table, 2u * HZ11_SPAN_COUNT);
+  return 0;
+}
+#endif
+
+/* Make sure arena `index` is mapped. Returns 0 if it cannot be (VA exhausted,
+ * no free top-level slot nearby); the span limit is then pinned to what is
+ * mapped so every later carve returns NULL without retrying. */
+static int hz11_arena_ensure(uint32_t index) {
+  if (index < atomic_load_explicit(&hz11_arena_count, memory_order_acquire)) {
+    return 1;
+  }
+#if HZ11_ARENA_MAX > 1u
+  hz11_mutex_lock(&hz11_arena_grow_lock);
+  uint32_t count = atomic_load_explicit(&hz11_arena_count,
+                                        memory_order_relaxed);
+  while (count <= index) {
+    uint32_t limit = atomic_load_explicit(&hz11_span_limit,
+                                          memory_order_relaxed);
+    if (((uint32_t)count << HZ11_ARENA_SPAN_BITS) >= limit ||
+        !hz11_arena_map_secondary(count)) {
+      atomic_store_explicit(&hz11_span_limit,
+                            (uint32_t)count << HZ11_ARENA_SPAN_BITS,
+                            memory_order_relaxed);
+      break;
+    }
+    count += 1u;
+    atomic_store_explicit(&hz11_arena_count, count, memory_order_release);
+  }
+  hz11_mutex_unlock(&hz11_arena_grow_lock);
+  return index < count;
+#else
+  return 0;
+#endif
+}
+
 void* hz11_span_carve_for_class(uint8_t class_id) {
   hz11_span_init();
   if (!hz11_arena_base) {
     return NULL;
   }
-  for (;;) {
-    char* cur = atomic_load_explicit(&hz11_span_cursor, memory_order_relaxed);
-    if (cur + HZ11_SPAN_BYTES > hz11_arena_end) {
-      return NULL; /* arena full */
-    }
-    char* nxt = cur + HZ11_SPAN_BYTES;
-    if (atomic_compare_exchange_weak_explicit(&hz11_span_cursor, &cur, nxt,
-                                              memory_order_acq_rel,
-                                              memory_order_relaxed)) {
-      size_t id = ((size_t)(cur - hz11_arena_base)) >> HZ11_SPAN_SHIFT;
-      hz11_span_class[id] = (uint8_t)(class_id + 1u);
-      atomic_fetch_add_explicit(&hz11_span_create_count, 1u,
-                                memory_order_relaxed);
-      return cur;
+  uint32_t id = atomic_load_explicit(&hz11_span_next, memory_order_relaxed);
+  do {
+    if (id >= atomic_load_explicit(&hz11_span_limit, memory_order_relaxed)) {
+      return NULL; /* every arena full */
     }
+  } while (!atomic_compare_exchange_weak_explicit(&hz11_span_next, &id, id + 1u,
+                                                  memory_order_acq_rel,
+                                                  memory_order_relaxed));
+  uint32_t arena = id >> HZ11_ARENA_SPAN_BITS;
+  size_t local = (size_t)(id & (HZ11_SPAN_COUNT - 1u));
+  if (!hz11_arena_ensure(arena)) {
+    return NULL;
   }
+  hz11_arena_tables[arena][local] = (uint8_t)(class_id + 1u);
+  atomic_fetch_add_explicit(&hz11_span_create_count, 1u, memory_order_relaxed);
+  return hz11_arena_bases[arena] + (local << HZ11_SPAN_SHIFT);
+}
+
+uint32_t hz11_arena_count_load(void) {
+  return atomic_load_explicit(&hz11_arena_count, memory_order_acquire);
 }
 
 uint64_t hz11_span_create_count_load(void) {
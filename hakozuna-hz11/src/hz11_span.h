@@ -12,9 +12,38 @@
 
 #define HZ11_SPAN_SHIFT 16u
 #define HZ11_SPAN_BYTES (1ul << HZ11_SPAN_SHIFT)    /* 64 KiB */
-#define HZ11_ARENA_BYTES (1ull << 32)               /* 4 GiB virtual */
+#define HZ11_ARENA_SHIFT 32u
+#define HZ11_ARENA_BYTES (1ull << HZ11_ARENA_SHIFT) /* 4 GiB virtual */
 #define HZ11_SPAN_COUNT (HZ11_ARENA_BYTES >> HZ11_SPAN_SHIFT) /* 65536 */
 
+/* HZ11MultiArenaClassify-L1: the primary arena keeps the flat table above and
+ * its classify cost is unchanged. Once it is full, further 4 GiB arenas are
+ * mapped at 4 GiB-aligned addresses and published in a tiny direct-mapped
+ * top-level table keyed by ptr >> 32, so a non-primary pointer costs one extra
+ * load. HZ11_ARENA_MAX counts the primary. The NO-GO span return/reuse lanes
+ * index metadata by primary span id, so they stay single-arena. See
+ * docs/HZ11_MULTI_ARENA_CLASSIFY_L1.md. */
+#ifndef HZ11_ARENA_MAX
+#if HZ11_CENTRAL_SPAN_RETURN || HZ11_CENTRAL_SPAN_REUSE
+#define HZ11_ARENA_MAX 1u
+#else
+#define HZ11_ARENA_MAX 16u /* 64 GiB of span address space */
+#endif
+#endif
+#define HZ11_ARENA_TOP_SLOTS 64u
+#if HZ11_ARENA_MAX < 1u || HZ11_ARENA_MAX > HZ11_ARENA_TOP_SLOTS
+#error "HZ11_ARENA_MAX must be in 1..HZ11_ARENA_TOP_SLOTS"
+#endif
+
+/* One top-level slot per secondary arena. key is (base >> 32) + 1 so the
+ * zero-filled empty slot never matches a low (brk heap) pointer. span_class
+ * points at HZ11_SPAN_COUNT class bytes followed by HZ11_SPAN_COUNT dirty
+ * bytes for that arena. */
+typedef struct H11ArenaSlot {
+  uintptr_t key;
+  uint8_t* span_class;
+} H11ArenaSlot;
+
 #ifndef HZ11_ARENA_NOHUGEPAGE
 #define HZ11_ARENA_NOHUGEPAGE 0
 #endif
@@ -22,16 +51,41 @@
 /* State defined in hz11_span.c. */
 extern char* hz11_arena_base;
 extern uint8_t hz11_span_class[HZ11_SPAN_COUNT];
+/* HZ11SpanBackedEntries-L1: 1 once a span has been handed out a second time
+ * (span reuse). A span that is still 0 came straight off the arena cursor, so
+ * every slot past its owner's bump index is still the kernel's zero page. Read
+ * only by calloc; written only on the reuse path. */
+extern uint8_t hz11_span_dirty[HZ11_SPAN_COUNT];
+extern H11ArenaSlot hz11_arena_top[HZ11_ARENA_TOP_SLOTS];
 uint64_t hz11_span_create_count_load(void);
 uint64_t hz11_returned_push_count_load(void);
 uint64_t hz11_returned_pop_hit_count_load(void);
 uint64_t hz11_returned_pop_miss_count_load(void);
 
 void hz11_span_init(void); /* mmap the arena + init the returned sink (once) */
+uint32_t hz11_arena_count_load(void); /* mapped arenas, primary included */
+
+/* Secondary-arena lookup: the one extra load. NULL for anything that is not
+ * inside a published secondary arena. */
+static inline const H11ArenaSlot* hz11_arena_secondary(uintptr_t p) {
+#if HZ11_ARENA_MAX > 1u
+  uintptr_t hi = p >> HZ11_ARENA_SHIFT;
+  const H11ArenaSlot* s = &hz11_arena_top[hi & (HZ11_ARENA_TOP_SLOTS - 1u)];
+  return s->key == hi + 1u ? s : NULL;
+#else
+  (void)p;
+  return NULL;
+#endif
+}
+
+static inline size_t hz11_arena_local_span(uintptr_t p) {
+  return (size_t)((p >> HZ11_SPAN_SHIFT) & (HZ11_SPAN_COUNT - 1u));
+}
 
 /* Direct-index classify. Returns 1 and sets *class_id for a carved in-arena
- * pointer; 0 (miss) for uncarved / out-of-arena / foreign. ONE dependent load,
- * no hash. (Speed mode: an interior/stale/double-free in-arena pointer would
+ * pointer; 0 (miss) for uncarved / out-of-arena / foreign. ONE dependent load
+ * for the primary arena, one more (the top-level slot) for the others, no
+ * hash. (Speed mode: an interior/stale/double-free in-arena pointer would
  * also classify -- valid-C assumption; checked mode catches that later.) */
 static inline int hz11_span_classify(const void* ptr, uint8_t* class_id) {
   if (!hz11_arena_base) {
@@ -40,10 +94,16 @@ static inline int hz11_span_classify(const void* ptr, uint8_t* class_id) {
   uintptr_t p = (uintptr_t)ptr;
   uintptr_t base = (uintptr_t)hz11_arena_base;
   uintptr_t off = p - base;
-  if (p < base || off >= (uintptr_t)HZ11_ARENA_BYTES) {
-    return 0;
+  uint8_t c1;
+  if (p >= base && off < (uintptr_t)HZ11_ARENA_BYTES) {
+    c1 = hz11_span_class[(size_t)(off >> HZ11_SPAN_SHIFT)];
+  } else {
+    const H11ArenaSlot* s = hz11_arena_secondary(p);
+    if (!s) {
+      return 0;
+    }
+    c1 = s->span_class[hz11_arena_local_span(p)];
   }
-  uint8_t c1 = hz11_span_class[(size_t)(off >> HZ11_SPAN_SHIFT)];
   if (c1 == 0u) {
     return 0;
   }
@@ -58,11 +118,24 @@ static inline int hz11_arena_contains(const void* ptr) {
   uintptr_t p = (uintptr_t)ptr;
   uintptr_t base = (uintptr_t)hz11_arena_base;
   uintptr_t off = p - base;
-  return p >= base && off < (uintptr_t)HZ11_ARENA_BYTES;
+  return (p >= base && off < (uintptr_t)HZ11_ARENA_BYTES) ||
+         hz11_arena_secondary(p) != NULL;
+}
+
+static inline int hz11_span_is_zeroed(const void* span_base) {
+  uintptr_t p = (uintptr_t)span_base;
+  uintptr_t off = p - (uintptr_t)hz11_arena_base;
+  if (p >= (uintptr_t)hz11_arena_base && off < (uintptr_t)HZ11_ARENA_BYTES) {
+    return hz11_span_dirty[(size_t)(off >> HZ11_SPAN_SHIFT)] == 0u;
+  }
+  const H11ArenaSlot* s = hz11_arena_secondary(p);
+  return s && s->span_class[HZ11_SPAN_COUNT + hz11_arena_local_span(p)] == 0u;
 }
 
-/* Hand out a fresh 64 KiB span for a class (atomic arena bump), stamp its
- * span_class entry. Returns the span base, or NULL if the arena is full. */
+/* Hand out a fresh 64 KiB span for a class (atomic span-id bump across all
+ * arenas), stamp its span_class entry. Maps the next arena on demand. Returns
+ * the span base, or NULL once HZ11_ARENA_MAX arenas are full or a new arena
+ * cannot be mapped; callers already fall back to the system allocator. */
 void* hz11_span_carve_for_class(uint8_t class_id);
 
 /* Per-class global returned-object sink (the overflow target for arena
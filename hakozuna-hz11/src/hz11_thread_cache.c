@@ -526,6 +526,16 @@ static void hz11_thread_cache_flush_span_items(uint8_t class_id,
 }
 #endif
 
+#if HZ11_CACHE_BYTE_ACCOUNTING
+/* Flush-side uncharge. Saturates so a push that entered the cache without a
+ * matching charge can only leave cached_bytes low, never wrapped to ~SIZE_MAX
+ * (which would pin the refill byte_room at 0 for the rest of the thread). */
+static inline void hz11_thread_cache_uncharge(H11ThreadCache* tc,
+                                              size_t bytes) {
+  tc->cached_bytes = tc->cached_bytes > bytes ? tc->cached_bytes - bytes : 0u;
+}
+#endif
+
 static void hz11_thread_cache_flush_class(H11ThreadCache* tc, uint8_t class_id) {
 #if HZ11_CACHE_SOA
 #if HZ11_TRANSFER_CENTRAL_SPAN && HZ11_CLASSIFY_SPAN
@@ -543,7 +553,7 @@ static void hz11_thread_cache_flush_class(H11ThreadCache* tc, uint8_t class_id)
   }
   tc->class_counts[class_id] = 0u;
 #if HZ11_CACHE_BYTE_ACCOUNTING
-  tc->cached_bytes -= hz11_class_slot_size(class_id) * n;
+  hz11_thread_cache_uncharge(tc, hz11_class_slot_size(class_id) * n);
 #endif
 #else
   uint32_t n = tc->class_counts[class_id];
@@ -571,12 +581,14 @@ static void hz11_thread_cache_flush_class(H11ThreadCache* tc, uint8_t class_id)
 #endif
   tc->class_counts[class_id] = 0u;
 #if HZ11_CACHE_BYTE_ACCOUNTING
-  tc->cached_bytes -= hz11_class_slot_size(class_id) * n;
+  hz11_thread_cache_uncharge(tc, hz11_class_slot_size(class_id) * n);
 #endif
 #endif /* HZ11_TRANSFER_CENTRAL_SPAN */
 #else
   H11ClassCache* cc = &tc->class_cache[class_id];
+#if HZ11_CACHE_BYTE_ACCOUNTING
   size_t slot = hz11_class_slot_size(class_id);
+#endif
 #if HZ11_CACHE_TOPPTR
   void** p = cc->items;
   uint32_t n = (uint32_t)(cc->top - cc->items);
@@ -602,7 +614,9 @@ static void hz11_thread_cache_flush_class(H11ThreadCache* tc, uint8_t class_id)
   }
 #endif
   cc->top = cc->items;
-  tc->cached_bytes -= slot * n;
+#if HZ11_CACHE_BYTE_ACCOUNTING
+  hz11_thread_cache_uncharge(tc, slot * n);
+#endif
 #else
   HZ11_COUNT_ADD(tc->flush_items, cc->count);
 #if HZ11_RETURNED_PUSH_RANGE
@@ -625,7 +639,9 @@ static void hz11_thread_cache_flush_class(H11ThreadCache* tc, uint8_t class_id)
     cc->items[i] = NULL;
   }
 #endif
-  tc->cached_bytes -= slot * cc->count;
+#if HZ11_CACHE_BYTE_ACCOUNTING
+  hz11_thread_cache_uncharge(tc, slot * cc->count);
+#endif
   cc->count = 0;
 #endif
 #endif /* HZ11_CACHE_SOA */
@@ -653,9 +669,10 @@ void hz11_thread_cache_push_overflow_slow(H11ThreadCache* tc, uint8_t class_id,
     H11ClassCache* cc = &tc->class_cache[class_id];
 #if HZ11_CACHE_TOPPTR
     *cc->top++ = ptr;
-    tc->cached_bytes += hz11_class_slot_size(class_id);
 #else
     cc->items[cc->count++] = ptr;
+#endif
+#if HZ11_CACHE_BYTE_ACCOUNTING
     tc->cached_bytes += hz11_class_slot_size(class_id);
 #endif
 #endif /* HZ11_CACHE_SOA */
@@ -683,6 +700,9 @@ void* hz11_thread_cache_refill(H11ThreadCache* tc, uint8_t class_id) {
   } else {
     hz11_span_source_diag_transfer_refill(class_id, 0u);
     n = hz11_central_stack_remove_range(class_id, tmp, HZ11_TRANSFER_BATCH);
+    if (n == 0u) {
+      n = hz11_central_spill_remove_range(class_id, tmp, HZ11_TRANSFER_BATCH);
+    }
     if (n > 0u) {
       hz11_span_source_diag_central_refill(class_id, 1u);
       HZ11_COUNT_INC(tc->refill_from_central);
@@ -14,11 +14,13 @@
  * overflow flush, dlsym resolver) are out-of-line in hz11_thread_cache.c.
  *
  * Two classify lanes, selected by HZ11_CLASSIFY_SPAN:
- *  - 0 (L0, default): system-malloc backing + pointer->class token table.
- *  - 1 (L1): HZ11 arena/span backing + direct-index classify (hz11_span.h). */
+ *  - 0 (L0): system-malloc backing + pointer->class token table. Kept for the
+ *    token A/B siblings; it misses once the working set outgrows the table.
+ *  - 1 (L1, default since HZ11MultiArenaClassify-L1): HZ11 multi-arena span
+ *    backing + direct-index classify (hz11_span.h). */
 
 #ifndef HZ11_CLASSIFY_SPAN
-#define HZ11_CLASSIFY_SPAN 0
+#define HZ11_CLASSIFY_SPAN 1
 #endif
 
 /* HZ11StatsCompileGate-L1: hot-path counter increments are compile-time opt-in.
@@ -22,6 +22,10 @@ static _Atomic uint64_t hz11_central_partial_span_count;
 static _Atomic uint64_t hz11_central_object_count;
 static _Atomic uint64_t hz11_span_return_by_class[HZ11_CLASS_COUNT];
 static _Atomic uint64_t hz11_central_high_water_by_class[HZ11_CLASS_COUNT];
+static _Atomic uint64_t hz11_central_spill_count;
+/* Objects parked in the per-class returned sink by a full central stack.
+ * Refill only takes the sink lock while this is non-zero. */
+static _Atomic uint32_t hz11_central_spilled[HZ11_CLASS_COUNT];
 
 #if HZ11_TRANSFER_STATS
 #define HZ11_TRANSFER_STAT_ADD(counter, value) \
@@ -243,6 +247,32 @@ uint32_t hz11_central_stack_remove_range(uint8_t class_id, void** out, uint32_t
   return n;
 }
 
+static void hz11_central_spill(uint8_t class_id, void** items, uint32_t n) {
+  hz11_returned_push_range(class_id, items, n);
+  atomic_fetch_add_explicit(&hz11_central_spilled[class_id], n,
+                            memory_order_release);
+  HZ11_TRANSFER_STAT_ADD(hz11_central_spill_count, n);
+}
+
+uint32_t hz11_central_spill_remove_range(uint8_t class_id, void** out,
+                                         uint32_t max_n) {
+  if (class_id >= HZ11_CLASS_COUNT || !out || !max_n ||
+      atomic_load_explicit(&hz11_central_spilled[class_id],
+                           memory_order_acquire) == 0u) {
+    return 0u;
+  }
+  uint32_t n = hz11_returned_pop_range(class_id, out, max_n);
+  if (n > 0u) {
+    atomic_fetch_sub_explicit(&hz11_central_spilled[class_id], n,
+                              memory_order_relaxed);
+  }
+  return n;
+}
+
+uint64_t hz11_central_spill_count_load(void) {
+  return atomic_load_explicit(&hz11_central_spill_count, memory_order_relaxed);
+}
+
 void hz11_central_stack_insert_range(uint8_t class_id, void** items, uint32_t n) {
   if (class_id >= HZ11_CLASS_COUNT || !items || !n) {
     return;
@@ -279,9 +309,11 @@ void hz11_central_stack_insert_range(uint8_t class_id, void** items, uint32_t n)
 #if HZ11_CENTRAL_CLASS_DIAG
         hz11_central_stack_dump_class_stats();
 #endif
-        /* L1 has no span reclaim. A full central stack means the cap policy is wrong;
-         * fail fast instead of silently dropping arena objects. */
-        abort();
+        /* Full central stack: park the rest in the span lane's returned sink
+         * (unbounded intrusive list) instead of aborting. Spilled objects
+         * bypass the span-return meta, so their spans just stay active. */
+        hz11_central_spill(class_id, items + i, n - i);
+        return;
       }
     }
 #if HZ11_CENTRAL_SPAN_RETURN
@@ -438,6 +470,7 @@ void* hz11_span_return_pop_reusable_span(uint8_t class_id) {
     pthread_mutex_unlock(&hz11_span_return_meta_lock);
 #endif
 
+    hz11_span_dirty[span_id] = 1u; /* slots past bump now hold old data */
     atomic_fetch_add_explicit(&hz11_span_reuse_count, 1u, memory_order_relaxed);
     return hz11_arena_base + ((size_t)span_id << HZ11_SPAN_SHIFT);
   }
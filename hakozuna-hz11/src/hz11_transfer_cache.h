@@ -68,7 +68,13 @@ uint32_t hz11_transfer_insert_range(uint8_t class_id, void** items, uint32_t n);
 /* Central object stack: spill/reuse target when transfer cache is full.
  * Refill must check this BEFORE carving a fresh span. */
 uint32_t hz11_central_stack_remove_range(uint8_t class_id, void** out, uint32_t max_n);
+/* Never fails: once the stack is at HZ11_CENTRAL_CAP the remaining items spill
+ * to the per-class returned sink, which hz11_central_spill_remove_range()
+ * drains on refill before a fresh span is carved. */
 void hz11_central_stack_insert_range(uint8_t class_id, void** items, uint32_t n);
+uint32_t hz11_central_spill_remove_range(uint8_t class_id, void** out,
+                                         uint32_t max_n);
+uint64_t hz11_central_spill_count_load(void);
 
 uint64_t hz11_transfer_remove_hit_count_load(void);
 uint64_t hz11_transfer_remove_miss_count_load(void);
@@ -115,6 +121,10 @@ static inline uint32_t hz11_central_stack_remove_range(uint8_t c, void** o, uint
 static inline void hz11_central_stack_insert_range(uint8_t c, void** i, uint32_t n) {
   (void)c; (void)i; (void)n;
 }
+static inline uint32_t hz11_central_spill_remove_range(uint8_t c, void** o, uint32_t m) {
+  (void)c; (void)o; (void)m; return 0u;
+}
+static inline uint64_t hz11_central_spill_count_load(void) { return 0u; }
 static inline uint64_t hz11_transfer_remove_hit_count_load(void) { return 0u; }
 static inline uint64_t hz11_transfer_remove_miss_count_load(void) { return 0u; }
 static inline uint64_t hz11_transfer_insert_count_load(void) { return 0u; }
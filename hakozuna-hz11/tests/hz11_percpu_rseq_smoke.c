@@ -0,0 +1,169 @@
+/* HZ11PerCpuRseqSingleCommitCS-L2 smoke: hammer hz11_percpu_push/pop from more
+ * threads than CPUs so preemption and migration land inside the rseq critical
+ * sections. Every token is owned by exactly one party at a time (a thread or a
+ * per-CPU slab); an ownership byte flipped with atomic exchange catches a
+ * duplicated pop (lost commit) or a pop of a token that was never pushed (torn
+ * slot). A 50 us profiling timer keeps signals arriving so the kernel also
+ * aborts sequences on signal delivery, not only on preemption. Tokens are fake
+ * pointers; the per-CPU layer never dereferences them.
+ * If glibc has no rseq registration the layer self-disables and the smoke
+ * reports a skip. */
+#include "hz11_percpu_cache.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define SMOKE_THREADS 8u
+#define SMOKE_TOKENS 256u /* per thread */
+#define SMOKE_ROUNDS 200000u
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+  do {                                         \
+    if (!(cond)) {                             \
+      fprintf(stderr, "FAIL: %s\n", msg);      \
+      failures++;                              \
+    }                                          \
+  } while (0)
+
+/* 1 = token sits in a per-CPU slab, 0 = held by some thread. */
+static uint8_t in_cache[SMOKE_THREADS * SMOKE_TOKENS];
+static uint64_t bad_pop[SMOKE_THREADS];
+static uint64_t bad_push[SMOKE_THREADS];
+static uint64_t pushed[SMOKE_THREADS];
+static uint64_t popped[SMOKE_THREADS];
+
+static volatile sig_atomic_t ticks = 0;
+
+static void on_prof(int sig) {
+  (void)sig;
+  ticks = ticks + 1;
+}
+
+static void* token_ptr(uint32_t id) {
+  return (void*)(uintptr_t)(((uintptr_t)id + 1u) << 4);
+}
+
+static uint32_t token_id(void* p) {
+  return (uint32_t)(((uintptr_t)p >> 4) - 1u);
+}
+
+static void* worker(void* arg) {
+  uint32_t t = (uint32_t)(uintptr_t)arg;
+  uint32_t held[SMOKE_THREADS * SMOKE_TOKENS];
+  uint32_t nheld = 0;
+  for (uint32_t i = 0; i < SMOKE_TOKENS; ++i) {
+    held[nheld++] = t * SMOKE_TOKENS + i;
+  }
+  uint32_t rng = 0x9e3779b9u ^ (t * 7919u);
+  for (uint32_t round = 0; round < SMOKE_ROUNDS; ++round) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    uint8_t cid = (uint8_t)(rng % HZ11_PERCPU_NCLASSES);
+    if ((rng & 0x100u) && nheld > 0u) {
+      uint32_t id = held[nheld - 1u];
+      /* Hand the token to the cache first so a racing pop may claim it. */
+      if (__atomic_exchange_n(&in_cache[id], 1u, __ATOMIC_ACQ_REL) != 0u) {
+        bad_push[t]++;
+      }
+      if (hz11_percpu_push(cid, token_ptr(id))) {
+        nheld--;
+        pushed[t]++;
+      } else {
+        __atomic_store_n(&in_cache[id], 0u, __ATOMIC_RELEASE);
+      }
+    } else {
+      void* p = NULL;
+      if (hz11_percpu_pop(cid, &p)) {
+        uint32_t id = token_id(p);
+        if (id >= SMOKE_THREADS * SMOKE_TOKENS ||
+            __atomic_exchange_n(&in_cache[id], 0u, __ATOMIC_ACQ_REL) != 1u) {
+          bad_pop[t]++;
+        } else {
+          held[nheld++] = id;
+          popped[t]++;
+        }
+      }
+    }
+    if ((round & 1023u) == 0u) {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+int main(void) {
+  hz11_percpu_init();
+  if (!hz11_percpu_enabled()) {
+    printf("hz11 percpu rseq smoke: SKIP (rseq area not registered)\n");
+    return 0;
+  }
+
+  /* 1. single-thread LIFO: push then pop returns the same pointer. */
+  CHECK(hz11_percpu_push(0u, token_ptr(0u)), "push into empty slab");
+  void* p = NULL;
+  CHECK(hz11_percpu_pop(0u, &p) && p == token_ptr(0u), "pop returns pushed");
+  CHECK(!hz11_percpu_pop(HZ11_PERCPU_NCLASSES, &p) && p == NULL,
+        "ineligible class misses");
+
+  /* 2. slab bound: CAP pushes fit, the next one overflows to the caller. Stay
+   * on one CPU so the count is deterministic (a migration just splits the
+   * tokens across slabs, which the drain below tolerates). */
+  uint32_t ok = 0;
+  for (uint32_t i = 0; i < HZ11_PERCPU_CAP + 4u; ++i) {
+    ok += (uint32_t)hz11_percpu_push(1u, token_ptr(i));
+  }
+  CHECK(ok >= HZ11_PERCPU_CAP, "slab accepts CAP pushes");
+  uint32_t drained = 0;
+  while (hz11_percpu_pop(1u, &p)) {
+    drained++;
+  }
+  CHECK(drained <= ok, "drain never exceeds pushes");
+
+  /* 3. multi-thread ownership stress under a signal storm. */
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = on_prof;
+  sa.sa_flags = SA_RESTART;
+  sigaction(SIGPROF, &sa, NULL);
+  struct itimerval it = {{0, 50}, {0, 50}};
+  setitimer(ITIMER_PROF, &it, NULL);
+  pthread_t th[SMOKE_THREADS];
+  for (uint32_t t = 0; t < SMOKE_THREADS; ++t) {
+    CHECK(pthread_create(&th[t], NULL, worker, (void*)(uintptr_t)t) == 0,
+          "pthread_create");
+  }
+  uint64_t total_push = 0;
+  uint64_t total_pop = 0;
+  for (uint32_t t = 0; t < SMOKE_THREADS; ++t) {
+    pthread_join(th[t], NULL);
+    CHECK(bad_pop[t] == 0u, "no duplicate or foreign pop");
+    CHECK(bad_push[t] == 0u, "no push of a token already cached");
+    total_push += pushed[t];
+    total_pop += popped[t];
+  }
+  struct itimerval off = {{0, 0}, {0, 0}};
+  setitimer(ITIMER_PROF, &off, NULL);
+  CHECK(total_push >= total_pop, "pops never exceed pushes");
+  CHECK(total_push - total_pop <=
+            (uint64_t)HZ11_PERCPU_MAX_CPUS * HZ11_PERCPU_NCLASSES *
+                HZ11_PERCPU_CAP,
+        "residue fits the slabs");
+  CHECK(total_push > 0u && total_pop > 0u, "stress exercised the slabs");
+
+  if (failures) {
+    fprintf(stderr, "hz11 percpu rseq smoke: %d failure(s)\n", failures);
+    return 1;
+  }
+  printf("hz11 percpu rseq smoke: OK (push=%llu pop=%llu signals=%d)\n",
+         (unsigned long long)total_push, (unsigned long long)total_pop,
+         (int)ticks);
+  return 0;
+}
@@ -0,0 +1,140 @@
+/* HZ11MultiArenaClassify-L1 smoke: exhaust the primary 4 GiB arena, check that
+ * spans keep coming from 4 GiB-aligned secondary arenas that classify through
+ * the top-level table, that foreign/low pointers miss, and (HZ11_ARENA_MAX=2
+ * build) that exhausting every arena degrades to the system fallback instead
+ * of failing malloc. Carving only stamps the class table, so the virtual
+ * arenas stay untouched except for the few slots written below. */
+#include "hz11.h"
+#include "hz11_size_class.h"
+#include "hz11_span.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+  do {                                         \
+    if (!(cond)) {                             \
+      fprintf(stderr, "FAIL: %s\n", msg);      \
+      failures++;                              \
+    }                                          \
+  } while (0)
+
+static int in_primary(const void* p) {
+  uintptr_t a = (uintptr_t)p;
+  uintptr_t base = (uintptr_t)hz11_arena_base;
+  return a >= base && a - base < (uintptr_t)HZ11_ARENA_BYTES;
+}
+
+static void* carve_until_secondary(uint8_t class_id) {
+  for (uint64_t i = 0; i <= HZ11_SPAN_COUNT; ++i) {
+    void* span = hz11_span_carve_for_class(class_id);
+    if (!span) {
+      return NULL;
+    }
+    if (!in_primary(span)) {
+      return span;
+    }
+  }
+  return NULL;
+}
+
+int main(void) {
+  hz11_size_class_init();
+  hz11_span_init();
+  CHECK(hz11_arena_base != NULL, "primary arena mapped");
+  CHECK(hz11_arena_count_load() == 1u, "one arena before exhaustion");
+
+  /* 1. foreign and low pointers miss (empty top-level slots must not match a
+   * brk-range address). Classify never dereferences them. */
+  uint8_t cls = 0;
+  int local = 0;
+  CHECK(!hz11_span_classify(&local, &cls), "stack pointer misses");
+  CHECK(!hz11_span_classify((void*)(uintptr_t)0x601000u, &cls),
+        "low pointer misses");
+  CHECK(!hz11_arena_contains((void*)(uintptr_t)0x601000u),
+        "low pointer not contained");
+
+  /* 2. exhaust the primary: the next span comes from a secondary arena. */
+  void* span = carve_until_secondary(2u);
+  CHECK(span != NULL, "secondary span after primary exhaustion");
+  if (span) {
+    CHECK(hz11_arena_count_load() == 2u, "second arena mapped");
+    CHECK(((uintptr_t)span & (HZ11_ARENA_BYTES - 1u)) == 0u,
+          "secondary arena is 4 GiB aligned");
+    CHECK(hz11_span_classify(span, &cls) && cls == 2u,
+          "secondary span classifies");
+    CHECK(hz11_span_classify((char*)span + HZ11_SPAN_BYTES - 1u, &cls) &&
+              cls == 2u,
+          "secondary span tail classifies");
+    CHECK(!hz11_span_classify((char*)span + HZ11_SPAN_BYTES, &cls),
+          "uncarved secondary span misses");
+    CHECK(hz11_arena_contains(span), "secondary span contained");
+    CHECK(hz11_span_is_zeroed(span), "secondary span starts zeroed");
+  }
+
+  /* 3. the public entries work on secondary spans. A class with no current
+   * span yet must carve from the secondary arena. */
+  enum { N = 64 };
+  void* ptrs[N];
+  int secondary = 0;
+  for (int i = 0; i < N; ++i) {
+    ptrs[i] = hz11_malloc(4096);
+    CHECK(ptrs[i] != NULL, "malloc after primary exhaustion");
+    if (ptrs[i]) {
+      memset(ptrs[i], 0x5A, 4096);
+      secondary += !in_primary(ptrs[i]) && hz11_arena_contains(ptrs[i]);
+    }
+  }
+#if HZ11_ARENA_MAX > 2u
+  CHECK(secondary == N, "malloc served from the secondary arena");
+  for (int i = 0; i < N; ++i) {
+    CHECK(hz11_malloc_usable_size(ptrs[i]) == 4096u,
+          "secondary usable_size");
+  }
+#endif
+  for (int i = 0; i < N; ++i) {
+    hz11_free(ptrs[i]);
+  }
+  unsigned char* z = (unsigned char*)hz11_calloc(1u, 4000u);
+  CHECK(z != NULL, "calloc after primary exhaustion");
+  if (z) {
+    int zero = 1;
+    for (size_t i = 0; i < 4000u; ++i) {
+      zero &= z[i] == 0u;
+    }
+    CHECK(zero, "calloc zeroed on secondary arena");
+    hz11_free(z);
+  }
+
+#if HZ11_ARENA_MAX == 2u
+  /* 4. exhaust every arena: carve returns NULL, arena count stays put, and
+   * malloc of a class with no current span falls back to the system. */
+  uint64_t carved = 0;
+  while (hz11_span_carve_for_class(3u) != NULL) {
+    if (++carved > HZ11_SPAN_COUNT) {
+      break;
+    }
+  }
+  CHECK(carved <= HZ11_SPAN_COUNT, "carve stops at HZ11_ARENA_MAX");
+  CHECK(hz11_span_carve_for_class(3u) == NULL, "carve stays exhausted");
+  CHECK(hz11_arena_count_load() == 2u, "no arena past HZ11_ARENA_MAX");
+  void* fallback = hz11_malloc(20000);
+  CHECK(fallback != NULL, "malloc falls back once every arena is full");
+  if (fallback) {
+    CHECK(!hz11_arena_contains(fallback), "fallback is a system pointer");
+    memset(fallback, 0x33, 20000);
+    hz11_free(fallback);
+  }
+#endif
+
+  if (failures) {
+    fprintf(stderr, "hz11_span_arena_smoke: %d FAILURES\n", failures);
+    return 1;
+  }
+  fprintf(stderr, "hz11_span_arena_smoke ok (arenas=%u max=%u)\n",
+          hz11_arena_count_load(), (unsigned)HZ11_ARENA_MAX);
+  return 0;
+}
@@ -1,14 +1,19 @@
 /* HZ11ThreadCacheFastPath-L0 smoke: valid-C correctness for the front cache.
  * Exercises alloc across the size range, write/readback, LIFO reuse, refill,
- * realloc token bookkeeping (grow/shrink), large passthrough, and token
- * hit/miss. Asserts basic counter sanity. Does NOT test double-free / interior /
+ * realloc token bookkeeping (grow/shrink), large passthrough, token
+ * hit/miss, and the calloc/aligned entries. Asserts basic counter sanity. Does NOT test double-free / interior /
  * stale (speed-mode non-goals). */
 #include "hz11.h"
 #include "hz11_size_class.h"
+#include "hz11_thread_cache.h"
 
+#include <errno.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#if HZ11_CLASSIFY_SPAN
+#include "hz11_span.h"
+#endif
 
 static int failures = 0;
 
@@ -107,6 +112,114 @@ int main(void) {
   void* pz = hz11_realloc(pn, 0);
   CHECK(pz == NULL, "realloc(p,0) returns NULL");
 
+  /* 5a. HZ11SpanBackedEntries-L1: calloc zeroes reused slots, overflow fails,
+   * in-class realloc keeps the slot, aligned entries honor the alignment. In
+   * the span lane all of these must stay in the arena. */
+  for (int round = 0; round < 64; ++round) {
+    size_t n = 24u + (size_t)round * 40u;
+    uint8_t* d = (uint8_t*)hz11_malloc(n);
+    CHECK(d != NULL, "calloc dirty seed");
+    if (d) {
+      memset(d, 0xEE, n);
+      hz11_free(d);
+    }
+    uint8_t* z = (uint8_t*)hz11_calloc(1u, n);
+    CHECK(z != NULL, "calloc");
+    if (z) {
+      CHECK(ok_fill(z, n, 0u), "calloc zeroed (reused slot)");
+#if HZ11_CLASSIFY_SPAN
+      CHECK(hz11_arena_contains(z), "calloc served from arena");
+#endif
+      memset(z, 0xEE, n); /* leave it dirty for the next fresh-bump calloc */
+      hz11_free(z);
+    }
+  }
+  {
+    enum { CALLOC_FRESH_N = 300 };
+    void* fresh[CALLOC_FRESH_N];
+    for (int i = 0; i < CALLOC_FRESH_N; ++i) {
+      fresh[i] = hz11_calloc(4u, 60u);
+      CHECK(fresh[i] != NULL && ok_fill(fresh[i], 240u, 0u),
+            "calloc zeroed (bump slot)");
+      if (fresh[i]) {
+        memset(fresh[i], 0x77, 240u);
+      }
+    }
+    for (int i = 0; i < CALLOC_FRESH_N; ++i) {
+      hz11_free(fresh[i]);
+    }
+  }
+  errno = 0;
+  CHECK(hz11_calloc(SIZE_MAX / 2u, 4u) == NULL && errno == ENOMEM,
+        "calloc overflow -> NULL/ENOMEM");
+  {
+    void* big_z = hz11_calloc(2u, 70000u);
+    CHECK(big_z != NULL && ok_fill(big_z, 140000u, 0u), "large calloc zeroed");
+    hz11_free(big_z);
+  }
+  {
+    char* r0 = (char*)hz11_malloc(40);
+    CHECK(r0 != NULL, "in-class realloc seed");
+    memset(r0, 0x3C, 40);
+    char* r1 = (char*)hz11_realloc(r0, 60);
+    CHECK(r1 != NULL && ok_fill(r1, 40, 0x3C), "in-class realloc data");
+#if HZ11_CLASSIFY_SPAN
+    CHECK(r1 == r0, "in-class realloc keeps the slot");
+#endif
+    hz11_free(r1);
+  }
+  {
+    static const size_t aligns[] = {16, 32, 64, 128, 256, 1024, 4096, 8192};
+    for (size_t i = 0; i < sizeof(aligns) / sizeof(aligns[0]); ++i) {
+      size_t a = aligns[i];
+      void* m = NULL;
+      CHECK(hz11_posix_memalign(&m, a, 100) == 0 && m != NULL,
+            "posix_memalign");
+      CHECK(((uintptr_t)m & (a - 1u)) == 0u, "posix_memalign aligned");
+      CHECK(hz11_malloc_usable_size(m) >= 100u, "posix_memalign usable");
+      void* aa = hz11_aligned_alloc(a, a * 2u);
+      CHECK(aa != NULL && ((uintptr_t)aa & (a - 1u)) == 0u, "aligned_alloc");
+      void* ma = hz11_memalign(a, 24);
+      CHECK(ma != NULL && ((uintptr_t)ma & (a - 1u)) == 0u, "memalign");
+#if HZ11_CLASSIFY_SPAN
+      if (a <= 4096u) {
+        CHECK(hz11_arena_contains(m) && hz11_arena_contains(aa) &&
+                  hz11_arena_contains(ma),
+              "aligned entries served from arena");
+      }
+#endif
+      if (m) {
+        memset(m, 0x11, 100);
+      }
+      hz11_free(m);
+      hz11_free(aa);
+      hz11_free(ma);
+    }
+    void* bad = NULL;
+    CHECK(hz11_posix_memalign(&bad, 24, 64) == EINVAL,
+          "posix_memalign non-pow2 -> EINVAL");
+
+    /* Aligned frees past the class cap go through the overflow flush; the
+     * per-thread cached-byte count must stay within its cap, not wrap. */
+    enum { kAlignedChurn = 2 * HZ11_CACHE_CAP + 3 };
+    static void* held[kAlignedChurn];
+    for (int round = 0; round < 3; ++round) {
+      for (int i = 0; i < kAlignedChurn; ++i) {
+        held[i] = hz11_aligned_alloc(256u, 200u);
+        CHECK(held[i] != NULL, "aligned churn alloc");
+      }
+      for (int i = 0; i < kAlignedChurn; ++i) {
+        hz11_free(held[i]);
+      }
+    }
+#if HZ11_CACHE_BYTE_ACCOUNTING
+    H11Stats cs;
+    hz11_stats(&cs);
+    CHECK(cs.cached_bytes <= HZ11_MAX_CACHED_BYTES,
+          "cached_bytes within cap after aligned churn");
+#endif
+  }
+
   /* 5b. exhaustive 1..65536 size-class check.
    * HZ11SizeTableStaticInit-L1: verify the initialized table matches the
    * formula for EVERY size, catching table corruption or future class-map
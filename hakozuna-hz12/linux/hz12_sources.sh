@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+
+# Shared Linux build manifest for HZ12 ad-hoc build scripts.
+# Callers must set HZ12_DIR before sourcing this file.
+
+HZ12_INCLUDES=(
+  "${HZ12_DIR}/include"
+  "${HZ12_DIR}/src"
+)
+
+HZ12_LIB_SOURCES=(
+  "${HZ12_DIR}/src/hz12_current_span_install.c"
+  "${HZ12_DIR}/src/hz12_flush_owner_route.c"
+  "${HZ12_DIR}/src/hz12_live_footprint.c"
+  "${HZ12_DIR}/src/hz12_owner_epoch.c"
+  "${HZ12_DIR}/src/hz12_owner_registry.c"
+  "${HZ12_DIR}/src/hz12_owner_retire_gate.c"
+  "${HZ12_DIR}/src/hz12_public_entry.c"
+  "${HZ12_DIR}/src/hz12_reclaim_entry.c"
+  "${HZ12_DIR}/src/hz12_reclaim_policy_shadow.c"
+  "${HZ12_DIR}/src/hz12_shadow.c"
+  "${HZ12_DIR}/src/hz12_size_class.c"
+  "${HZ12_DIR}/src/hz12_snapshot_reclaim.c"
+  "${HZ12_DIR}/src/hz12_snapshot_recycle.c"
+  "${HZ12_DIR}/src/hz12_span.c"
+  "${HZ12_DIR}/src/hz12_span_backing.c"
+  "${HZ12_DIR}/src/hz12_span_depot_core.c"
+  "${HZ12_DIR}/src/hz12_span_owner_shadow.c"
+  "${HZ12_DIR}/src/hz12_sys_alloc.c"
+  "${HZ12_DIR}/src/hz12_thread_cache.c"
+  "${HZ12_DIR}/src/hz12_thread_cache_diag.c"
+  "${HZ12_DIR}/src/hz12_token_inbox.c"
+)
+
+# Retirement-turnover lane: classified spans with owner-routed flush.
+HZ12_LANE_CFLAGS=(
+  -DNDEBUG
+  -DHZ12_CLASSIFY_SPAN=1
+  -DHZ12_CACHE_CAP=256
+  -DHZ12_FLUSH_OWNER_ROUTE=1
+  -DHZ12_FLUSH_OWNER_COLD_SPAN=1
+  -DHZ12_FLUSH_OWNER_INBOX_CAP=2048
+)
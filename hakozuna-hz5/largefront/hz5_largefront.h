@@ -2,6 +2,7 @@
 #define HZ5_LARGEFRONT_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,11 +14,22 @@ typedef enum Hz5LargeFrontFreeResult {
   HZ5_LARGEFRONT_FREE_INVALID = 2
 } Hz5LargeFrontFreeResult;
 
+// Slow-path counters plus live span bytes; all zero unless
+// BENCHLAB_HZ5_PROFILE_ADAPTIVE.
+typedef struct Hz5LargeFrontStatsSnapshot {
+  uint64_t source_refills;
+  uint64_t source_spans;
+  uint64_t mapped_bytes;  // cumulative; source mappings are never unmapped
+  uint64_t remote_spans;  // spans returned to an owner by inbox drain
+  uint64_t live_bytes;    // spans handed out and not yet freed
+} Hz5LargeFrontStatsSnapshot;
+
 void* hz5_largefront_alloc(size_t size, size_t align);
 Hz5LargeFrontFreeResult hz5_largefront_free(void* ptr);
 int hz5_largefront_can_handle(size_t size, size_t align);
 int hz5_largefront_owns(void* ptr);
 size_t hz5_largefront_usable_size(void* ptr);
+void hz5_largefront_stats_snapshot(Hz5LargeFrontStatsSnapshot* snapshot);
 
 #ifdef __cplusplus
 }
@@ -2,6 +2,7 @@
 #define HZ5_MIDPAGEFRONT_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,6 +24,14 @@ typedef struct Hz5MidPageFrontTag {
   void* page;
 } Hz5MidPageFrontTag;
 
+// Cumulative slow-path counters; all zero unless BENCHLAB_HZ5_PROFILE_ADAPTIVE.
+// (pages_out - pages_released) * page_bytes approximates resident slabs.
+typedef struct Hz5MidPageFrontStatsSnapshot {
+  uint64_t pages_out;       // slabs handed to an owner by new-page refill
+  uint64_t pages_released;  // empty slabs returned with MADV_DONTNEED
+  uint64_t page_bytes;
+} Hz5MidPageFrontStatsSnapshot;
+
 void* hz5_midpagefront_alloc(size_t size, size_t align);
 Hz5MidPageFrontAllocResult hz5_midpagefront_try_alloc(size_t size,
                                                       size_t align,
@@ -37,6 +46,7 @@ int hz5_midpagefront_owns(void* ptr);
 size_t hz5_midpagefront_usable_size(void* ptr);
 void hz5_midpagefront_owner_drain_some(unsigned budget);
 size_t hz5_midpagefront_release_retired(void);
+void hz5_midpagefront_stats_snapshot(Hz5MidPageFrontStatsSnapshot* snapshot);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,368 @@
+#include "hz5_profile.h"
+
+#if BENCHLAB_HZ5_RUNTIME_PROFILE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef HZ5_PROFILE_FILE_MAX_BYTES
+#define HZ5_PROFILE_FILE_MAX_BYTES 4096u
+#endif
+
+// Mirrors the saved aliases in linux/hz5_build_profile_aliases.sh.
+static const Hz5ProfileConfig g_hz5_profile_presets[HZ5_PROFILE_COUNT] = {
+    [HZ5_PROFILE_PAGERUN64_MAIN] = {HZ5_PROFILE_PAGERUN64_MAIN,
+                                    HZ5_PROFILE_FREE_MIDPAGE_FIRST, 16u, 0u,
+                                    4096u},
+    [HZ5_PROFILE_PAGERUN64_CROSS128] = {HZ5_PROFILE_PAGERUN64_CROSS128,
+                                        HZ5_PROFILE_FREE_MIDPAGE_FIRST, 16u,
+                                        1u, 4096u},
+    [HZ5_PROFILE_LARGE128_RSS] = {HZ5_PROFILE_LARGE128_RSS,
+                                  HZ5_PROFILE_FREE_LARGE_FIRST, 4u, 1u,
+                                  4096u},
+    [HZ5_PROFILE_LARGE128_SOURCE16] = {HZ5_PROFILE_LARGE128_SOURCE16,
+                                       HZ5_PROFILE_FREE_LARGE_FIRST, 16u, 1u,
+                                       4096u},
+};
+
+static const char* const g_hz5_profile_names[HZ5_PROFILE_COUNT] = {
+    [HZ5_PROFILE_PAGERUN64_MAIN] = "pagerun64-main",
+    [HZ5_PROFILE_PAGERUN64_CROSS128] = "pagerun64-cross128",
+    [HZ5_PROFILE_LARGE128_RSS] = "large128-rss",
+    [HZ5_PROFILE_LARGE128_SOURCE16] = "large128-source16",
+};
+
+// Valid before init so front-ends used ahead of the constructor see the
+// pagerun64-main values rather than zeros.
+Hz5ProfileConfig g_hz5_profile = {HZ5_PROFILE_PAGERUN64_MAIN,
+                                  HZ5_PROFILE_FREE_MIDPAGE_FIRST, 16u, 0u,
+                                  4096u};
+
+static int g_hz5_profile_inited;
+
+enum {
+  HZ5_PROFILE_KNOB_FREE_ORDER = 1u << 0,
+  HZ5_PROFILE_KNOB_LARGE_SOURCE_BATCH = 1u << 1,
+  HZ5_PROFILE_KNOB_LARGE_TAKE_FIRST = 1u << 2,
+  HZ5_PROFILE_KNOB_MIDPAGE_RETAIN_CAP = 1u << 3
+};
+
+// Knobs set explicitly by the file or environment, and their values. Written
+// by hz5_profile_init() only.
+static uint32_t g_hz5_profile_pinned;
+static Hz5ProfileConfig g_hz5_profile_pinned_cfg;
+
+const char* hz5_profile_name(uint32_t id) {
+  return id < (uint32_t)HZ5_PROFILE_COUNT ? g_hz5_profile_names[id]
+                                          : "unknown";
+}
+
+static int hz5_profile_token_eq(const char* s, size_t len, const char* lit) {
+  size_t lit_len = strlen(lit);
+  return len == lit_len && memcmp(s, lit, len) == 0;
+}
+
+static int hz5_profile_lookup(const char* s, size_t len, uint32_t* id_out) {
+  for (uint32_t i = 0; i < (uint32_t)HZ5_PROFILE_COUNT; ++i) {
+    if (hz5_profile_token_eq(s, len, g_hz5_profile_names[i])) {
+      *id_out = i;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int hz5_profile_parse_u32(const char* s, size_t len, uint32_t* out) {
+  if (len == 0 || len > 10u) {
+    return 0;
+  }
+  uint64_t value = 0;
+  for (size_t i = 0; i < len; ++i) {
+    if (s[i] < '0' || s[i] > '9') {
+      return 0;
+    }
+    value = value * 10u + (uint64_t)(s[i] - '0');
+  }
+  if (value > UINT32_MAX) {
+    return 0;
+  }
+  *out = (uint32_t)value;
+  return 1;
+}
+
+static void hz5_profile_reject(const char* source,
+                               const char* key,
+                               size_t key_len,
+                               const char* value,
+                               size_t value_len) {
+  fprintf(stderr, "[HZ5_PROFILE] ignored %s %.*s=%.*s\n", source,
+          (int)key_len, key, (int)value_len, value);
+}
+
+// Returns the knob bit, or 0 for an unknown key or an invalid value (cfg is
+// left unchanged).
+static uint32_t hz5_profile_apply_knob(Hz5ProfileConfig* cfg,
+                                  const char* key,
+                                  size_t key_len,
+                                  const char* value,
+                                  size_t value_len) {
+  uint32_t v = 0;
+  if (hz5_profile_token_eq(key, key_len, "free_order")) {
+    if (hz5_profile_token_eq(value, value_len, "midpage")) {
+      cfg->free_order = HZ5_PROFILE_FREE_MIDPAGE_FIRST;
+      return HZ5_PROFILE_KNOB_FREE_ORDER;
+    }
+    if (hz5_profile_token_eq(value, value_len, "large")) {
+      cfg->free_order = HZ5_PROFILE_FREE_LARGE_FIRST;
+      return HZ5_PROFILE_KNOB_FREE_ORDER;
+    }
+    return 0;
+  }
+  if (!hz5_profile_parse_u32(value, value_len, &v)) {
+    return 0;
+  }
+  if (hz5_profile_token_eq(key, key_len, "large_source_batch")) {
+    if (v == 0u || v > HZ5_PROFILE_LARGE_SOURCE_BATCH_MAX) {
+      return 0;
+    }
+    cfg->largefront_source_batch_count = v;
+    return HZ5_PROFILE_KNOB_LARGE_SOURCE_BATCH;
+  }
+  if (hz5_profile_token_eq(key, key_len, "large_take_first")) {
+    if (v > 1u) {
+      return 0;
+    }
+    cfg->largefront_drain_take_first = v;
+    return HZ5_PROFILE_KNOB_LARGE_TAKE_FIRST;
+  }
+  if (hz5_profile_token_eq(key, key_len, "midpage_retain_cap")) {
+    cfg->midpage_empty_retain_cap = v;
+    return HZ5_PROFILE_KNOB_MIDPAGE_RETAIN_CAP;
+  }
+  return 0;
+}
+
+static void hz5_profile_trim(const char** s, size_t* len) {
+  while (*len != 0 && (**s == ' ' || **s == '\t')) {
+    ++*s;
+    --*len;
+  }
+  while (*len != 0 && ((*s)[*len - 1u] == ' ' || (*s)[*len - 1u] == '\t' ||
+                       (*s)[*len - 1u] == '\r')) {
+    --*len;
+  }
+}
+
+typedef void (*Hz5ProfileLineFn)(Hz5ProfileConfig* cfg,
+                                 const char* key,
+                                 size_t key_len,
+                                 const char* value,
+                                 size_t value_len);
+
+static void hz5_profile_for_each_line(const char* buf,
+                                      size_t len,
+                                      Hz5ProfileConfig* cfg,
+                                      Hz5ProfileLineFn fn) {
+  size_t pos = 0;
+  while (pos < len) {
+    const char* line = buf + pos;
+    const char* nl = memchr(line, '\n', len - pos);
+    size_t line_len = nl ? (size_t)(nl - line) : len - pos;
+    pos += line_len + 1u;
+
+    const char* hash = memchr(line, '#', line_len);
+    if (hash) {
+      line_len = (size_t)(hash - line);
+    }
+    const char* eq = memchr(line, '=', line_len);
+    if (!eq) {
+      continue;
+    }
+    const char* key = line;
+    size_t key_len = (size_t)(eq - line);
+    const char* value = eq + 1;
+    size_t value_len = line_len - key_len - 1u;
+    hz5_profile_trim(&key, &key_len);
+    hz5_profile_trim(&value, &value_len);
+    if (key_len != 0) {
+      fn(cfg, key, key_len, value, value_len);
+    }
+  }
+}
+
+static void hz5_profile_file_preset(Hz5ProfileConfig* cfg,
+                                    const char* key,
+                                    size_t key_len,
+                                    const char* value,
+                                    size_t value_len) {
+  if (!hz5_profile_token_eq(key, key_len, "profile")) {
+    return;
+  }
+  uint32_t id = 0;
+  if (hz5_profile_lookup(value, value_len, &id)) {
+    *cfg = g_hz5_profile_presets[id];
+  } else {
+    hz5_profile_reject("file", key, key_len, value, value_len);
+  }
+}
+
+static void hz5_profile_file_knob(Hz5ProfileConfig* cfg,
+                                  const char* key,
+                                  size_t key_len,
+                                  const char* value,
+                                  size_t value_len) {
+  if (hz5_profile_token_eq(key, key_len, "profile")) {
+    return;
+  }
+  uint32_t knob = hz5_profile_apply_knob(cfg, key, key_len, value, value_len);
+  if (knob) {
+    g_hz5_profile_pinned |= knob;
+  } else {
+    hz5_profile_reject("file", key, key_len, value, value_len);
+  }
+}
+
+// Runs from a constructor: plain read(2) into a stack buffer, no malloc.
+static size_t hz5_profile_read_file(const char* path, char* buf, size_t cap) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    fprintf(stderr, "[HZ5_PROFILE] cannot open %s\n", path);
+    return 0;
+  }
+  size_t used = 0;
+  while (used < cap) {
+    ssize_t n = read(fd, buf + used, cap - used);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    used += (size_t)n;
+  }
+  close(fd);
+  return used;
+}
+
+void hz5_profile_init(void) {
+  static const struct {
+    const char* env;
+    const char* key;
+  } knob_env[] = {
+      {"HZ5_PROFILE_FREE_ORDER", "free_order"},
+      {"HZ5_PROFILE_LARGE_SOURCE_BATCH", "large_source_batch"},
+      {"HZ5_PROFILE_LARGE_TAKE_FIRST", "large_take_first"},
+      {"HZ5_PROFILE_MIDPAGE_RETAIN_CAP", "midpage_retain_cap"},
+  };
+
+  if (g_hz5_profile_inited) {
+    return;
+  }
+  g_hz5_profile_inited = 1;
+
+  Hz5ProfileConfig cfg = g_hz5_profile_presets[HZ5_PROFILE_DEFAULT_ID];
+  char file_buf[HZ5_PROFILE_FILE_MAX_BYTES];
+  size_t file_len = 0;
+  const char* path = getenv("HZ5_PROFILE_FILE");
+  if (path && path[0] != '\0') {
+    file_len = hz5_profile_read_file(path, file_buf, sizeof(file_buf));
+  }
+
+  const char* name = getenv("HZ5_PROFILE");
+  if (name && name[0] != '\0') {
+    uint32_t id = 0;
+    if (hz5_profile_lookup(name, strlen(name), &id)) {
+      cfg = g_hz5_profile_presets[id];
+    } else {
+      hz5_profile_reject("env", "HZ5_PROFILE", strlen("HZ5_PROFILE"), name,
+                         strlen(name));
+    }
+  } else {
+    hz5_profile_for_each_line(file_buf, file_len, &cfg,
+                              hz5_profile_file_preset);
+  }
+  hz5_profile_for_each_line(file_buf, file_len, &cfg, hz5_profile_file_knob);
+
+  for (size_t i = 0; i < sizeof(knob_env) / sizeof(knob_env[0]); ++i) {
+    const char* value = getenv(knob_env[i].env);
+    if (!value) {
+      continue;
+    }
+    uint32_t knob = hz5_profile_apply_knob(&cfg, knob_env[i].key,
+                                           strlen(knob_env[i].key), value,
+                                           strlen(value));
+    if (knob) {
+      g_hz5_profile_pinned |= knob;
+    } else {
+      hz5_profile_reject("env", knob_env[i].env, strlen(knob_env[i].env),
+                         value, strlen(value));
+    }
+  }
+  g_hz5_profile_pinned_cfg = cfg;
+  g_hz5_profile = cfg;
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE
+  hz5_profile_adapt_init();
+#endif
+}
+
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE
+void hz5_profile_switch(uint32_t id, uint32_t retain_cap_limit) {
+  if (id >= (uint32_t)HZ5_PROFILE_COUNT) {
+    return;
+  }
+  Hz5ProfileConfig next = g_hz5_profile_presets[id];
+  const Hz5ProfileConfig* pin = &g_hz5_profile_pinned_cfg;
+  if (g_hz5_profile_pinned & HZ5_PROFILE_KNOB_FREE_ORDER) {
+    next.free_order = pin->free_order;
+  }
+  if (g_hz5_profile_pinned & HZ5_PROFILE_KNOB_LARGE_SOURCE_BATCH) {
+    next.largefront_source_batch_count = pin->largefront_source_batch_count;
+  }
+  if (g_hz5_profile_pinned & HZ5_PROFILE_KNOB_LARGE_TAKE_FIRST) {
+    next.largefront_drain_take_first = pin->largefront_drain_take_first;
+  }
+  if (g_hz5_profile_pinned & HZ5_PROFILE_KNOB_MIDPAGE_RETAIN_CAP) {
+    next.midpage_empty_retain_cap = pin->midpage_empty_retain_cap;
+  } else if (next.midpage_empty_retain_cap > retain_cap_limit) {
+    next.midpage_empty_retain_cap = retain_cap_limit;
+  }
+  __atomic_store_n(&g_hz5_profile.free_order, next.free_order,
+                   __ATOMIC_RELAXED);
+  __atomic_store_n(&g_hz5_profile.largefront_source_batch_count,
+                   next.largefront_source_batch_count, __ATOMIC_RELAXED);
+  __atomic_store_n(&g_hz5_profile.largefront_drain_take_first,
+                   next.largefront_drain_take_first, __ATOMIC_RELAXED);
+  __atomic_store_n(&g_hz5_profile.midpage_empty_retain_cap,
+                   next.midpage_empty_retain_cap, __ATOMIC_RELAXED);
+  __atomic_store_n(&g_hz5_profile.id, next.id, __ATOMIC_RELAXED);
+}
+#endif
+
+void hz5_profile_print(void) {
+  fprintf(stderr,
+          "[HZ5_PROFILE] profile=%s free_order=%s large_source_batch=%u"
+          " large_take_first=%u midpage_retain_cap=%u\n",
+          hz5_profile_name(g_hz5_profile.id),
+          g_hz5_profile.free_order == HZ5_PROFILE_FREE_LARGE_FIRST
+              ? "large"
+              : "midpage",
+          g_hz5_profile.largefront_source_batch_count,
+          g_hz5_profile.largefront_drain_take_first,
+          g_hz5_profile.midpage_empty_retain_cap);
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE
+  hz5_profile_adapt_print();
+#endif
+}
+
+// The standalone library has no preload constructor; the preload one calls
+// hz5_profile_init() itself, whichever runs first wins.
+__attribute__((constructor)) static void hz5_profile_constructor(void) {
+  hz5_profile_init();
+}
+
+#endif
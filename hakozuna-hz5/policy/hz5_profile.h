@@ -0,0 +1,101 @@
+#ifndef HZ5_PROFILE_H
+#define HZ5_PROFILE_H
+
+#include <stdint.h>
+
+#ifndef BENCHLAB_HZ5_RUNTIME_PROFILE
+#define BENCHLAB_HZ5_RUNTIME_PROFILE 0
+#endif
+
+#ifndef BENCHLAB_HZ5_PROFILE_ADAPTIVE
+#define BENCHLAB_HZ5_PROFILE_ADAPTIVE 0
+#endif
+
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE && !BENCHLAB_HZ5_RUNTIME_PROFILE
+#error "HZ5 adaptive profile requires BENCHLAB_HZ5_RUNTIME_PROFILE"
+#endif
+
+/*
+ * ProfileSelectBox.
+ *
+ * One full-preload build carries the union of the saved PageRun64 /
+ * LargeFront128 structure. The knobs that differ between the saved profiles
+ * are read from g_hz5_profile instead of compile-time constants. The table is
+ * patched once before the allocator is marked ready and is read-only after
+ * that, so hot paths see a plain load and a well-predicted branch, never an
+ * indirect call.
+ *
+ * Selection, applied in this order:
+ *   1. preset: HZ5_PROFILE=<name>, else `profile=<name>` in the file,
+ *      else HZ5_PROFILE_DEFAULT_ID
+ *   2. HZ5_PROFILE_FILE=<path>: `key=value` lines, '#' comments
+ *   3. HZ5_PROFILE_<KEY>=<value>: per-knob environment override
+ * Keys: free_order, large_source_batch, large_take_first, midpage_retain_cap.
+ * Unknown names and out-of-range values are reported and ignored.
+ *
+ * ProfileAdaptBox (BENCHLAB_HZ5_PROFILE_ADAPTIVE=1) keeps rewriting the table
+ * after start: front slow paths call hz5_profile_adapt_tick(), which samples
+ * the LowPage/MidPage/LargeFront stats snapshots once per window and moves to
+ * another preset only after it wins several windows in a row. Knobs set by the
+ * file or environment stay pinned across switches. Each knob is valid on its
+ * own, so readers may see a mix of two presets for one window; they load with
+ * HZ5_PROFILE_GET() so the adaptive lane has no data race on the table.
+ */
+
+typedef enum Hz5ProfileId {
+  HZ5_PROFILE_PAGERUN64_MAIN = 0,
+  HZ5_PROFILE_PAGERUN64_CROSS128,
+  HZ5_PROFILE_LARGE128_RSS,
+  HZ5_PROFILE_LARGE128_SOURCE16,
+  HZ5_PROFILE_COUNT
+} Hz5ProfileId;
+
+#ifndef HZ5_PROFILE_DEFAULT_ID
+#define HZ5_PROFILE_DEFAULT_ID HZ5_PROFILE_PAGERUN64_MAIN
+#endif
+
+#ifndef HZ5_PROFILE_LARGE_SOURCE_BATCH_MAX
+#define HZ5_PROFILE_LARGE_SOURCE_BATCH_MAX 64u
+#endif
+
+typedef enum Hz5ProfileFreeOrder {
+  HZ5_PROFILE_FREE_MIDPAGE_FIRST = 0,
+  HZ5_PROFILE_FREE_LARGE_FIRST = 1
+} Hz5ProfileFreeOrder;
+
+typedef struct Hz5ProfileConfig {
+  uint32_t id;
+  uint32_t free_order;
+  uint32_t largefront_source_batch_count;
+  uint32_t largefront_drain_take_first;
+  uint32_t midpage_empty_retain_cap;
+} Hz5ProfileConfig;
+
+#if BENCHLAB_HZ5_RUNTIME_PROFILE
+extern Hz5ProfileConfig g_hz5_profile;
+
+void hz5_profile_init(void);
+const char* hz5_profile_name(uint32_t id);
+void hz5_profile_print(void);
+#else
+static inline void hz5_profile_init(void) {}
+static inline void hz5_profile_print(void) {}
+#endif
+
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE
+#define HZ5_PROFILE_GET(field) \
+  __atomic_load_n(&g_hz5_profile.field, __ATOMIC_RELAXED)
+
+// Moves g_hz5_profile to preset `id`, keeping pinned knobs; the MidPage retain
+// cap is clamped to retain_cap_limit unless it is pinned.
+void hz5_profile_switch(uint32_t id, uint32_t retain_cap_limit);
+void hz5_profile_adapt_init(void);
+void hz5_profile_adapt_tick(void);
+void hz5_profile_adapt_print(void);
+#else
+#define HZ5_PROFILE_GET(field) (g_hz5_profile.field)
+
+static inline void hz5_profile_adapt_tick(void) {}
+#endif
+
+#endif
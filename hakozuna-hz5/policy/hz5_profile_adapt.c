@@ -0,0 +1,289 @@
+#include "hz5_profile.h"
+
+#if BENCHLAB_HZ5_PROFILE_ADAPTIVE
+
+#include "hz5_largefront.h"
+#include "hz5_lowpage64_p43_segment.h"
+#include "hz5_midpagefront.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * ProfileAdaptBox.
+ *
+ * Windowed controller over the runtime profile table. Ticks come only from
+ * front slow paths (LargeFront source refill / owner drain, MidPage new page);
+ * malloc/free fast paths never enter here. A tick costs one TLS increment;
+ * every HZ5_PROFILE_ADAPT_TICK_EVENTS ticks it reads the clock, and once per
+ * interval one thread (trylock) samples the stats snapshots and votes:
+ *
+ *   idle   (< min events in the window)           keep current preset
+ *   large  (LargeFront events >= MidPage events)  large128-source16, or
+ *                                                 large128-rss under pressure
+ *   mid    (remote LargeFront share >= 1/N)       pagerun64-cross128
+ *   mid                                           pagerun64-main
+ *
+ * Pressure is a footprint watermark pair (LargeFront mapped + MidPage slabs
+ * out + LowPage committed slots): on at >= high, off below 3/4 high. While on,
+ * the MidPage retain cap is clamped. A new preset must win `confirm`
+ * consecutive non-idle windows before it is applied.
+ */
+
+#ifndef HZ5_PROFILE_ADAPT_TICK_EVENTS
+#define HZ5_PROFILE_ADAPT_TICK_EVENTS 8u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_INTERVAL_MS
+#define HZ5_PROFILE_ADAPT_INTERVAL_MS 100u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_CONFIRM
+#define HZ5_PROFILE_ADAPT_CONFIRM 3u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_MIN_EVENTS
+#define HZ5_PROFILE_ADAPT_MIN_EVENTS 8u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_REMOTE_SHARE_DIV
+#define HZ5_PROFILE_ADAPT_REMOTE_SHARE_DIV 8u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_RSS_HIGH_MB
+#define HZ5_PROFILE_ADAPT_RSS_HIGH_MB 512u
+#endif
+
+#ifndef HZ5_PROFILE_ADAPT_PRESSURE_RETAIN_CAP
+#define HZ5_PROFILE_ADAPT_PRESSURE_RETAIN_CAP 256u
+#endif
+
+#if (HZ5_PROFILE_ADAPT_TICK_EVENTS & (HZ5_PROFILE_ADAPT_TICK_EVENTS - 1u)) != 0
+#error "HZ5_PROFILE_ADAPT_TICK_EVENTS must be a power of two"
+#endif
+
+typedef struct Hz5ProfileAdaptSample {
+  uint64_t large_events;
+  uint64_t large_remote;
+  uint64_t mid_events;
+} Hz5ProfileAdaptSample;
+
+typedef struct Hz5ProfileAdaptState {
+  // Set once by hz5_profile_adapt_init().
+  int enabled;
+  int log;
+  uint64_t interval_ns;
+  uint32_t confirm;
+  uint64_t high_bytes;
+  uint64_t low_bytes;
+  // Owned by the thread holding `busy`.
+  Hz5ProfileAdaptSample last;
+  uint32_t current;
+  uint32_t pending;
+  uint32_t streak;
+  int pressure;
+  uint64_t footprint;
+  uint64_t windows;
+  uint64_t switches;
+} Hz5ProfileAdaptState;
+
+static Hz5ProfileAdaptState g_hz5_profile_adapt;
+static atomic_flag g_hz5_profile_adapt_busy = ATOMIC_FLAG_INIT;
+static _Atomic uint64_t g_hz5_profile_adapt_next_ns;
+static __thread uint32_t t_hz5_profile_adapt_events;
+
+static uint64_t hz5_profile_adapt_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t hz5_profile_adapt_env_u32(const char* name,
+                                          uint32_t fallback) {
+  const char* value = getenv(name);
+  if (!value || value[0] == '\0') {
+    return fallback;
+  }
+  char* end = NULL;
+  unsigned long v = strtoul(value, &end, 10);
+  if (!end || *end != '\0' || v > UINT32_MAX) {
+    fprintf(stderr, "[HZ5_PROFILE] ignored env %s=%s\n", name, value);
+    return fallback;
+  }
+  return (uint32_t)v;
+}
+
+// Runs inside malloc: format on the stack and write(2), no stdio buffering.
+static void hz5_profile_adapt_log_switch(uint32_t from, uint32_t to) {
+  char line[160];
+  int n = snprintf(line, sizeof(line),
+                   "[HZ5_PROFILE_ADAPT] window=%llu %s -> %s pressure=%d"
+                   " footprint_mb=%llu\n",
+                   (unsigned long long)g_hz5_profile_adapt.windows,
+                   hz5_profile_name(from), hz5_profile_name(to),
+                   g_hz5_profile_adapt.pressure,
+                   (unsigned long long)(g_hz5_profile_adapt.footprint >> 20));
+  if (n <= 0) {
+    return;
+  }
+  size_t len = (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1u;
+  ssize_t ignored = write(STDERR_FILENO, line, len);
+  (void)ignored;
+}
+
+static void hz5_profile_adapt_read(Hz5ProfileAdaptSample* sample,
+                                   uint64_t* footprint) {
+  Hz5LargeFrontStatsSnapshot large;
+  Hz5MidPageFrontStatsSnapshot mid;
+  hz5_largefront_stats_snapshot(&large);
+  hz5_midpagefront_stats_snapshot(&mid);
+  uint64_t low_committed = 0;
+#if HZ5_LOWPAGE64_P43_SEGMENT_SLOTS
+  Hz5Lowpage64P43StatsSnapshot low;
+  hz5_lowpage64_p43_stats_snapshot(&low);
+  low_committed =
+      (uint64_t)low.slots_committed_current * HZ5_LOWPAGE64_P43_SLOT_SIZE;
+#endif
+
+  sample->large_events = large.source_spans + large.remote_spans;
+  sample->large_remote = large.remote_spans;
+  sample->mid_events = mid.pages_out;
+
+  uint64_t mid_live = mid.pages_out > mid.pages_released
+                          ? mid.pages_out - mid.pages_released
+                          : 0u;
+  *footprint = large.live_bytes + mid_live * mid.page_bytes + low_committed;
+}
+
+static uint32_t hz5_profile_adapt_vote(const Hz5ProfileAdaptSample* d,
+                                       int pressure) {
+  if (d->large_events >= d->mid_events) {
+    return pressure ? HZ5_PROFILE_LARGE128_RSS
+                    : HZ5_PROFILE_LARGE128_SOURCE16;
+  }
+  if (d->large_remote * HZ5_PROFILE_ADAPT_REMOTE_SHARE_DIV >=
+      d->large_events + d->mid_events) {
+    return HZ5_PROFILE_PAGERUN64_CROSS128;
+  }
+  return HZ5_PROFILE_PAGERUN64_MAIN;
+}
+
+static uint32_t hz5_profile_adapt_retain_limit(void) {
+  return g_hz5_profile_adapt.pressure ? HZ5_PROFILE_ADAPT_PRESSURE_RETAIN_CAP
+                                      : UINT32_MAX;
+}
+
+// Runs with g_hz5_profile_adapt_busy held.
+static void hz5_profile_adapt_window(void) {
+  Hz5ProfileAdaptState* st = &g_hz5_profile_adapt;
+  Hz5ProfileAdaptSample now;
+  uint64_t footprint = 0;
+  hz5_profile_adapt_read(&now, &footprint);
+
+  Hz5ProfileAdaptSample d;
+  d.large_events = now.large_events - st->last.large_events;
+  d.large_remote = now.large_remote - st->last.large_remote;
+  d.mid_events = now.mid_events - st->last.mid_events;
+  st->last = now;
+  st->footprint = footprint;
+  ++st->windows;
+
+  int pressure = st->pressure;
+  if (!pressure && footprint >= st->high_bytes) {
+    pressure = 1;
+  } else if (pressure && footprint < st->low_bytes) {
+    pressure = 0;
+  }
+  if (pressure != st->pressure) {
+    st->pressure = pressure;
+    hz5_profile_switch(st->current, hz5_profile_adapt_retain_limit());
+  }
+
+  if (d.large_events + d.mid_events < HZ5_PROFILE_ADAPT_MIN_EVENTS) {
+    return;
+  }
+  uint32_t vote = hz5_profile_adapt_vote(&d, pressure);
+  if (vote == st->current) {
+    st->streak = 0;
+    return;
+  }
+  if (vote != st->pending) {
+    st->pending = vote;
+    st->streak = 0;
+  }
+  if (++st->streak < st->confirm) {
+    return;
+  }
+  if (st->log) {
+    hz5_profile_adapt_log_switch(st->current, vote);
+  }
+  hz5_profile_switch(vote, hz5_profile_adapt_retain_limit());
+  st->current = vote;
+  st->streak = 0;
+  ++st->switches;
+}
+
+void hz5_profile_adapt_tick(void) {
+  if (!g_hz5_profile_adapt.enabled ||
+      (++t_hz5_profile_adapt_events &
+       (HZ5_PROFILE_ADAPT_TICK_EVENTS - 1u)) != 0u) {
+    return;
+  }
+  uint64_t now = hz5_profile_adapt_now_ns();
+  if (now < atomic_load_explicit(&g_hz5_profile_adapt_next_ns,
+                                 memory_order_relaxed)) {
+    return;
+  }
+  if (atomic_flag_test_and_set_explicit(&g_hz5_profile_adapt_busy,
+                                        memory_order_acquire)) {
+    return;
+  }
+  if (now >= atomic_load_explicit(&g_hz5_profile_adapt_next_ns,
+                                  memory_order_relaxed)) {
+    hz5_profile_adapt_window();
+    atomic_store_explicit(&g_hz5_profile_adapt_next_ns,
+                          now + g_hz5_profile_adapt.interval_ns,
+                          memory_order_relaxed);
+  }
+  atomic_flag_clear_explicit(&g_hz5_profile_adapt_busy, memory_order_release);
+}
+
+// Called at the end of hz5_profile_init(), after the start preset is set.
+void hz5_profile_adapt_init(void) {
+  Hz5ProfileAdaptState* st = &g_hz5_profile_adapt;
+  uint32_t interval_ms = hz5_profile_adapt_env_u32(
+      "HZ5_PROFILE_ADAPT_INTERVAL_MS", HZ5_PROFILE_ADAPT_INTERVAL_MS);
+  uint32_t high_mb = hz5_profile_adapt_env_u32(
+      "HZ5_PROFILE_ADAPT_RSS_HIGH_MB", HZ5_PROFILE_ADAPT_RSS_HIGH_MB);
+  st->confirm = hz5_profile_adapt_env_u32("HZ5_PROFILE_ADAPT_CONFIRM",
+                                          HZ5_PROFILE_ADAPT_CONFIRM);
+  if (st->confirm == 0u) {
+    st->confirm = 1u;
+  }
+  st->interval_ns = (uint64_t)interval_ms * UINT64_C(1000000);
+  st->high_bytes = (uint64_t)high_mb << 20;
+  st->low_bytes = st->high_bytes - st->high_bytes / 4u;
+  st->log = hz5_profile_adapt_env_u32("HZ5_PROFILE_ADAPT_LOG", 0u) != 0u;
+  st->current = g_hz5_profile.id;
+  st->pending = st->current;
+  st->enabled = hz5_profile_adapt_env_u32("HZ5_PROFILE_ADAPT", 1u) != 0u;
+  atomic_store_explicit(&g_hz5_profile_adapt_next_ns,
+                        hz5_profile_adapt_now_ns() + st->interval_ns,
+                        memory_order_relaxed);
+}
+
+void hz5_profile_adapt_print(void) {
+  const Hz5ProfileAdaptState* st = &g_hz5_profile_adapt;
+  fprintf(stderr,
+          "[HZ5_PROFILE_ADAPT] enabled=%d windows=%llu switches=%llu"
+          " pressure=%d footprint_mb=%llu high_mb=%llu\n",
+          st->enabled, (unsigned long long)st->windows,
+          (unsigned long long)st->switches, st->pressure,
+          (unsigned long long)(st->footprint >> 20),
+          (unsigned long long)(st->high_bytes >> 20));
+}
+
+#endif
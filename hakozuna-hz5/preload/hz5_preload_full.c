@@ -5,6 +5,7 @@
 #include "hz5_midpagefront.h"
 #include "hz5_midfront.h"
 #include "hz5_ownerhub.h"
+#include "hz5_profile.h"
 #include "hz5_smallfront.h"
 #include "hz5_wrapper.h"
 
@@ -135,6 +136,7 @@ static Hz5MainFn g_hz5_preload_full_main;
 __attribute__((constructor)) static void hz5_preload_full_constructor(void) {
   atomic_store_explicit(&g_hz5_preload_full_ready, 0, memory_order_release);
   g_hz5_preload_full_stats_enabled = getenv("HZ5_PRELOAD_STATS") != NULL;
+  hz5_profile_init();
 }
 
 #include "hz5_preload_full_support.inc"
@@ -274,6 +276,43 @@ void* malloc(size_t size) {
   return NULL;
 }
 
+#if BENCHLAB_HZ5_RUNTIME_PROFILE
+// Runtime-profile free order. g_hz5_profile is patched before the allocator is
+// marked ready, so the order branch is a read-only, well-predicted load.
+// Each step returns 1 when the front-end owned ptr (freed or invalid).
+static inline int hz5_preload_full_free_midpage_step(void* ptr) {
+  Hz5MidPageFrontFreeResult r = hz5_midpagefront_free(ptr);
+  return r == HZ5_MIDPAGEFRONT_FREE_OK || r == HZ5_MIDPAGEFRONT_FREE_INVALID;
+}
+
+static inline int hz5_preload_full_free_large_step(void* ptr) {
+  Hz5LargeFrontFreeResult r = hz5_largefront_free(ptr);
+  return r == HZ5_LARGEFRONT_FREE_OK || r == HZ5_LARGEFRONT_FREE_INVALID;
+}
+
+static inline int hz5_preload_full_free_profile(void* ptr) {
+  int large_first =
+      HZ5_PROFILE_GET(free_order) == HZ5_PROFILE_FREE_LARGE_FIRST;
+  if (large_first && hz5_preload_full_free_large_step(ptr)) {
+    return 1;
+  }
+  if (hz5_preload_full_free_midpage_step(ptr)) {
+    return 1;
+  }
+  Hz5SmallFrontFreeResult small_free = hz5_smallfront_free(ptr);
+  if (small_free == HZ5_SMALLFRONT_FREE_OK ||
+      small_free == HZ5_SMALLFRONT_FREE_INVALID) {
+    return 1;
+  }
+  Hz5MidFrontFreeResult mid_free = hz5_midfront_free(ptr);
+  if (mid_free == HZ5_MIDFRONT_FREE_OK ||
+      mid_free == HZ5_MIDFRONT_FREE_INVALID) {
+    return 1;
+  }
+  return !large_first && hz5_preload_full_free_large_step(ptr);
+}
+#endif
+
 void free(void* ptr) {
   if (!ptr) {
     return;
@@ -303,7 +342,12 @@ void free(void* ptr) {
 #endif
 #endif
 
-#if BENCHLAB_HZ5_PRELOAD_FREE_LARGE_FIRST
+#if BENCHLAB_HZ5_RUNTIME_PROFILE
+  if (hz5_preload_full_free_profile(ptr)) {
+    hz5_preload_full_stat_inc(&g_hz5_preload_full_free_hz5);
+    return;
+  }
+#elif BENCHLAB_HZ5_PRELOAD_FREE_LARGE_FIRST
   Hz5LargeFrontFreeResult large_free = hz5_largefront_free(ptr);
   if (large_free == HZ5_LARGEFRONT_FREE_OK ||
       large_free == HZ5_LARGEFRONT_FREE_INVALID) {
@@ -412,7 +456,7 @@ void free(void* ptr) {
   }
 #endif
 #if !BENCHLAB_HZ5_PRELOAD_FREE_MIDPAGE_LARGE_FIRST && \
-    !BENCHLAB_HZ5_PRELOAD_FREE_LARGE_FIRST
+    !BENCHLAB_HZ5_PRELOAD_FREE_LARGE_FIRST && !BENCHLAB_HZ5_RUNTIME_PROFILE
   Hz5LargeFrontFreeResult large_free = hz5_largefront_free(ptr);
   if (large_free == HZ5_LARGEFRONT_FREE_OK ||
       large_free == HZ5_LARGEFRONT_FREE_INVALID) {
@@ -177,6 +177,15 @@ size_t hz6_allocator_transfer_shard_capacity_at(
     const Hz6Allocator* allocator,
     size_t shard_index);
 
+/* Shards producers/consumers currently start from; equals the physical shard
+ * count unless HZ6_TRANSFER_ADAPTIVE_SHARDS_L1 resized it. */
+size_t hz6_allocator_transfer_active_shards(const Hz6Allocator* allocator);
+
+/* Cumulative adaptive-shard contention events (0 with the lane off). */
+size_t hz6_allocator_transfer_shard_contention_at(
+    const Hz6Allocator* allocator,
+    size_t shard_index);
+
 size_t hz6_allocator_shared_route_directory_bytes(void);
 
 size_t hz6_allocator_owner_locality_index_bytes(void);
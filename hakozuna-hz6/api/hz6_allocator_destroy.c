@@ -14,6 +14,7 @@ void hz6_allocator_destroy(Hz6Allocator* allocator) {
   hz6_allocator_route_visibility_unregister(allocator);
   hz6_allocator_destroy_descriptors(allocator);
   hz6_allocator_destroy_source_blocks(allocator);
+  hz6_route_backend_destroy(&allocator->route_backend);
 #if HZ6_TOY_SMALL_ACTIVE_FREE_MAP_L1
   hz6_toy_small_active_map_destroy(allocator);
 #endif
@@ -11,6 +11,11 @@ void hz6_allocator_init_backends(Hz6Allocator* allocator) {
           &allocator->route_backend, allocator->route_entries,
           HZ6_ROUTE_TABLE_CAPACITY, allocator->profile.route_page_granularity);
       break;
+    case HZ6_ROUTE_POLICY_RADIX:
+      hz6_route_backend_init_radix(&allocator->route_backend,
+                                   allocator->route_entries,
+                                   HZ6_ROUTE_TABLE_CAPACITY);
+      break;
     case HZ6_ROUTE_POLICY_EXACT_TABLE:
     default:
       hz6_route_backend_init_exact(&allocator->route_backend,
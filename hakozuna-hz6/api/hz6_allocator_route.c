@@ -28,6 +28,8 @@ Hz6RouteResult hz6_allocator_route_lookup(const Hz6Allocator* allocator,
   size_t page_invalid_probes = 0;
   if (allocator->route_backend.kind == HZ6_ROUTE_BACKEND_PAGE_TABLE) {
     ++((Hz6Allocator*)allocator)->stats.route_lookup_page_backend;
+  } else if (allocator->route_backend.kind == HZ6_ROUTE_BACKEND_RADIX) {
+    ++((Hz6Allocator*)allocator)->stats.route_lookup_radix_backend;
   } else {
     ++((Hz6Allocator*)allocator)->stats.route_lookup_exact_backend;
   }
@@ -300,7 +300,7 @@ void hz6_allocator_route_unregister_exact_reason(
     allocator->stats.route_unregister_probe_max = probes;
   }
   allocator->stats.route_active_current =
-      allocator->route_backend.exact_table.active_count;
+      hz6_route_backend_active_count(&allocator->route_backend);
   if (allocator->stats.route_active_current >
       allocator->stats.route_active_max) {
     allocator->stats.route_active_max =
@@ -360,7 +360,7 @@ int hz6_allocator_route_register_exact_reason(
     allocator->stats.route_register_probe_max = probes;
   }
   allocator->stats.route_active_current =
-      allocator->route_backend.exact_table.active_count;
+      hz6_route_backend_active_count(&allocator->route_backend);
   if (allocator->stats.route_active_current >
       allocator->stats.route_active_max) {
     allocator->stats.route_active_max =
@@ -28,6 +28,21 @@ static size_t hz6_allocator_source_block_live_route_count(
     return 0;
   }
   hz6_allocator_route_domain_lock(allocator);
+  if (allocator->route_backend.kind == HZ6_ROUTE_BACKEND_RADIX) {
+    for (const Hz6RouteRadixRecord* record =
+             hz6_route_radix_first_live(&allocator->route_backend.radix);
+         record; record = record->live_next) {
+      const Hz6ObjectDescriptor* descriptor =
+          (const Hz6ObjectDescriptor*)hz6_route_radix_record_descriptor(
+              record);
+      if (hz6_route_radix_record_exact(record) && descriptor &&
+          descriptor->source_block == block) {
+        ++live_routes;
+      }
+    }
+    hz6_allocator_route_domain_unlock(allocator);
+    return live_routes;
+  }
   const Hz6RouteTable* table = &allocator->route_backend.exact_table;
   if (!table->entries) {
     hz6_allocator_route_domain_unlock(allocator);
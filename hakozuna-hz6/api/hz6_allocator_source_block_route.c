@@ -55,7 +55,7 @@ int hz6_allocator_source_block_register_invalid_range(
     allocator->stats.route_register_probe_max = probes;
   }
   allocator->stats.route_active_current =
-      allocator->route_backend.exact_table.active_count;
+      hz6_route_backend_active_count(&allocator->route_backend);
   if (allocator->stats.route_active_current >
       allocator->stats.route_active_max) {
     allocator->stats.route_active_max =
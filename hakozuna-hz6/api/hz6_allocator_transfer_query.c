@@ -41,3 +41,19 @@ size_t hz6_allocator_transfer_shard_capacity_at(
                          &allocator->transfer_backend, shard_index)
                    : 0;
 }
+
+size_t hz6_allocator_transfer_active_shards(const Hz6Allocator* allocator) {
+  if (!allocator || allocator->transfer_backend.kind !=
+                        HZ6_TRANSFER_BACKEND_SHARDED_CACHE) {
+    return allocator ? 1u : 0u;
+  }
+  return hz6_transfer_backend_active_shards(&allocator->transfer_backend);
+}
+
+size_t hz6_allocator_transfer_shard_contention_at(
+    const Hz6Allocator* allocator,
+    size_t shard_index) {
+  return allocator ? hz6_transfer_backend_shard_contention_at(
+                         &allocator->transfer_backend, shard_index)
+                   : 0;
+}
@@ -62,6 +62,8 @@ static const char* profile_name(Hz6ProfileId profile) {
       return "rss";
     case HZ6_PROFILE_REMOTE:
       return "remote";
+    case HZ6_PROFILE_LARGE_HEAP:
+      return "large-heap";
     default:
       return "unknown";
   }
@@ -175,6 +177,10 @@ static int parse_profile(const char* value, Hz6ProfileId* profile) {
     *profile = HZ6_PROFILE_REMOTE;
     return 1;
   }
+  if (strcmp(value, "large-heap") == 0) {
+    *profile = HZ6_PROFILE_LARGE_HEAP;
+    return 1;
+  }
   return 0;
 }
 
@@ -620,7 +626,7 @@ static void print_stats(const Hz6Allocator* allocator) {
          stats.source_block_route_behavior_invalid_front,
          stats.source_block_route_behavior_invalid_descriptor);
   printf("[HZ6_ROUTE_AUDIT] "
-         "exact_backend=%zu page_backend=%zu "
+         "exact_backend=%zu page_backend=%zu radix_backend=%zu "
          "page_probe_total=%zu page_probe_max=%zu "
          "page_exact_probe_total=%zu page_exact_probe_max=%zu "
          "page_exact_hash_probe_total=%zu page_exact_hash_probe_max=%zu "
@@ -634,6 +640,7 @@ static void print_stats(const Hz6Allocator* allocator) {
          "overflow_range_lookup=%zu overflow_range_hit=%zu\n",
          stats.route_lookup_exact_backend,
          stats.route_lookup_page_backend,
+         stats.route_lookup_radix_backend,
          stats.route_lookup_page_probe_total,
          stats.route_lookup_page_probe_max,
          stats.route_lookup_page_exact_probe_total,
@@ -766,6 +773,15 @@ static void print_stats(const Hz6Allocator* allocator) {
          stats.metadata_frontcache_slim_table_bytes,
          stats.metadata_frontcache_slim_savings_bytes);
 #endif
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  printf("[HZ6_TRANSFER_SHARDS] active=%zu contention=",
+         hz6_allocator_transfer_active_shards(allocator));
+  for (size_t i = 0; i < HZ6_TRANSFER_SHARD_COUNT; ++i) {
+    printf("%s%zu", i == 0 ? "" : ",",
+           hz6_allocator_transfer_shard_contention_at(allocator, i));
+  }
+  printf("\n");
+#endif
 }
 
 static int run_local(Hz6ProfileId profile, uint64_t iters, size_t size) {
@@ -1016,7 +1032,7 @@ static void usage(const char* argv0) {
   fprintf(stderr,
           "usage: %s [mode] [profile] [iters] [size]\n"
           "  mode: local | remote | reuse | phase-reuse\n"
-          "  profile: strict | speed | rss | remote\n"
+          "  profile: strict | speed | rss | remote | large-heap\n"
           "  iters: iteration count\n"
           "  size: allocation size in bytes\n",
           argv0);
@@ -6,6 +6,21 @@
 #define HZ6_ROUTE_PAGE_GRANULARITY ((size_t)4096)
 #endif
 
+#ifndef HZ6_ROUTE_RADIX_LEAF_BITS
+/* RadixRoute-L1 shape: 48-bit addresses at 4 KiB pages split into
+ * root / mid / leaf = (36 - MID - LEAF) / MID / LEAF bits.  One leaf covers
+ * 2^LEAF pages, so route memory grows with the mapped heap, not a table. */
+#define HZ6_ROUTE_RADIX_LEAF_BITS 10u
+#endif
+
+#ifndef HZ6_ROUTE_RADIX_MID_BITS
+#define HZ6_ROUTE_RADIX_MID_BITS 13u
+#endif
+
+#ifndef HZ6_ROUTE_RADIX_RECORD_SLAB_BYTES
+#define HZ6_ROUTE_RADIX_RECORD_SLAB_BYTES ((size_t)65536)
+#endif
+
 #ifndef HZ6_TRANSFER_CACHE_CAPACITY
 #define HZ6_TRANSFER_CACHE_CAPACITY ((size_t)64)
 #endif
@@ -75,6 +90,47 @@
 #define HZ6_LINUX_MMAP_RETAIN_TLS_BYTES_CAP ((size_t)32u * 1024u * 1024u)
 #endif
 
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1
+/* Candidate LD_PRELOAD background scavenger.  A helper thread trims the global
+ * Linux retained-mmap cache within a per-tick byte budget, so munmap leaves
+ * the malloc/free path, and once the source layer goes idle it asks owners to
+ * return local-free descriptors on their next call.  Requires
+ * HZ6_LINUX_MMAP_RETAIN_L1. */
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1 0
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_INTERVAL_MS
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_INTERVAL_MS 100u
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_TICK_BYTES
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_TICK_BYTES \
+  ((size_t)32u * 1024u * 1024u)
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_KEEP_BYTES
+/* Retained bytes left in place while the source layer is still active. */
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_KEEP_BYTES \
+  ((size_t)16u * 1024u * 1024u)
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_PRESSURE_BYTES
+/* Retained bytes that wake the scavenger before its interval expires. */
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_PRESSURE_BYTES \
+  (HZ6_LINUX_MMAP_RETAIN_BYTES_CAP / 4u * 3u)
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_OWNER_BYTES
+/* Local-free bytes one owner returns per scavenge request. */
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_OWNER_BYTES \
+  ((size_t)64u * 1024u * 1024u)
+#endif
+
+#ifndef HZ6_PRELOAD_BACKGROUND_SCAVENGE_IDLE_TICKS
+/* Ticks without source reserve/release before the keep floor drops to 0. */
+#define HZ6_PRELOAD_BACKGROUND_SCAVENGE_IDLE_TICKS 10u
+#endif
+
 #ifndef HZ6_LARGE_SPAN_TRUSTED_LOCAL_FREE_L1
 /* Candidate-only LargeSpan local free shortcut.  hz6_free() has already
  * routed local frees through the local-owner branch before calling the front. */
@@ -85,6 +141,36 @@
 #define HZ6_TRANSFER_SHARD_COUNT ((size_t)4)
 #endif
 
+#ifndef HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+/* Default-off TransferAdaptiveShards-L1.  A sharded transfer backend starts
+ * at the profile shard count and halves / doubles the active count from the
+ * contention it sees per window (home-shard push spills, plus contended lock
+ * acquires under HZ6_TRANSFER_CACHE_LOCK_L1).  Active shards only pick where a
+ * probe starts; push and pop still walk every physical shard, so objects parked
+ * in a retired shard stay reachable. */
+#define HZ6_TRANSFER_ADAPTIVE_SHARDS_L1 0
+#endif
+
+#ifndef HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW
+/* Backend push/pop operations per evaluation window; power of two. */
+#define HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW 1024u
+#endif
+
+#ifndef HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS
+/* Contention events per window that double the active shard count. */
+#define HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS 64u
+#endif
+
+#ifndef HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_EVENTS
+/* A window at or below this many events counts as quiet. */
+#define HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_EVENTS 8u
+#endif
+
+#ifndef HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS
+/* Consecutive quiet windows before the active shard count halves. */
+#define HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS 4u
+#endif
+
 #ifndef HZ6_PROFILE_TRANSFER_SHARD_CLASS_L1
 #define HZ6_PROFILE_TRANSFER_SHARD_CLASS_L1 0
 #endif
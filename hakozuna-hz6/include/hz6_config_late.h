@@ -1026,6 +1026,28 @@
 #error "HZ6_SOURCE_RUN_INLINE_META_L1=0 requires source-run metadata features off"
 #endif
 
+#if HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1 && !HZ6_LINUX_MMAP_RETAIN_L1
+#error "HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1 requires HZ6_LINUX_MMAP_RETAIN_L1"
+#endif
+
+#if HZ6_ROUTE_RADIX_LEAF_BITS == 0 || HZ6_ROUTE_RADIX_MID_BITS == 0 || \
+    HZ6_ROUTE_RADIX_LEAF_BITS + HZ6_ROUTE_RADIX_MID_BITS >= 30
+#error "HZ6_ROUTE_RADIX_{LEAF,MID}_BITS must leave at least 7 root bits"
+#endif
+
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1 &&                       \
+    (HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW == 0 ||             \
+     (HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW &                  \
+      (HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW - 1u)) != 0)
+#error "HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW must be a power of two"
+#endif
+
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1 &&              \
+    HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_EVENTS >=  \
+        HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS
+#error "HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_EVENTS must be below GROW_EVENTS"
+#endif
+
 #ifndef HZ6_FRONTCACHE_PACKED_META_L1
 #define HZ6_FRONTCACHE_PACKED_META_L1 0
 #endif
@@ -131,6 +131,7 @@ HZ6_LIB_SOURCES=(
   "${HZ6_DIR}/route/hz6_route_table_exact.c"
   "${HZ6_DIR}/route/hz6_route_table_invalid.c"
   "${HZ6_DIR}/route/hz6_route.c"
+  "${HZ6_DIR}/route/hz6_route_radix.c"
   "${HZ6_DIR}/scavenge/hz6_scavenge.c"
   "${HZ6_DIR}/source/linux_source_mmap_ops.c"
   "${HZ6_DIR}/source/linux_source_mmap_memory.c"
@@ -142,6 +143,7 @@ HZ6_LIB_SOURCES=(
   "${HZ6_DIR}/transfer/hz6_transfer_backend_sharded_init.c"
   "${HZ6_DIR}/transfer/hz6_transfer_backend_sharded_push.c"
   "${HZ6_DIR}/transfer/hz6_transfer_backend_sharded_pop.c"
+  "${HZ6_DIR}/transfer/hz6_transfer_backend_sharded_adapt.c"
   "${HZ6_DIR}/transfer/hz6_transfer_backend_stats_aggregate.c"
   "${HZ6_DIR}/transfer/hz6_transfer_backend_stats_shards.c"
   "${HZ6_DIR}/transfer/hz6_transfer.c"
@@ -17,9 +17,9 @@ REMOTE_SIZES="131072"
 REUSE_SIZES="131072"
 PHASE_REUSE_SIZES="128"
 
-LOCAL_PROFILES="strict,speed,rss,remote"
-REMOTE_PROFILES="speed,rss,remote"
-REUSE_PROFILES="speed,rss,remote"
+LOCAL_PROFILES="strict,speed,rss,remote,large-heap"
+REMOTE_PROFILES="speed,rss,remote,large-heap"
+REUSE_PROFILES="speed,rss,remote,large-heap"
 PHASE_REUSE_PROFILES="speed"
 
 usage() {
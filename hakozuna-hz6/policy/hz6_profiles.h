@@ -15,7 +15,8 @@ typedef enum Hz6ProfileId {
   HZ6_PROFILE_STRICT = 0,
   HZ6_PROFILE_SPEED = 1,
   HZ6_PROFILE_RSS = 2,
-  HZ6_PROFILE_REMOTE = 3
+  HZ6_PROFILE_REMOTE = 3,
+  HZ6_PROFILE_LARGE_HEAP = 4
 } Hz6ProfileId;
 
 typedef enum Hz6TransferShardPolicy {
@@ -25,7 +26,8 @@ typedef enum Hz6TransferShardPolicy {
 
 typedef enum Hz6RouteBackendPolicy {
   HZ6_ROUTE_POLICY_EXACT_TABLE = 1,
-  HZ6_ROUTE_POLICY_PAGE_TABLE = 2
+  HZ6_ROUTE_POLICY_PAGE_TABLE = 2,
+  HZ6_ROUTE_POLICY_RADIX = 3
 } Hz6RouteBackendPolicy;
 
 typedef struct Hz6ProfileConfig {
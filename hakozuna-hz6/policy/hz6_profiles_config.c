@@ -53,6 +53,20 @@ Hz6ProfileConfig hz6_profile_config(Hz6ProfileId id) {
       config.scavenge_local_free_bytes = 8192;
       config.scavenge_orphan_bytes = 8192;
       break;
+    case HZ6_PROFILE_LARGE_HEAP:
+      config.transfer_first = 1;
+      config.strict_owner_remote = 0;
+      config.transfer_capacity = HZ6_PROFILE_SPEED_TRANSFER_CAPACITY;
+      config.transfer_shards = 4;
+#if HZ6_PROFILE_TRANSFER_SHARD_CLASS_L1
+      config.transfer_shard_policy = HZ6_TRANSFER_SHARD_CLASS_ID;
+#endif
+      /* Radix pages are fixed at 4 KiB; route_page_granularity stays 0. */
+      config.route_backend_policy = HZ6_ROUTE_POLICY_RADIX;
+      config.source_batch = 16;
+      config.scavenge_local_free_bytes = 4096;
+      config.scavenge_orphan_bytes = 4096;
+      break;
     case HZ6_PROFILE_STRICT:
     default:
       break;
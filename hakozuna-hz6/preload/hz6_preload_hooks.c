@@ -7,6 +7,7 @@
 #include "hz6_profiles.h"
 #include "hz6_preload_midpage.h"
 #include "hz6_preload_real.h"
+#include "hz6_preload_scavenger.h"
 #include "hz6_preload_stats.h"
 
 #ifndef HZ6_PRELOAD_ROUTE_BEFORE_MAPS_EXTERNAL_DISPATCH_L1
@@ -240,6 +241,9 @@ static Hz6ProfileId hz6_preload_profile_from_env(void) {
   if (strcmp(value, "remote") == 0) {
     return HZ6_PROFILE_REMOTE;
   }
+  if (strcmp(value, "large-heap") == 0) {
+    return HZ6_PROFILE_LARGE_HEAP;
+  }
   if (strcmp(value, "strict") == 0) {
     return HZ6_PROFILE_STRICT;
   }
@@ -248,6 +252,7 @@ static Hz6ProfileId hz6_preload_profile_from_env(void) {
 
 static Hz6Allocator* hz6_preload_allocator(void) {
   if (g_hz6_preload_allocator) {
+    hz6_preload_scavenger_owner_poll(g_hz6_preload_allocator);
     return g_hz6_preload_allocator;
   }
 
@@ -259,6 +264,8 @@ static Hz6Allocator* hz6_preload_allocator(void) {
   hz6_allocator_init_with_profile(allocator, hz6_preload_profile_from_env());
   g_hz6_preload_allocator = allocator;
   hz6_preload_register_allocator(allocator);
+  hz6_preload_scavenger_owner_adopt();
+  hz6_preload_scavenger_start();
   return allocator;
 }
 
@@ -0,0 +1,225 @@
+/* LD_PRELOAD background scavenger.
+ *
+ * The helper thread owns the syscalls: each tick it spends an
+ * Hz6ScavengeBudget unmapping the global retained-mmap cache down to a keep
+ * floor, and to zero once the source layer has been idle for a while.
+ *
+ * Owner descriptors and free lists are owner-private and unlocked, so the
+ * helper never walks them.  It only advances a tick epoch; an owner whose
+ * first call after a quiet spell sees a gap of IDLE_TICKS scavenges its own
+ * local-free descriptors.  In the retain lanes that release is a cache put,
+ * so the munmap still happens here.  Owners that never call again keep their
+ * lists until malloc_trim(). */
+#include "hz6_preload_scavenger.h"
+
+#if HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1
+#include "hz6_allocator_api_scavenge.h"
+#include "hz6_scavenge.h"
+#include "linux_source_mmap.h"
+#include "hz6_preload_real.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+  HZ6_PRELOAD_SCAVENGER_OFF = 0,
+  HZ6_PRELOAD_SCAVENGER_STARTING = 1,
+  HZ6_PRELOAD_SCAVENGER_RUNNING = 2,
+  HZ6_PRELOAD_SCAVENGER_DISABLED = 3
+};
+
+atomic_size_t g_hz6_preload_scavenge_epoch;
+__thread size_t g_hz6_preload_scavenge_seen_epoch;
+
+static atomic_int g_hz6_preload_scavenger_state;
+static unsigned g_hz6_preload_scavenger_interval_ms;
+static int g_hz6_preload_scavenger_atfork_registered;
+
+static atomic_size_t g_hz6_preload_scavenger_ticks;
+static atomic_size_t g_hz6_preload_scavenger_pressure_wakes;
+static atomic_size_t g_hz6_preload_scavenger_idle_ticks;
+static atomic_size_t g_hz6_preload_scavenger_released_bytes;
+static atomic_size_t g_hz6_preload_scavenger_owner_services;
+static atomic_size_t g_hz6_preload_scavenger_owner_objects;
+
+static void hz6_preload_scavenger_count(atomic_size_t* counter,
+                                        size_t value) {
+  (void)atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+}
+
+static size_t hz6_preload_scavenger_load(const atomic_size_t* counter) {
+  return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+void hz6_preload_scavenger_owner_service(Hz6Allocator* allocator) {
+  if (HZ6_PRELOAD_SCAVENGER_UNLIKELY(
+          atomic_load(&g_hz6_preload_scavenger_state) ==
+          HZ6_PRELOAD_SCAVENGER_OFF)) {
+    /* First call in a forked child: the helper did not come along. */
+    hz6_preload_scavenger_start();
+  }
+  size_t epoch = atomic_load_explicit(&g_hz6_preload_scavenge_epoch,
+                                      memory_order_relaxed);
+  size_t quiet_ticks = epoch - g_hz6_preload_scavenge_seen_epoch;
+  g_hz6_preload_scavenge_seen_epoch = epoch;
+  if (quiet_ticks < HZ6_PRELOAD_BACKGROUND_SCAVENGE_IDLE_TICKS) {
+    return;
+  }
+  size_t released = hz6_allocator_scavenge_local_free(
+      allocator, HZ6_PRELOAD_BACKGROUND_SCAVENGE_OWNER_BYTES);
+  hz6_preload_scavenger_count(&g_hz6_preload_scavenger_owner_services, 1u);
+  hz6_preload_scavenger_count(&g_hz6_preload_scavenger_owner_objects,
+                              released);
+}
+
+static void hz6_preload_scavenger_tick(size_t retained_bytes,
+                                       size_t keep_bytes) {
+  if (retained_bytes <= keep_bytes) {
+    return;
+  }
+
+  Hz6ScavengeBudget budget;
+  hz6_scavenge_budget_init(&budget,
+                           HZ6_PRELOAD_BACKGROUND_SCAVENGE_TICK_BYTES);
+  size_t request = hz6_scavenge_remaining_bytes(&budget);
+  if (request > retained_bytes - keep_bytes) {
+    request = retained_bytes - keep_bytes;
+  }
+  if (hz6_scavenge_account_release(&budget,
+                                   hz6_linux_mmap_retain_flush(request))) {
+    hz6_preload_scavenger_count(&g_hz6_preload_scavenger_released_bytes,
+                                budget.bytes_released);
+  }
+}
+
+static void* hz6_preload_scavenger_main(void* arg) {
+  (void)arg;
+  /* Anything this thread allocates goes to libc, never to an HZ6 allocator. */
+  g_hz6_preload_reentry = 1;
+
+  size_t last_activity = 0;
+  unsigned idle_ticks = 0;
+  for (;;) {
+    int pressure = hz6_linux_mmap_retain_wait(
+        HZ6_PRELOAD_BACKGROUND_SCAVENGE_PRESSURE_BYTES,
+        g_hz6_preload_scavenger_interval_ms);
+    Hz6LinuxMmapRetainStats stats = hz6_linux_mmap_retain_stats_snapshot();
+    size_t activity = stats.reserve_calls + stats.release_calls;
+    if (activity != last_activity) {
+      last_activity = activity;
+      idle_ticks = 0;
+    } else if (idle_ticks < HZ6_PRELOAD_BACKGROUND_SCAVENGE_IDLE_TICKS) {
+      ++idle_ticks;
+    }
+
+    size_t keep_bytes = HZ6_PRELOAD_BACKGROUND_SCAVENGE_KEEP_BYTES;
+    if (idle_ticks >= HZ6_PRELOAD_BACKGROUND_SCAVENGE_IDLE_TICKS) {
+      keep_bytes = 0;
+      if (stats.retained_bytes != 0) {
+        hz6_preload_scavenger_count(&g_hz6_preload_scavenger_idle_ticks, 1u);
+      }
+    }
+    (void)atomic_fetch_add_explicit(&g_hz6_preload_scavenge_epoch, 1u,
+                                    memory_order_relaxed);
+    hz6_preload_scavenger_count(&g_hz6_preload_scavenger_ticks, 1u);
+    if (pressure) {
+      hz6_preload_scavenger_count(&g_hz6_preload_scavenger_pressure_wakes,
+                                  1u);
+    }
+    hz6_preload_scavenger_tick(stats.retained_bytes, keep_bytes);
+  }
+  return NULL;
+}
+
+static void hz6_preload_scavenger_atfork_child(void) {
+  /* The helper thread does not survive fork().  Mark it off and bump the
+   * epoch so the child's next preload call takes the owner-service path,
+   * which starts a new helper. */
+  hz6_linux_mmap_retain_fork_child();
+  int expected = HZ6_PRELOAD_SCAVENGER_RUNNING;
+  if (atomic_compare_exchange_strong(&g_hz6_preload_scavenger_state,
+                                     &expected,
+                                     HZ6_PRELOAD_SCAVENGER_OFF)) {
+    (void)atomic_fetch_add_explicit(&g_hz6_preload_scavenge_epoch, 1u,
+                                    memory_order_relaxed);
+  }
+}
+
+static int hz6_preload_scavenger_configure(void) {
+  const char* value = getenv("HZ6_PRELOAD_SCAVENGE");
+  if (value && strcmp(value, "0") == 0) {
+    return 0;
+  }
+  g_hz6_preload_scavenger_interval_ms =
+      HZ6_PRELOAD_BACKGROUND_SCAVENGE_INTERVAL_MS;
+  value = getenv("HZ6_PRELOAD_SCAVENGE_INTERVAL_MS");
+  if (value && value[0] != '\0') {
+    unsigned long parsed = strtoul(value, NULL, 10);
+    if (parsed >= 1u && parsed <= 60000u) {
+      g_hz6_preload_scavenger_interval_ms = (unsigned)parsed;
+    }
+  }
+  return 1;
+}
+
+void hz6_preload_scavenger_start(void) {
+  int expected = HZ6_PRELOAD_SCAVENGER_OFF;
+  if (!atomic_compare_exchange_strong(&g_hz6_preload_scavenger_state,
+                                      &expected,
+                                      HZ6_PRELOAD_SCAVENGER_STARTING)) {
+    return;
+  }
+  if (!hz6_preload_scavenger_configure()) {
+    atomic_store(&g_hz6_preload_scavenger_state,
+                 HZ6_PRELOAD_SCAVENGER_DISABLED);
+    return;
+  }
+  if (!g_hz6_preload_scavenger_atfork_registered) {
+    g_hz6_preload_scavenger_atfork_registered =
+        pthread_atfork(hz6_linux_mmap_retain_fork_prepare,
+                       hz6_linux_mmap_retain_fork_parent,
+                       hz6_preload_scavenger_atfork_child) == 0;
+  }
+
+  /* Keep signal delivery on application threads. */
+  sigset_t all_signals;
+  sigset_t saved_signals;
+  sigfillset(&all_signals);
+  pthread_sigmask(SIG_SETMASK, &all_signals, &saved_signals);
+  pthread_attr_t attr;
+  pthread_t thread;
+  int created = 0;
+  if (pthread_attr_init(&attr) == 0) {
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    created = pthread_create(&thread, &attr, hz6_preload_scavenger_main,
+                             NULL) == 0;
+    pthread_attr_destroy(&attr);
+  }
+  pthread_sigmask(SIG_SETMASK, &saved_signals, NULL);
+  if (created) {
+    (void)pthread_setname_np(thread, "hz6-scavenge");
+  }
+  atomic_store(&g_hz6_preload_scavenger_state,
+               created ? HZ6_PRELOAD_SCAVENGER_RUNNING
+                       : HZ6_PRELOAD_SCAVENGER_DISABLED);
+}
+
+void hz6_preload_scavenger_print_stats(void) {
+  int state = atomic_load(&g_hz6_preload_scavenger_state);
+  fprintf(stderr,
+          "[HZ6_PRELOAD_SCAVENGE] running=%d interval_ms=%u ticks=%zu "
+          "pressure_wakes=%zu idle_ticks=%zu released_bytes=%zu "
+          "owner_services=%zu owner_objects=%zu\n",
+          state == HZ6_PRELOAD_SCAVENGER_RUNNING ? 1 : 0,
+          g_hz6_preload_scavenger_interval_ms,
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_ticks),
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_pressure_wakes),
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_idle_ticks),
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_released_bytes),
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_owner_services),
+          hz6_preload_scavenger_load(&g_hz6_preload_scavenger_owner_objects));
+}
+#endif
@@ -0,0 +1,53 @@
+#ifndef HZ6_PRELOAD_SCAVENGER_H
+#define HZ6_PRELOAD_SCAVENGER_H
+
+#include "hz6_allocator.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#if HZ6_PRELOAD_BACKGROUND_SCAVENGE_L1
+#if defined(__GNUC__) || defined(__clang__)
+#define HZ6_PRELOAD_SCAVENGER_INTERNAL __attribute__((visibility("hidden")))
+#define HZ6_PRELOAD_SCAVENGER_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
+#else
+#define HZ6_PRELOAD_SCAVENGER_INTERNAL
+#define HZ6_PRELOAD_SCAVENGER_UNLIKELY(expr) (expr)
+#endif
+
+/* Advanced once per scavenger tick.  Owners copy it on each preload call; a
+ * gap of IDLE_TICKS or more means the owner was quiet and hands its local-free
+ * descriptors back to the source layer on its own thread. */
+extern HZ6_PRELOAD_SCAVENGER_INTERNAL atomic_size_t
+    g_hz6_preload_scavenge_epoch;
+extern HZ6_PRELOAD_SCAVENGER_INTERNAL __thread size_t
+    g_hz6_preload_scavenge_seen_epoch;
+
+/* Starts the scavenger thread once per process image.  Call from the
+ * allocator-creation slow path with g_hz6_preload_reentry set. */
+HZ6_PRELOAD_SCAVENGER_INTERNAL void hz6_preload_scavenger_start(void);
+HZ6_PRELOAD_SCAVENGER_INTERNAL void
+hz6_preload_scavenger_owner_service(Hz6Allocator* allocator);
+HZ6_PRELOAD_SCAVENGER_INTERNAL void hz6_preload_scavenger_print_stats(void);
+
+static inline void hz6_preload_scavenger_owner_adopt(void) {
+  g_hz6_preload_scavenge_seen_epoch = atomic_load_explicit(
+      &g_hz6_preload_scavenge_epoch, memory_order_relaxed);
+}
+
+static inline void hz6_preload_scavenger_owner_poll(Hz6Allocator* allocator) {
+  if (HZ6_PRELOAD_SCAVENGER_UNLIKELY(
+          atomic_load_explicit(&g_hz6_preload_scavenge_epoch,
+                               memory_order_relaxed) !=
+          g_hz6_preload_scavenge_seen_epoch)) {
+    hz6_preload_scavenger_owner_service(allocator);
+  }
+}
+#else
+#define hz6_preload_scavenger_start() ((void)0)
+#define hz6_preload_scavenger_owner_adopt() ((void)0)
+#define hz6_preload_scavenger_owner_poll(allocator) ((void)(allocator))
+#define hz6_preload_scavenger_print_stats() ((void)0)
+#endif
+
+#endif
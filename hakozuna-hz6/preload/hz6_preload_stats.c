@@ -7,6 +7,7 @@
 #include "hz6_midpage_front.h"
 #include "linux_source_mmap.h"
 #include "hz6_preload_real.h"
+#include "hz6_preload_scavenger.h"
 #include "hz6_preload_stats.h"
 
 #include <pthread.h>
@@ -123,6 +124,7 @@ static void hz6_preload_print_stats(void) {
 #include "hz6_preload_stats_print_head.inc"
 #include "hz6_preload_stats_print_mid.inc"
 #include "hz6_preload_stats_print_tail.inc"
+  hz6_preload_scavenger_print_stats();
 }
 __attribute__((destructor)) static void hz6_preload_on_unload(void) {
   hz6_preload_print_stats();
@@ -3,6 +3,7 @@
 
 #include "../include/hz6_config.h"
 #include "hz6_route.h"
+#include "hz6_route_radix.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,7 +11,8 @@ extern "C" {
 
 typedef enum Hz6RouteBackendKind {
   HZ6_ROUTE_BACKEND_EXACT_TABLE = 1,
-  HZ6_ROUTE_BACKEND_PAGE_TABLE = 2
+  HZ6_ROUTE_BACKEND_PAGE_TABLE = 2,
+  HZ6_ROUTE_BACKEND_RADIX = 3
 } Hz6RouteBackendKind;
 
 typedef struct Hz6RouteBackend {
@@ -18,8 +20,27 @@ typedef struct Hz6RouteBackend {
   Hz6RouteEntry* exact_entries;
   Hz6RouteTable exact_table;
   size_t page_granularity;
+  /* RADIX routes live here; exact_table stays empty for that kind. */
+  Hz6RouteRadix radix;
 } Hz6RouteBackend;
 
+static inline int hz6_route_backend_kind_valid(const Hz6RouteBackend* backend) {
+  return backend && (backend->kind == HZ6_ROUTE_BACKEND_EXACT_TABLE ||
+                     backend->kind == HZ6_ROUTE_BACKEND_PAGE_TABLE ||
+                     backend->kind == HZ6_ROUTE_BACKEND_RADIX);
+}
+
+static inline size_t hz6_route_backend_active_count(
+    const Hz6RouteBackend* backend) {
+  if (!backend) {
+    return 0;
+  }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return backend->radix.active_count;
+  }
+  return backend->exact_table.active_count;
+}
+
 void hz6_route_backend_init_exact(Hz6RouteBackend* backend,
                                   Hz6RouteEntry* entries,
                                   size_t capacity);
@@ -34,6 +55,12 @@ void hz6_route_backend_init_page_table_with_granularity(
     size_t capacity,
     size_t page_granularity);
 
+void hz6_route_backend_init_radix(Hz6RouteBackend* backend,
+                                  Hz6RouteEntry* entries,
+                                  size_t capacity);
+
+void hz6_route_backend_destroy(Hz6RouteBackend* backend);
+
 int hz6_route_backend_register_exact(Hz6RouteBackend* backend,
                                      void* base,
                                      size_t bytes,
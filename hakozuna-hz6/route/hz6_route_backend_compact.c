@@ -2,14 +2,19 @@
 
 int hz6_route_backend_compact_tombstones(Hz6RouteBackend* backend,
                                          size_t* moved_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     if (moved_count) {
       *moved_count = 0;
     }
     return 0;
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    /* Radix unregister unlinks in place; there are no tombstones. */
+    if (moved_count) {
+      *moved_count = 0;
+    }
+    return 1;
+  }
   return hz6_route_table_compact_tombstones(&backend->exact_table,
                                             moved_count);
 }
@@ -11,6 +11,7 @@ void hz6_route_backend_init_exact(Hz6RouteBackend* backend,
   backend->exact_entries = entries;
   backend->page_granularity = 0;
   hz6_route_table_init(&backend->exact_table, entries, capacity);
+  hz6_route_radix_init(&backend->radix);
 }
 
 void hz6_route_backend_init_page_table(Hz6RouteBackend* backend,
@@ -35,4 +36,25 @@ void hz6_route_backend_init_page_table_with_granularity(
           ? page_granularity
           : HZ6_ROUTE_PAGE_GRANULARITY;
   hz6_route_table_init(&backend->exact_table, entries, capacity);
+  hz6_route_radix_init(&backend->radix);
+}
+
+void hz6_route_backend_init_radix(Hz6RouteBackend* backend,
+                                  Hz6RouteEntry* entries,
+                                  size_t capacity) {
+  if (!backend) {
+    return;
+  }
+  backend->kind = HZ6_ROUTE_BACKEND_RADIX;
+  backend->exact_entries = entries;
+  backend->page_granularity = HZ6_ROUTE_RADIX_PAGE_BYTES;
+  hz6_route_table_init(&backend->exact_table, entries, capacity);
+  hz6_route_radix_init(&backend->radix);
+}
+
+void hz6_route_backend_destroy(Hz6RouteBackend* backend) {
+  if (!backend || backend->kind != HZ6_ROUTE_BACKEND_RADIX) {
+    return;
+  }
+  hz6_route_radix_destroy(&backend->radix);
 }
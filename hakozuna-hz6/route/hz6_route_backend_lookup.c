@@ -30,11 +30,13 @@ Hz6RouteResult hz6_route_backend_lookup_exact_probe(
   if (probe_count) {
     *probe_count = 0;
   }
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     return hz6_route_miss();
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return hz6_route_radix_lookup_exact_probe(&backend->radix, ptr,
+                                              probe_count);
+  }
   return hz6_route_lookup_exact_probe(&backend->exact_table, ptr, probe_count);
 }
 
@@ -78,11 +80,12 @@ Hz6RouteResult hz6_route_backend_lookup_probe_ex(
   if (invalid_probe_count) {
     *invalid_probe_count = 0;
   }
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     return hz6_route_miss();
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return hz6_route_radix_lookup_probe(&backend->radix, ptr, probe_count);
+  }
   if (backend->kind == HZ6_ROUTE_BACKEND_PAGE_TABLE) {
     return hz6_route_backend_lookup_page_table_probe_ex(backend,
                                                         ptr,
@@ -8,11 +8,14 @@ int hz6_route_backend_register_exact(Hz6RouteBackend* backend,
                                      uint32_t generation,
                                      void* descriptor,
                                      size_t* probe_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     return 0;
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return hz6_route_radix_register_exact(&backend->radix, base, bytes,
+                                          front_id, class_id, generation,
+                                          descriptor, probe_count);
+  }
   return hz6_route_register_exact(&backend->exact_table, base, bytes, front_id,
                                   class_id, generation, descriptor,
                                   probe_count);
@@ -28,11 +31,14 @@ int hz6_route_backend_replace_exact_descriptor(Hz6RouteBackend* backend,
                                                uint32_t new_generation,
                                                void* new_descriptor,
                                                size_t* probe_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     return 0;
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return hz6_route_radix_replace_exact_descriptor(
+        &backend->radix, base, bytes, front_id, class_id, old_generation,
+        old_descriptor, new_generation, new_descriptor, probe_count);
+  }
   return hz6_route_replace_exact_descriptor(&backend->exact_table, base, bytes,
                                             front_id, class_id,
                                             old_generation, old_descriptor,
@@ -46,11 +52,13 @@ int hz6_route_backend_register_invalid_range(Hz6RouteBackend* backend,
                                              uint16_t front_id,
                                              uint16_t class_id,
                                              size_t* probe_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
     return 0;
   }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    return hz6_route_radix_register_invalid_range(
+        &backend->radix, base, bytes, front_id, class_id, probe_count);
+  }
   return hz6_route_register_invalid_range(&backend->exact_table, base, bytes,
                                           front_id, class_id, probe_count);
 }
@@ -3,9 +3,11 @@
 void hz6_route_backend_unregister_exact(Hz6RouteBackend* backend,
                                         void* base,
                                         size_t* probe_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
+    return;
+  }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    hz6_route_radix_unregister_exact(&backend->radix, base, probe_count);
     return;
   }
   hz6_route_unregister_exact(&backend->exact_table, base, probe_count);
@@ -14,9 +16,12 @@ void hz6_route_backend_unregister_exact(Hz6RouteBackend* backend,
 void hz6_route_backend_unregister_invalid_range(Hz6RouteBackend* backend,
                                                 void* base,
                                                 size_t* probe_count) {
-  if (!backend ||
-      (backend->kind != HZ6_ROUTE_BACKEND_EXACT_TABLE &&
-       backend->kind != HZ6_ROUTE_BACKEND_PAGE_TABLE)) {
+  if (!hz6_route_backend_kind_valid(backend)) {
+    return;
+  }
+  if (backend->kind == HZ6_ROUTE_BACKEND_RADIX) {
+    hz6_route_radix_unregister_invalid_range(&backend->radix, base,
+                                             probe_count);
     return;
   }
   hz6_route_unregister_invalid_range(&backend->exact_table, base,
@@ -0,0 +1,718 @@
+#include "hz6_route_radix.h"
+#include "hz6_source_util.h"
+
+#include <string.h>
+
+#if defined(_WIN32)
+#include "win_source_virtualalloc.h"
+#else
+#include "linux_source_mmap.h"
+#endif
+
+typedef struct Hz6RouteRadixView {
+  uint32_t flags;
+  uint32_t front_class;
+  uint32_t generation;
+  uintptr_t base;
+  uintptr_t end;
+  uintptr_t descriptor;
+  Hz6RouteRadixRecord* next;
+} Hz6RouteRadixView;
+
+static size_t hz6_route_radix_os_page_size(void) {
+#if defined(_WIN32)
+  return hz6_win_page_size();
+#else
+  return hz6_linux_page_size();
+#endif
+}
+
+static void* hz6_route_radix_storage_alloc(size_t bytes, size_t* out_bytes) {
+  size_t page_size = hz6_route_radix_os_page_size();
+  size_t rounded = hz6_source_round_up(bytes, page_size);
+  if (rounded == 0) {
+    return NULL;
+  }
+#if defined(_WIN32)
+  void* ptr = hz6_win_virtualalloc_reserve(rounded, page_size);
+#else
+  void* ptr = hz6_linux_mmap_reserve(rounded, page_size);
+#endif
+  if (!ptr) {
+    return NULL;
+  }
+  memset(ptr, 0, rounded);
+  *out_bytes = rounded;
+  return ptr;
+}
+
+static void hz6_route_radix_storage_free(void* ptr, size_t bytes) {
+  if (!ptr || bytes == 0) {
+    return;
+  }
+  size_t rounded = hz6_source_round_up(bytes, hz6_route_radix_os_page_size());
+#if defined(_WIN32)
+  (void)hz6_win_virtualalloc_release(ptr, rounded);
+#else
+  (void)hz6_linux_mmap_release(ptr, rounded);
+#endif
+}
+
+static inline int hz6_route_radix_addr_ok(uintptr_t addr) {
+  return (addr >> HZ6_ROUTE_RADIX_ADDRESS_BITS) == 0;
+}
+
+static inline uintptr_t hz6_route_radix_page(uintptr_t addr) {
+  return addr >> HZ6_ROUTE_RADIX_PAGE_SHIFT;
+}
+
+static inline size_t hz6_route_radix_root_index(uintptr_t page) {
+  return (size_t)(page >>
+                  (HZ6_ROUTE_RADIX_MID_BITS + HZ6_ROUTE_RADIX_LEAF_BITS));
+}
+
+static inline size_t hz6_route_radix_mid_index(uintptr_t page) {
+  return (size_t)(page >> HZ6_ROUTE_RADIX_LEAF_BITS) &
+         (HZ6_ROUTE_RADIX_MID_SLOTS - 1u);
+}
+
+static inline size_t hz6_route_radix_leaf_index(uintptr_t page) {
+  return (size_t)page & (HZ6_ROUTE_RADIX_LEAF_SLOTS - 1u);
+}
+
+static inline uint32_t hz6_route_radix_pack_front_class(uint16_t front_id,
+                                                        uint16_t class_id) {
+  return ((uint32_t)front_id << 16) | (uint32_t)class_id;
+}
+
+static inline uint16_t hz6_route_radix_front_id(uint32_t front_class) {
+  return (uint16_t)(front_class >> 16);
+}
+
+static inline uint16_t hz6_route_radix_class_id(uint32_t front_class) {
+  return (uint16_t)(front_class & 0xffffu);
+}
+
+static Hz6RouteRadixSlot* hz6_route_radix_slot(const Hz6RouteRadix* radix,
+                                               uintptr_t page) {
+  Hz6RouteRadixRoot* root =
+      atomic_load_explicit(&radix->root, memory_order_acquire);
+  if (!root) {
+    return NULL;
+  }
+  Hz6RouteRadixMid* mid = atomic_load_explicit(
+      &root->mids[hz6_route_radix_root_index(page)], memory_order_acquire);
+  if (!mid) {
+    return NULL;
+  }
+  Hz6RouteRadixLeaf* leaf = atomic_load_explicit(
+      &mid->leaves[hz6_route_radix_mid_index(page)], memory_order_acquire);
+  if (!leaf) {
+    return NULL;
+  }
+  return &leaf->slots[hz6_route_radix_leaf_index(page)];
+}
+
+static Hz6RouteRadixSlot* hz6_route_radix_slot_ensure(Hz6RouteRadix* radix,
+                                                      uintptr_t page) {
+  size_t node_bytes = 0;
+  Hz6RouteRadixRoot* root =
+      atomic_load_explicit(&radix->root, memory_order_acquire);
+  if (!root) {
+    Hz6RouteRadixRoot* fresh = (Hz6RouteRadixRoot*)
+        hz6_route_radix_storage_alloc(sizeof(*fresh), &node_bytes);
+    if (!fresh) {
+      ++radix->alloc_fail;
+      return NULL;
+    }
+    Hz6RouteRadixRoot* expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(&radix->root, &expected,
+                                                fresh, memory_order_acq_rel,
+                                                memory_order_acquire)) {
+      radix->node_bytes += node_bytes;
+      root = fresh;
+    } else {
+      hz6_route_radix_storage_free(fresh, sizeof(*fresh));
+      root = expected;
+    }
+  }
+
+  _Atomic(Hz6RouteRadixMid*)* mid_ref =
+      &root->mids[hz6_route_radix_root_index(page)];
+  Hz6RouteRadixMid* mid = atomic_load_explicit(mid_ref, memory_order_acquire);
+  if (!mid) {
+    Hz6RouteRadixMid* fresh = (Hz6RouteRadixMid*)
+        hz6_route_radix_storage_alloc(sizeof(*fresh), &node_bytes);
+    if (!fresh) {
+      ++radix->alloc_fail;
+      return NULL;
+    }
+    Hz6RouteRadixMid* expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(mid_ref, &expected, fresh,
+                                                memory_order_acq_rel,
+                                                memory_order_acquire)) {
+      radix->node_bytes += node_bytes;
+      ++radix->mid_count;
+      mid = fresh;
+    } else {
+      hz6_route_radix_storage_free(fresh, sizeof(*fresh));
+      mid = expected;
+    }
+  }
+
+  _Atomic(Hz6RouteRadixLeaf*)* leaf_ref =
+      &mid->leaves[hz6_route_radix_mid_index(page)];
+  Hz6RouteRadixLeaf* leaf =
+      atomic_load_explicit(leaf_ref, memory_order_acquire);
+  if (!leaf) {
+    Hz6RouteRadixLeaf* fresh = (Hz6RouteRadixLeaf*)
+        hz6_route_radix_storage_alloc(sizeof(*fresh), &node_bytes);
+    if (!fresh) {
+      ++radix->alloc_fail;
+      return NULL;
+    }
+    Hz6RouteRadixLeaf* expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(leaf_ref, &expected, fresh,
+                                                memory_order_acq_rel,
+                                                memory_order_acquire)) {
+      radix->node_bytes += node_bytes;
+      ++radix->leaf_count;
+      leaf = fresh;
+    } else {
+      hz6_route_radix_storage_free(fresh, sizeof(*fresh));
+      leaf = expected;
+    }
+  }
+  return &leaf->slots[hz6_route_radix_leaf_index(page)];
+}
+
+static int hz6_route_radix_ensure_range(Hz6RouteRadix* radix,
+                                        uintptr_t first_page,
+                                        uintptr_t last_page) {
+  for (uintptr_t page = first_page; page <= last_page; ++page) {
+    if (!hz6_route_radix_slot_ensure(radix, page)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static Hz6RouteRadixRecord* hz6_route_radix_record_alloc(
+    Hz6RouteRadix* radix) {
+  if (!radix->free_records) {
+    size_t slab_bytes = 0;
+    Hz6RouteRadixSlab* slab = (Hz6RouteRadixSlab*)
+        hz6_route_radix_storage_alloc(HZ6_ROUTE_RADIX_RECORD_SLAB_BYTES,
+                                      &slab_bytes);
+    if (!slab) {
+      ++radix->alloc_fail;
+      return NULL;
+    }
+    slab->bytes = slab_bytes;
+    slab->next = radix->slabs;
+    radix->slabs = slab;
+    radix->slab_bytes += slab_bytes;
+
+    uintptr_t first = hz6_source_round_up(
+        (uintptr_t)(slab + 1), _Alignof(Hz6RouteRadixRecord));
+    size_t count = ((uintptr_t)slab + slab_bytes - first) /
+                   sizeof(Hz6RouteRadixRecord);
+    Hz6RouteRadixRecord* records = (Hz6RouteRadixRecord*)first;
+    for (size_t i = count; i > 0; --i) {
+      records[i - 1u].free_next = radix->free_records;
+      radix->free_records = &records[i - 1u];
+    }
+    radix->record_count += count;
+  }
+  Hz6RouteRadixRecord* record = radix->free_records;
+  if (record) {
+    radix->free_records = record->free_next;
+    record->free_next = NULL;
+  }
+  return record;
+}
+
+static void hz6_route_radix_live_push(Hz6RouteRadix* radix,
+                                      Hz6RouteRadixRecord* record) {
+  record->live_prev = NULL;
+  record->live_next = radix->live_records;
+  if (radix->live_records) {
+    radix->live_records->live_prev = record;
+  }
+  radix->live_records = record;
+  ++radix->active_count;
+}
+
+static void hz6_route_radix_live_remove(Hz6RouteRadix* radix,
+                                        Hz6RouteRadixRecord* record) {
+  if (record->live_prev) {
+    record->live_prev->live_next = record->live_next;
+  } else {
+    radix->live_records = record->live_next;
+  }
+  if (record->live_next) {
+    record->live_next->live_prev = record->live_prev;
+  }
+  record->live_prev = NULL;
+  record->live_next = NULL;
+  if (radix->active_count != 0) {
+    --radix->active_count;
+  }
+}
+
+static void hz6_route_radix_write_begin(Hz6RouteRadixRecord* record) {
+  unsigned int sequence =
+      atomic_load_explicit(&record->sequence, memory_order_relaxed);
+  atomic_store_explicit(&record->sequence, sequence + 1u,
+                        memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+}
+
+static void hz6_route_radix_write_end(Hz6RouteRadixRecord* record) {
+  unsigned int sequence =
+      atomic_load_explicit(&record->sequence, memory_order_relaxed);
+  atomic_store_explicit(&record->sequence, sequence + 1u,
+                        memory_order_release);
+}
+
+static int hz6_route_radix_read(const Hz6RouteRadixRecord* record,
+                                Hz6RouteRadixView* view) {
+  unsigned int before =
+      atomic_load_explicit(&record->sequence, memory_order_acquire);
+  if ((before & 1u) != 0) {
+    return 0;
+  }
+  view->flags = atomic_load_explicit(&record->flags, memory_order_relaxed);
+  view->front_class =
+      atomic_load_explicit(&record->front_class, memory_order_relaxed);
+  view->generation =
+      atomic_load_explicit(&record->generation, memory_order_relaxed);
+  view->base = atomic_load_explicit(&record->base, memory_order_relaxed);
+  view->end = atomic_load_explicit(&record->end, memory_order_relaxed);
+  view->descriptor =
+      atomic_load_explicit(&record->descriptor, memory_order_relaxed);
+  view->next = atomic_load_explicit(&record->next, memory_order_acquire);
+  atomic_thread_fence(memory_order_acquire);
+  return atomic_load_explicit(&record->sequence, memory_order_relaxed) ==
+         before;
+}
+
+/* Writer-side chain search; writers own the chain so plain relaxed loads are
+ * enough. */
+static Hz6RouteRadixRecord* hz6_route_radix_find(Hz6RouteRadixSlot* slot,
+                                                 uintptr_t base,
+                                                 uint32_t exact_flag,
+                                                 Hz6RouteRadixRecord** prev_out,
+                                                 size_t* probes) {
+  Hz6RouteRadixRecord* prev = NULL;
+  Hz6RouteRadixRecord* record =
+      atomic_load_explicit(&slot->head, memory_order_relaxed);
+  while (record) {
+    ++*probes;
+    uint32_t flags = atomic_load_explicit(&record->flags, memory_order_relaxed);
+    if ((flags & HZ6_ROUTE_RADIX_RECORD_ACTIVE) != 0 &&
+        (flags & HZ6_ROUTE_RADIX_RECORD_EXACT) == exact_flag &&
+        atomic_load_explicit(&record->base, memory_order_relaxed) == base) {
+      if (prev_out) {
+        *prev_out = prev;
+      }
+      return record;
+    }
+    prev = record;
+    record = atomic_load_explicit(&record->next, memory_order_relaxed);
+  }
+  return NULL;
+}
+
+static int hz6_route_radix_register(Hz6RouteRadix* radix,
+                                    void* base,
+                                    size_t bytes,
+                                    uint16_t front_id,
+                                    uint16_t class_id,
+                                    uint32_t generation,
+                                    void* descriptor,
+                                    uint32_t exact_flag,
+                                    size_t* probe_count) {
+  size_t probes = 0;
+  if (probe_count) {
+    *probe_count = 0;
+  }
+  uintptr_t addr = (uintptr_t)base;
+  uintptr_t end = addr + bytes;
+  if (!radix || !base || bytes == 0 || end < addr ||
+      !hz6_route_radix_addr_ok(end - 1u)) {
+    return 0;
+  }
+  uintptr_t first_page = hz6_route_radix_page(addr);
+  uintptr_t last_page = hz6_route_radix_page(end - 1u);
+  if (!hz6_route_radix_ensure_range(radix, first_page, last_page)) {
+    return 0;
+  }
+  Hz6RouteRadixSlot* slot = hz6_route_radix_slot(radix, first_page);
+  if (hz6_route_radix_find(slot, addr, exact_flag, NULL, &probes)) {
+    if (probe_count) {
+      *probe_count = probes;
+    }
+    return 0;
+  }
+  Hz6RouteRadixRecord* record = hz6_route_radix_record_alloc(radix);
+  if (!record) {
+    if (probe_count) {
+      *probe_count = probes;
+    }
+    return 0;
+  }
+
+  hz6_route_radix_write_begin(record);
+  atomic_store_explicit(&record->front_class,
+                        hz6_route_radix_pack_front_class(front_id, class_id),
+                        memory_order_relaxed);
+  atomic_store_explicit(&record->generation, generation,
+                        memory_order_relaxed);
+  atomic_store_explicit(&record->base, addr, memory_order_relaxed);
+  atomic_store_explicit(&record->end, end, memory_order_relaxed);
+  atomic_store_explicit(&record->descriptor, (uintptr_t)descriptor,
+                        memory_order_relaxed);
+  atomic_store_explicit(&record->next,
+                        atomic_load_explicit(&slot->head,
+                                             memory_order_relaxed),
+                        memory_order_relaxed);
+  atomic_store_explicit(&record->flags,
+                        exact_flag | HZ6_ROUTE_RADIX_RECORD_ACTIVE,
+                        memory_order_relaxed);
+  hz6_route_radix_write_end(record);
+  atomic_store_explicit(&slot->head, record, memory_order_release);
+
+  for (uintptr_t page = first_page + 1u; page <= last_page; ++page) {
+    Hz6RouteRadixSlot* span = hz6_route_radix_slot(radix, page);
+    ++probes;
+    atomic_store_explicit(exact_flag ? &span->exact_span : &span->invalid_span,
+                          record, memory_order_release);
+  }
+  hz6_route_radix_live_push(radix, record);
+  if (probe_count) {
+    *probe_count = probes;
+  }
+  return 1;
+}
+
+static void hz6_route_radix_unregister(Hz6RouteRadix* radix,
+                                       void* base,
+                                       uint32_t exact_flag,
+                                       size_t* probe_count) {
+  size_t probes = 0;
+  if (probe_count) {
+    *probe_count = 0;
+  }
+  uintptr_t addr = (uintptr_t)base;
+  if (!radix || !base || !hz6_route_radix_addr_ok(addr)) {
+    return;
+  }
+  uintptr_t first_page = hz6_route_radix_page(addr);
+  Hz6RouteRadixSlot* slot = hz6_route_radix_slot(radix, first_page);
+  if (!slot) {
+    return;
+  }
+  Hz6RouteRadixRecord* prev = NULL;
+  Hz6RouteRadixRecord* record =
+      hz6_route_radix_find(slot, addr, exact_flag, &prev, &probes);
+  if (!record) {
+    if (probe_count) {
+      *probe_count = probes;
+    }
+    return;
+  }
+
+  uintptr_t end = atomic_load_explicit(&record->end, memory_order_relaxed);
+  hz6_route_radix_write_begin(record);
+  atomic_store_explicit(&record->flags, 0u, memory_order_relaxed);
+  hz6_route_radix_write_end(record);
+
+  Hz6RouteRadixRecord* next =
+      atomic_load_explicit(&record->next, memory_order_relaxed);
+  if (prev) {
+    atomic_store_explicit(&prev->next, next, memory_order_release);
+  } else {
+    atomic_store_explicit(&slot->head, next, memory_order_release);
+  }
+  uintptr_t last_page = hz6_route_radix_page(end - 1u);
+  for (uintptr_t page = first_page + 1u; page <= last_page; ++page) {
+    Hz6RouteRadixSlot* span = hz6_route_radix_slot(radix, page);
+    ++probes;
+    if (!span) {
+      continue;
+    }
+    _Atomic(Hz6RouteRadixRecord*)* ref =
+        exact_flag ? &span->exact_span : &span->invalid_span;
+    if (atomic_load_explicit(ref, memory_order_relaxed) == record) {
+      atomic_store_explicit(ref, NULL, memory_order_release);
+    }
+  }
+  hz6_route_radix_live_remove(radix, record);
+  record->free_next = radix->free_records;
+  radix->free_records = record;
+  if (probe_count) {
+    *probe_count = probes;
+  }
+}
+
+void hz6_route_radix_init(Hz6RouteRadix* radix) {
+  if (!radix) {
+    return;
+  }
+  memset(radix, 0, sizeof(*radix));
+}
+
+void hz6_route_radix_destroy(Hz6RouteRadix* radix) {
+  if (!radix) {
+    return;
+  }
+  Hz6RouteRadixRoot* root =
+      atomic_load_explicit(&radix->root, memory_order_acquire);
+  if (root) {
+    for (size_t i = 0; i < HZ6_ROUTE_RADIX_ROOT_SLOTS; ++i) {
+      Hz6RouteRadixMid* mid =
+          atomic_load_explicit(&root->mids[i], memory_order_relaxed);
+      if (!mid) {
+        continue;
+      }
+      for (size_t j = 0; j < HZ6_ROUTE_RADIX_MID_SLOTS; ++j) {
+        Hz6RouteRadixLeaf* leaf =
+            atomic_load_explicit(&mid->leaves[j], memory_order_relaxed);
+        if (leaf) {
+          hz6_route_radix_storage_free(leaf, sizeof(*leaf));
+        }
+      }
+      hz6_route_radix_storage_free(mid, sizeof(*mid));
+    }
+    hz6_route_radix_storage_free(root, sizeof(*root));
+  }
+  Hz6RouteRadixSlab* slab = radix->slabs;
+  while (slab) {
+    Hz6RouteRadixSlab* next = slab->next;
+    hz6_route_radix_storage_free(slab, slab->bytes);
+    slab = next;
+  }
+  hz6_route_radix_init(radix);
+}
+
+int hz6_route_radix_register_exact(Hz6RouteRadix* radix,
+                                   void* base,
+                                   size_t bytes,
+                                   uint16_t front_id,
+                                   uint16_t class_id,
+                                   uint32_t generation,
+                                   void* descriptor,
+                                   size_t* probe_count) {
+  if (!descriptor) {
+    if (probe_count) {
+      *probe_count = 0;
+    }
+    return 0;
+  }
+  return hz6_route_radix_register(radix, base, bytes, front_id, class_id,
+                                  generation, descriptor,
+                                  HZ6_ROUTE_RADIX_RECORD_EXACT, probe_count);
+}
+
+int hz6_route_radix_register_invalid_range(Hz6RouteRadix* radix,
+                                           void* base,
+                                           size_t bytes,
+                                           uint16_t front_id,
+                                           uint16_t class_id,
+                                           size_t* probe_count) {
+  return hz6_route_radix_register(radix, base, bytes, front_id, class_id, 0,
+                                  NULL, 0u, probe_count);
+}
+
+int hz6_route_radix_replace_exact_descriptor(Hz6RouteRadix* radix,
+                                             void* base,
+                                             size_t bytes,
+                                             uint16_t front_id,
+                                             uint16_t class_id,
+                                             uint32_t old_generation,
+                                             void* old_descriptor,
+                                             uint32_t new_generation,
+                                             void* new_descriptor,
+                                             size_t* probe_count) {
+  size_t probes = 0;
+  if (probe_count) {
+    *probe_count = 0;
+  }
+  uintptr_t addr = (uintptr_t)base;
+  if (!radix || !base || bytes == 0 || !old_descriptor || !new_descriptor ||
+      !hz6_route_radix_addr_ok(addr)) {
+    return 0;
+  }
+  Hz6RouteRadixSlot* slot =
+      hz6_route_radix_slot(radix, hz6_route_radix_page(addr));
+  if (!slot) {
+    return 0;
+  }
+  Hz6RouteRadixRecord* record = hz6_route_radix_find(
+      slot, addr, HZ6_ROUTE_RADIX_RECORD_EXACT, NULL, &probes);
+  if (probe_count) {
+    *probe_count = probes;
+  }
+  if (!record ||
+      atomic_load_explicit(&record->descriptor, memory_order_relaxed) !=
+          (uintptr_t)old_descriptor ||
+      atomic_load_explicit(&record->generation, memory_order_relaxed) !=
+          old_generation ||
+      atomic_load_explicit(&record->end, memory_order_relaxed) !=
+          addr + bytes ||
+      atomic_load_explicit(&record->front_class, memory_order_relaxed) !=
+          hz6_route_radix_pack_front_class(front_id, class_id)) {
+    return 0;
+  }
+  hz6_route_radix_write_begin(record);
+  atomic_store_explicit(&record->descriptor, (uintptr_t)new_descriptor,
+                        memory_order_relaxed);
+  atomic_store_explicit(&record->generation, new_generation,
+                        memory_order_relaxed);
+  hz6_route_radix_write_end(record);
+  return 1;
+}
+
+void hz6_route_radix_unregister_exact(Hz6RouteRadix* radix,
+                                      void* base,
+                                      size_t* probe_count) {
+  hz6_route_radix_unregister(radix, base, HZ6_ROUTE_RADIX_RECORD_EXACT,
+                             probe_count);
+}
+
+void hz6_route_radix_unregister_invalid_range(Hz6RouteRadix* radix,
+                                              void* base,
+                                              size_t* probe_count) {
+  hz6_route_radix_unregister(radix, base, 0u, probe_count);
+}
+
+typedef enum Hz6RouteRadixScan {
+  HZ6_ROUTE_RADIX_SCAN_DONE = 0,
+  HZ6_ROUTE_RADIX_SCAN_RETRY = 1
+} Hz6RouteRadixScan;
+
+/* One lock-free pass over a page slot.  RETRY means a record changed under
+ * the reader (sequence moved, or a reused record now lives in another page);
+ * the caller restarts from the slot so it never trusts a torn route. */
+static Hz6RouteRadixScan hz6_route_radix_scan(const Hz6RouteRadixSlot* slot,
+                                              uintptr_t addr,
+                                              int exact_only,
+                                              Hz6RouteResult* result,
+                                              size_t* probes) {
+  uintptr_t page = hz6_route_radix_page(addr);
+  uintptr_t page_start = page << HZ6_ROUTE_RADIX_PAGE_SHIFT;
+  Hz6RouteResult invalid_range = hz6_route_miss();
+  Hz6RouteRadixView view;
+
+  Hz6RouteRadixRecord* record =
+      atomic_load_explicit(&slot->head, memory_order_acquire);
+  while (record) {
+    ++*probes;
+    if (!hz6_route_radix_read(record, &view)) {
+      return HZ6_ROUTE_RADIX_SCAN_RETRY;
+    }
+    if ((view.flags & HZ6_ROUTE_RADIX_RECORD_ACTIVE) != 0) {
+      if (hz6_route_radix_page(view.base) != page) {
+        return HZ6_ROUTE_RADIX_SCAN_RETRY;
+      }
+      uint16_t front_id = hz6_route_radix_front_id(view.front_class);
+      uint16_t class_id = hz6_route_radix_class_id(view.front_class);
+      if ((view.flags & HZ6_ROUTE_RADIX_RECORD_EXACT) != 0) {
+        if (addr == view.base) {
+          *result = hz6_route_valid(front_id, class_id, view.generation,
+                                    (void*)view.descriptor);
+          return HZ6_ROUTE_RADIX_SCAN_DONE;
+        }
+        if (!exact_only && addr > view.base && addr < view.end) {
+          *result = hz6_route_invalid(front_id, class_id);
+          return HZ6_ROUTE_RADIX_SCAN_DONE;
+        }
+      } else if (!exact_only && invalid_range.kind == HZ6_ROUTE_MISS &&
+                 addr >= view.base && addr < view.end) {
+        invalid_range = hz6_route_invalid(front_id, class_id);
+      }
+    }
+    record = view.next;
+  }
+  if (exact_only) {
+    *result = hz6_route_miss();
+    return HZ6_ROUTE_RADIX_SCAN_DONE;
+  }
+
+  record = atomic_load_explicit(&slot->exact_span, memory_order_acquire);
+  if (record) {
+    ++*probes;
+    if (!hz6_route_radix_read(record, &view)) {
+      return HZ6_ROUTE_RADIX_SCAN_RETRY;
+    }
+    if ((view.flags & HZ6_ROUTE_RADIX_RECORD_ACTIVE) != 0) {
+      if (view.base >= page_start || view.end <= page_start) {
+        return HZ6_ROUTE_RADIX_SCAN_RETRY;
+      }
+      if (addr < view.end) {
+        *result = hz6_route_invalid(hz6_route_radix_front_id(view.front_class),
+                                    hz6_route_radix_class_id(view.front_class));
+        return HZ6_ROUTE_RADIX_SCAN_DONE;
+      }
+    }
+  }
+  if (invalid_range.kind != HZ6_ROUTE_MISS) {
+    *result = invalid_range;
+    return HZ6_ROUTE_RADIX_SCAN_DONE;
+  }
+
+  record = atomic_load_explicit(&slot->invalid_span, memory_order_acquire);
+  if (record) {
+    ++*probes;
+    if (!hz6_route_radix_read(record, &view)) {
+      return HZ6_ROUTE_RADIX_SCAN_RETRY;
+    }
+    if ((view.flags & HZ6_ROUTE_RADIX_RECORD_ACTIVE) != 0) {
+      if (view.base >= page_start || view.end <= page_start) {
+        return HZ6_ROUTE_RADIX_SCAN_RETRY;
+      }
+      if (addr < view.end) {
+        *result = hz6_route_invalid(hz6_route_radix_front_id(view.front_class),
+                                    hz6_route_radix_class_id(view.front_class));
+        return HZ6_ROUTE_RADIX_SCAN_DONE;
+      }
+    }
+  }
+  *result = hz6_route_miss();
+  return HZ6_ROUTE_RADIX_SCAN_DONE;
+}
+
+static Hz6RouteResult hz6_route_radix_lookup_impl(const Hz6RouteRadix* radix,
+                                                  const void* ptr,
+                                                  int exact_only,
+                                                  size_t* probe_count) {
+  size_t probes = 0;
+  Hz6RouteResult result = hz6_route_miss();
+  uintptr_t addr = (uintptr_t)ptr;
+  if (radix && ptr && hz6_route_radix_addr_ok(addr)) {
+    const Hz6RouteRadixSlot* slot =
+        hz6_route_radix_slot(radix, hz6_route_radix_page(addr));
+    if (slot) {
+      while (hz6_route_radix_scan(slot, addr, exact_only, &result, &probes) ==
+             HZ6_ROUTE_RADIX_SCAN_RETRY) {
+      }
+    }
+  }
+  if (probe_count) {
+    *probe_count = probes;
+  }
+  return result;
+}
+
+Hz6RouteResult hz6_route_radix_lookup_exact_probe(const Hz6RouteRadix* radix,
+                                                  const void* ptr,
+                                                  size_t* probe_count) {
+  return hz6_route_radix_lookup_impl(radix, ptr, 1, probe_count);
+}
+
+Hz6RouteResult hz6_route_radix_lookup_probe(const Hz6RouteRadix* radix,
+                                            const void* ptr,
+                                            size_t* probe_count) {
+  return hz6_route_radix_lookup_impl(radix, ptr, 0, probe_count);
+}
@@ -0,0 +1,160 @@
+#ifndef HZ6_ROUTE_RADIX_H
+#define HZ6_ROUTE_RADIX_H
+
+#include "../include/hz6_config.h"
+#include "../include/hz6_contract.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* RadixRoute-L1: lazily populated root / mid / leaf tree over 48-bit user
+ * addresses at 4 KiB pages.  Writers are serialized by the route owner (the
+ * same contract as Hz6RouteTable); readers never lock.  Nodes and records are
+ * type-stable until hz6_route_radix_destroy(), and every record carries a
+ * sequence so a reader that races a writer retries instead of trusting a
+ * half-written route. */
+
+#define HZ6_ROUTE_RADIX_ADDRESS_BITS 48u
+#define HZ6_ROUTE_RADIX_PAGE_SHIFT 12u
+#define HZ6_ROUTE_RADIX_PAGE_BYTES ((size_t)1 << HZ6_ROUTE_RADIX_PAGE_SHIFT)
+#define HZ6_ROUTE_RADIX_ROOT_BITS                              \
+  (HZ6_ROUTE_RADIX_ADDRESS_BITS - HZ6_ROUTE_RADIX_PAGE_SHIFT - \
+   HZ6_ROUTE_RADIX_MID_BITS - HZ6_ROUTE_RADIX_LEAF_BITS)
+#define HZ6_ROUTE_RADIX_ROOT_SLOTS ((size_t)1 << HZ6_ROUTE_RADIX_ROOT_BITS)
+#define HZ6_ROUTE_RADIX_MID_SLOTS ((size_t)1 << HZ6_ROUTE_RADIX_MID_BITS)
+#define HZ6_ROUTE_RADIX_LEAF_SLOTS ((size_t)1 << HZ6_ROUTE_RADIX_LEAF_BITS)
+
+#define HZ6_ROUTE_RADIX_RECORD_EXACT 0x1u
+#define HZ6_ROUTE_RADIX_RECORD_ACTIVE 0x2u
+
+typedef struct Hz6RouteRadixRecord {
+  _Atomic(unsigned int) sequence;
+  _Atomic(uint32_t) flags;
+  _Atomic(uint32_t) front_class;
+  _Atomic(uint32_t) generation;
+  _Atomic(uintptr_t) base;
+  _Atomic(uintptr_t) end;
+  _Atomic(uintptr_t) descriptor;
+  /* Base-page chain.  Left intact on unregister so a reader parked on a
+   * retired record still reaches the rest of the chain. */
+  _Atomic(struct Hz6RouteRadixRecord*) next;
+  /* Writer-only links. */
+  struct Hz6RouteRadixRecord* free_next;
+  struct Hz6RouteRadixRecord* live_prev;
+  struct Hz6RouteRadixRecord* live_next;
+} Hz6RouteRadixRecord;
+
+/* head: records whose base lies in this page (exact and invalid mixed).
+ * exact_span / invalid_span: the record that covers this page's first byte
+ * from an earlier page, if any. */
+typedef struct Hz6RouteRadixSlot {
+  _Atomic(Hz6RouteRadixRecord*) head;
+  _Atomic(Hz6RouteRadixRecord*) exact_span;
+  _Atomic(Hz6RouteRadixRecord*) invalid_span;
+} Hz6RouteRadixSlot;
+
+typedef struct Hz6RouteRadixLeaf {
+  Hz6RouteRadixSlot slots[HZ6_ROUTE_RADIX_LEAF_SLOTS];
+} Hz6RouteRadixLeaf;
+
+typedef struct Hz6RouteRadixMid {
+  _Atomic(Hz6RouteRadixLeaf*) leaves[HZ6_ROUTE_RADIX_MID_SLOTS];
+} Hz6RouteRadixMid;
+
+typedef struct Hz6RouteRadixRoot {
+  _Atomic(Hz6RouteRadixMid*) mids[HZ6_ROUTE_RADIX_ROOT_SLOTS];
+} Hz6RouteRadixRoot;
+
+typedef struct Hz6RouteRadixSlab {
+  struct Hz6RouteRadixSlab* next;
+  size_t bytes;
+} Hz6RouteRadixSlab;
+
+typedef struct Hz6RouteRadix {
+  _Atomic(Hz6RouteRadixRoot*) root;
+  Hz6RouteRadixSlab* slabs;
+  Hz6RouteRadixRecord* free_records;
+  Hz6RouteRadixRecord* live_records;
+  size_t active_count;
+  size_t record_count;
+  size_t mid_count;
+  size_t leaf_count;
+  size_t node_bytes;
+  size_t slab_bytes;
+  size_t alloc_fail;
+} Hz6RouteRadix;
+
+void hz6_route_radix_init(Hz6RouteRadix* radix);
+void hz6_route_radix_destroy(Hz6RouteRadix* radix);
+
+int hz6_route_radix_register_exact(Hz6RouteRadix* radix,
+                                   void* base,
+                                   size_t bytes,
+                                   uint16_t front_id,
+                                   uint16_t class_id,
+                                   uint32_t generation,
+                                   void* descriptor,
+                                   size_t* probe_count);
+
+int hz6_route_radix_replace_exact_descriptor(Hz6RouteRadix* radix,
+                                             void* base,
+                                             size_t bytes,
+                                             uint16_t front_id,
+                                             uint16_t class_id,
+                                             uint32_t old_generation,
+                                             void* old_descriptor,
+                                             uint32_t new_generation,
+                                             void* new_descriptor,
+                                             size_t* probe_count);
+
+int hz6_route_radix_register_invalid_range(Hz6RouteRadix* radix,
+                                           void* base,
+                                           size_t bytes,
+                                           uint16_t front_id,
+                                           uint16_t class_id,
+                                           size_t* probe_count);
+
+void hz6_route_radix_unregister_exact(Hz6RouteRadix* radix,
+                                      void* base,
+                                      size_t* probe_count);
+
+void hz6_route_radix_unregister_invalid_range(Hz6RouteRadix* radix,
+                                              void* base,
+                                              size_t* probe_count);
+
+Hz6RouteResult hz6_route_radix_lookup_exact_probe(const Hz6RouteRadix* radix,
+                                                  const void* ptr,
+                                                  size_t* probe_count);
+
+Hz6RouteResult hz6_route_radix_lookup_probe(const Hz6RouteRadix* radix,
+                                            const void* ptr,
+                                            size_t* probe_count);
+
+/* Writer-side walk of live exact records; caller holds the route domain. */
+static inline const Hz6RouteRadixRecord* hz6_route_radix_first_live(
+    const Hz6RouteRadix* radix) {
+  return radix ? radix->live_records : NULL;
+}
+
+static inline int hz6_route_radix_record_exact(
+    const Hz6RouteRadixRecord* record) {
+  return (atomic_load_explicit(&record->flags, memory_order_relaxed) &
+          HZ6_ROUTE_RADIX_RECORD_EXACT) != 0;
+}
+
+static inline void* hz6_route_radix_record_descriptor(
+    const Hz6RouteRadixRecord* record) {
+  return (void*)atomic_load_explicit(&record->descriptor,
+                                     memory_order_relaxed);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -32,6 +32,13 @@ typedef struct Hz6LinuxMmapRetainStats {
 
 Hz6LinuxMmapRetainStats hz6_linux_mmap_retain_stats_snapshot(void);
 size_t hz6_linux_mmap_retain_flush(size_t max_bytes);
+/* Blocks for up to timeout_ms; returns 1 early once retained bytes reach
+ * pressure_bytes (0 disables the early wake). */
+int hz6_linux_mmap_retain_wait(size_t pressure_bytes, unsigned timeout_ms);
+/* pthread_atfork handlers for a process that runs a retain waiter. */
+void hz6_linux_mmap_retain_fork_prepare(void);
+void hz6_linux_mmap_retain_fork_parent(void);
+void hz6_linux_mmap_retain_fork_child(void);
 size_t hz6_linux_page_size(void);
 void* hz6_linux_mmap_reserve(size_t bytes, size_t align);
 int hz6_linux_mmap_release(void* p, size_t bytes);
@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include <stdatomic.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
 #if HZ6_LINUX_MMAP_RETAIN_L1
@@ -44,6 +45,24 @@ static void hz6_linux_mmap_retain_counter_inc(atomic_size_t* counter) {
   atomic_fetch_add_explicit(counter, 1u, memory_order_relaxed);
 }
 
+/* Pressure doorbell for a background trimmer.  Only the waiter arms it, so
+ * lanes without one pay a single load under the retain lock per put. */
+static pthread_cond_t g_hz6_linux_mmap_retain_pressure_cond;
+static int g_hz6_linux_mmap_retain_pressure_cond_ready;
+static size_t g_hz6_linux_mmap_retain_pressure_waiters;
+static size_t g_hz6_linux_mmap_retain_pressure_bytes;
+static int g_hz6_linux_mmap_retain_pressure_signaled;
+
+static void hz6_linux_mmap_retain_pressure_note_locked(void) {
+  if (g_hz6_linux_mmap_retain_pressure_waiters != 0 &&
+      !g_hz6_linux_mmap_retain_pressure_signaled &&
+      g_hz6_linux_mmap_retained_bytes >=
+          g_hz6_linux_mmap_retain_pressure_bytes) {
+    g_hz6_linux_mmap_retain_pressure_signaled = 1;
+    pthread_cond_signal(&g_hz6_linux_mmap_retain_pressure_cond);
+  }
+}
+
 #if HZ6_LINUX_MMAP_RETAIN_64K_STACK_L1
 #define HZ6_LINUX_MMAP_RETAIN_64K_BYTES ((size_t)64u * 1024u)
 
@@ -152,6 +171,7 @@ static int hz6_linux_mmap_retain_put_global(void* ptr, size_t bytes) {
       g_hz6_linux_mmap_retained_64k
           [g_hz6_linux_mmap_retained_64k_count++] = ptr;
       g_hz6_linux_mmap_retained_bytes += bytes;
+      hz6_linux_mmap_retain_pressure_note_locked();
       pthread_mutex_unlock(&g_hz6_linux_mmap_retain_mutex);
       hz6_linux_mmap_retain_counter_inc(
           &g_hz6_linux_mmap_retain_64k_put_hit);
@@ -173,6 +193,7 @@ static int hz6_linux_mmap_retain_put_global(void* ptr, size_t bytes) {
       }
     }
   }
+  hz6_linux_mmap_retain_pressure_note_locked();
   pthread_mutex_unlock(&g_hz6_linux_mmap_retain_mutex);
   if (retained) {
     hz6_linux_mmap_retain_counter_inc(
@@ -319,6 +340,80 @@ size_t hz6_linux_mmap_retain_flush(size_t max_bytes) {
 #endif
 }
 
+int hz6_linux_mmap_retain_wait(size_t pressure_bytes, unsigned timeout_ms) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+  deadline.tv_sec += (time_t)(timeout_ms / 1000u);
+  deadline.tv_nsec += (long)(timeout_ms % 1000u) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    ++deadline.tv_sec;
+    deadline.tv_nsec -= 1000000000L;
+  }
+
+#if HZ6_LINUX_MMAP_RETAIN_L1
+  int pressure = 0;
+  pthread_mutex_lock(&g_hz6_linux_mmap_retain_mutex);
+  if (!g_hz6_linux_mmap_retain_pressure_cond_ready) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_hz6_linux_mmap_retain_pressure_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    g_hz6_linux_mmap_retain_pressure_cond_ready = 1;
+  }
+  if (pressure_bytes != 0 &&
+      g_hz6_linux_mmap_retained_bytes >= pressure_bytes) {
+    pressure = 1;
+  } else {
+    g_hz6_linux_mmap_retain_pressure_bytes =
+        pressure_bytes != 0 ? pressure_bytes : (size_t)-1;
+    g_hz6_linux_mmap_retain_pressure_signaled = 0;
+    ++g_hz6_linux_mmap_retain_pressure_waiters;
+    while (!g_hz6_linux_mmap_retain_pressure_signaled) {
+      if (pthread_cond_timedwait(&g_hz6_linux_mmap_retain_pressure_cond,
+                                 &g_hz6_linux_mmap_retain_mutex,
+                                 &deadline) == ETIMEDOUT) {
+        break;
+      }
+    }
+    --g_hz6_linux_mmap_retain_pressure_waiters;
+    pressure = g_hz6_linux_mmap_retain_pressure_signaled;
+    g_hz6_linux_mmap_retain_pressure_signaled = 0;
+  }
+  pthread_mutex_unlock(&g_hz6_linux_mmap_retain_mutex);
+  return pressure;
+#else
+  (void)pressure_bytes;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) ==
+         EINTR) {
+  }
+  return 0;
+#endif
+}
+
+void hz6_linux_mmap_retain_fork_prepare(void) {
+#if HZ6_LINUX_MMAP_RETAIN_L1
+  pthread_mutex_lock(&g_hz6_linux_mmap_retain_mutex);
+#endif
+}
+
+void hz6_linux_mmap_retain_fork_parent(void) {
+#if HZ6_LINUX_MMAP_RETAIN_L1
+  pthread_mutex_unlock(&g_hz6_linux_mmap_retain_mutex);
+#endif
+}
+
+void hz6_linux_mmap_retain_fork_child(void) {
+#if HZ6_LINUX_MMAP_RETAIN_L1
+  /* Only the forking thread survives: the lock and the doorbell state may
+   * still name the parent's waiter, so start both over. */
+  pthread_mutex_init(&g_hz6_linux_mmap_retain_mutex, NULL);
+  g_hz6_linux_mmap_retain_pressure_cond_ready = 0;
+  g_hz6_linux_mmap_retain_pressure_waiters = 0;
+  g_hz6_linux_mmap_retain_pressure_signaled = 0;
+#endif
+}
+
 size_t hz6_linux_page_size(void) {
   long value = sysconf(_SC_PAGESIZE);
   return value > 0 ? (size_t)value : (size_t)4096;
@@ -199,6 +199,35 @@ int main(void) {
   }
   hz6_allocator_destroy(&midpage_allocator);
 
+  Hz6Allocator radix_allocator;
+  hz6_allocator_init_with_profile(&radix_allocator, HZ6_PROFILE_LARGE_HEAP);
+  if (!expect(hz6_allocator_route_backend_kind(&radix_allocator) ==
+                  HZ6_ROUTE_BACKEND_RADIX,
+              "large-heap profile radix route backend")) {
+    return 1;
+  }
+  void* radix_objects[HZ6_OBJECT_DESCRIPTOR_CAPACITY];
+  for (size_t i = 0; i < HZ6_OBJECT_DESCRIPTOR_CAPACITY; ++i) {
+    radix_objects[i] = hz6_malloc(&radix_allocator, 16384);
+    if (!expect(radix_objects[i] != NULL, "radix midpage malloc") ||
+        !expect(hz6_allocator_route_lookup(&radix_allocator, radix_objects[i])
+                        .kind == HZ6_ROUTE_VALID,
+                "radix midpage route valid")) {
+      return 1;
+    }
+  }
+  for (size_t i = 0; i < HZ6_OBJECT_DESCRIPTOR_CAPACITY; ++i) {
+    hz6_free(&radix_allocator, radix_objects[i]);
+  }
+  if (!smoke_large_span_roundtrip(&radix_allocator, 70000,
+                                  HZ6_LARGE128_CLASS_ID,
+                                  HZ6_LARGE128_BYTES) ||
+      !smoke_large_direct_release(&radix_allocator,
+                                  HZ6_LARGE1M_BYTES * 2, 1)) {
+    return 1;
+  }
+  hz6_allocator_destroy(&radix_allocator);
+
   Hz6Allocator large_allocator;
   hz6_allocator_init_with_profile(&large_allocator, HZ6_PROFILE_REMOTE);
   if (!smoke_large_span_roundtrip(&large_allocator, 70000,
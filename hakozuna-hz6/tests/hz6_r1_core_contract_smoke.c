@@ -48,6 +48,7 @@ int main(void) {
   Hz6ProfileConfig rss = hz6_profile_config(HZ6_PROFILE_RSS);
   Hz6ProfileConfig strict = hz6_profile_config(HZ6_PROFILE_STRICT);
   Hz6ProfileConfig remote = hz6_profile_config(HZ6_PROFILE_REMOTE);
+  Hz6ProfileConfig large_heap = hz6_profile_config(HZ6_PROFILE_LARGE_HEAP);
   if (!expect(speed.transfer_first == 1, "speed transfer-first") ||
       !expect(speed.transfer_shards == 4, "speed transfer shards") ||
       !expect(speed.transfer_shard_policy == HZ6_TRANSFER_SHARD_OWNER_SLOT,
@@ -76,7 +77,13 @@ int main(void) {
       !expect(remote.route_page_granularity == HZ6_ROUTE_PAGE_GRANULARITY,
               "remote page route") ||
       !expect(remote.source_kind == HZ6_SOURCE_OS_PAGED,
-              "remote source kind")) {
+              "remote source kind") ||
+      !expect(large_heap.route_backend_policy == HZ6_ROUTE_POLICY_RADIX,
+              "large-heap radix route policy") ||
+      !expect(large_heap.transfer_first == speed.transfer_first,
+              "large-heap speed transfer-first") ||
+      !expect(large_heap.source_batch == speed.source_batch,
+              "large-heap speed source batch")) {
     return 1;
   }
   Hz6ProfileConfig class_shard = remote;
@@ -2,8 +2,11 @@
 #include "../route/hz6_route.h"
 #include "../route/hz6_route_backend.h"
 
+#include <stdint.h>
 #include <stdio.h>
 
+static _Alignas(4096) unsigned char radix_run[4 * 4096];
+
 typedef struct SmokeDescriptor {
   int marker;
 } SmokeDescriptor;
@@ -235,6 +238,105 @@ int main(void) {
     return 1;
   }
 
+  Hz6RouteEntry radix_backend_entries[4];
+  Hz6RouteBackend radix_backend;
+  hz6_route_backend_init_radix(&radix_backend, radix_backend_entries, 4);
+  if (!expect(radix_backend.kind == HZ6_ROUTE_BACKEND_RADIX,
+              "radix route backend kind") ||
+      !expect(radix_backend.page_granularity == HZ6_ROUTE_RADIX_PAGE_BYTES,
+              "radix route backend granularity")) {
+    return 1;
+  }
+  /* More routes than the exact table holds: radix records are not capped by
+   * HZ6_ROUTE_TABLE_CAPACITY. */
+  for (size_t i = 0; i < 16; ++i) {
+    if (!expect(hz6_route_backend_register_exact(
+                    &radix_backend, radix_run + i * 64, 64,
+                    HZ6_FRONT_LOCAL2P, 7, (uint32_t)(30 + i), &descriptor,
+                    NULL),
+                "radix route backend register")) {
+      return 1;
+    }
+  }
+  Hz6RouteResult radix_exact =
+      hz6_route_backend_lookup(&radix_backend, radix_run + 5 * 64);
+  if (!expect(hz6_route_backend_active_count(&radix_backend) == 16,
+              "radix route backend active count") ||
+      !expect(radix_backend.exact_table.active_count == 0,
+              "radix route backend exact table empty") ||
+      !expect(radix_exact.kind == HZ6_ROUTE_VALID,
+              "radix route backend valid") ||
+      !expect(radix_exact.generation == 35,
+              "radix route backend generation") ||
+      !expect(radix_exact.descriptor == &descriptor,
+              "radix route backend descriptor") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 5 * 64 + 8)
+                      .kind == HZ6_ROUTE_INVALID,
+              "radix route backend invalid") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 16 * 64)
+                      .kind == HZ6_ROUTE_MISS,
+              "radix route backend end miss") ||
+      !expect(!hz6_route_backend_register_exact(
+                  &radix_backend, radix_run, 64, HZ6_FRONT_LOCAL2P, 7, 99,
+                  &descriptor, NULL),
+              "radix route backend duplicate rejected")) {
+    return 1;
+  }
+  for (size_t i = 0; i < 16; ++i) {
+    hz6_route_backend_unregister_exact(&radix_backend, radix_run + i * 64,
+                                       NULL);
+  }
+  if (!expect(hz6_route_backend_lookup(&radix_backend, radix_run + 5 * 64)
+                      .kind == HZ6_ROUTE_MISS,
+              "radix route backend unregister") ||
+      !expect(hz6_route_backend_active_count(&radix_backend) == 0,
+              "radix route backend drained")) {
+    return 1;
+  }
+  /* Multi-page spans: an exact route and an invalid range crossing pages. */
+  if (!expect(hz6_route_backend_register_invalid_range(
+                  &radix_backend, radix_run, sizeof(radix_run),
+                  HZ6_FRONT_MIDPAGE, 4, NULL),
+              "radix route backend invalid range register") ||
+      !expect(hz6_route_backend_register_exact(
+                  &radix_backend, radix_run + 4096 + 512, 2 * 4096,
+                  HZ6_FRONT_MIDPAGE, 4, 41, &route_run_descriptor, NULL),
+              "radix route backend exact inside invalid range") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 4096 + 512)
+                      .kind == HZ6_ROUTE_VALID,
+              "radix route backend exact range priority") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 3 * 4096)
+                      .kind == HZ6_ROUTE_INVALID,
+              "radix route backend span interior invalid") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 3 * 4096 +
+                                                           1024)
+                      .kind == HZ6_ROUTE_INVALID,
+              "radix route backend range tail invalid") ||
+      !expect(hz6_route_backend_lookup(&radix_backend,
+                                       radix_run + sizeof(radix_run))
+                      .kind == HZ6_ROUTE_MISS,
+              "radix route backend range end miss")) {
+    return 1;
+  }
+  hz6_route_backend_unregister_invalid_range(&radix_backend, radix_run, NULL);
+  if (!expect(hz6_route_backend_lookup(&radix_backend, radix_run + 2 * 4096)
+                      .kind == HZ6_ROUTE_INVALID,
+              "radix route backend exact span after range") ||
+      !expect(hz6_route_backend_lookup(&radix_backend, radix_run + 3 * 4096 +
+                                                           1024)
+                      .kind == HZ6_ROUTE_MISS,
+              "radix route backend range cleanup")) {
+    return 1;
+  }
+  hz6_route_backend_unregister_exact(&radix_backend, radix_run + 4096 + 512,
+                                     NULL);
+  if (!expect(hz6_route_backend_lookup(&radix_backend, radix_run + 2 * 4096)
+                      .kind == HZ6_ROUTE_MISS,
+              "radix route backend span cleanup")) {
+    return 1;
+  }
+  hz6_route_backend_destroy(&radix_backend);
+
   printf("hz6-r1-route-smoke ok\n");
   return 0;
 }
@@ -250,6 +250,73 @@ int main(void) {
     return 1;
   }
 
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  Hz6TransferObject adapt_objects[8];
+  Hz6TransferBackend adapt_backend;
+  hz6_transfer_backend_init_sharded(&adapt_backend, adapt_objects, 8, 4);
+  if (!expect(hz6_transfer_backend_active_shards(&adapt_backend) == 4,
+              "transfer adaptive starts at profile shards")) {
+    return 1;
+  }
+  for (uint32_t i = 0; i < HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS; ++i) {
+    hz6_transfer_backend_adapt_window(&adapt_backend);
+  }
+  if (!expect(hz6_transfer_backend_active_shards(&adapt_backend) == 2,
+              "transfer adaptive quiet shrink")) {
+    return 1;
+  }
+  for (uint32_t i = 0; i < HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS; ++i) {
+    hz6_transfer_backend_adapt_window(&adapt_backend);
+  }
+  Hz6TransferObject adapt_parked = object_a;
+  adapt_parked.ptr = object + 96;
+  if (!expect(hz6_transfer_backend_active_shards(&adapt_backend) == 1,
+              "transfer adaptive single shard") ||
+      !expect(hz6_transfer_backend_push_to_shard(&adapt_backend, object_a, 3),
+              "transfer adaptive push folds to shard zero") ||
+      !expect(hz6_transfer_backend_shard_count_at(&adapt_backend, 0) == 1,
+              "transfer adaptive shard zero count")) {
+    return 1;
+  }
+  /* A window of spills / contended locks against shard zero grows it. */
+  for (uint32_t i = 0; i < HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS; ++i) {
+    hz6_transfer_backend_adapt_note_event(&adapt_backend, 0);
+  }
+  hz6_transfer_backend_adapt_window(&adapt_backend);
+  if (!expect(hz6_transfer_backend_active_shards(&adapt_backend) == 2,
+              "transfer adaptive contention grow") ||
+      !expect(hz6_transfer_backend_shard_contention_at(&adapt_backend, 0) ==
+                  HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS,
+              "transfer adaptive shard contention") ||
+      !expect(hz6_transfer_backend_push_to_shard(&adapt_backend,
+                                                 adapt_parked, 3),
+              "transfer adaptive push after grow") ||
+      !expect(hz6_transfer_backend_shard_count_at(&adapt_backend, 1) == 1,
+              "transfer adaptive grown shard used")) {
+    return 1;
+  }
+  /* Shrinking back must not strand the object parked in shard one. */
+  for (uint32_t i = 0; i < HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS; ++i) {
+    hz6_transfer_backend_adapt_window(&adapt_backend);
+  }
+  Hz6TransferObject adapt_popped;
+  if (!expect(hz6_transfer_backend_active_shards(&adapt_backend) == 1,
+              "transfer adaptive shrink after quiet") ||
+      !expect(hz6_transfer_backend_pop_from_shard(&adapt_backend, 7, 0,
+                                                  &adapt_popped),
+              "transfer adaptive pop first") ||
+      !expect(hz6_transfer_backend_pop_from_shard(&adapt_backend, 7, 0,
+                                                  &adapt_popped),
+              "transfer adaptive pop retired shard") ||
+      !expect(adapt_popped.ptr == adapt_parked.ptr ||
+                  adapt_popped.ptr == object_a.ptr,
+              "transfer adaptive retired pointer") ||
+      !expect(hz6_transfer_backend_count(&adapt_backend) == 0,
+              "transfer adaptive empty")) {
+    return 1;
+  }
+#endif
+
   printf("hz6-r1-transfer-contract-smoke ok\n");
   return 0;
 }
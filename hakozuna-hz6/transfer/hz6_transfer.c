@@ -10,6 +10,14 @@ static void hz6_transfer_lock(Hz6TransferCache* cache) {
   if (!cache) {
     return;
   }
+  if (!atomic_flag_test_and_set_explicit(&cache->lock,
+                                         memory_order_acquire)) {
+    return;
+  }
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  atomic_fetch_add_explicit(&cache->lock_contention, 1u,
+                            memory_order_relaxed);
+#endif
   while (atomic_flag_test_and_set_explicit(&cache->lock,
                                            memory_order_acquire)) {
   }
@@ -221,6 +229,9 @@ void hz6_transfer_init(Hz6TransferCache* cache,
   cache->count = 0;
 #if HZ6_TRANSFER_CACHE_LOCK_L1
   atomic_flag_clear_explicit(&cache->lock, memory_order_release);
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  atomic_store_explicit(&cache->lock_contention, 0, memory_order_relaxed);
+#endif
 #endif
 #if HZ6_TRANSFER_CLASS_PRESENCE_GATE_L1
   for (size_t i = 0; i < HZ6_FRONT_CACHE_CLASS_COUNT; ++i) {
@@ -42,6 +42,10 @@ typedef struct Hz6TransferCache {
   size_t count;
 #if HZ6_TRANSFER_CACHE_LOCK_L1
   atomic_flag lock;
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  /* Contended acquires since the adaptive backend last drained it. */
+  _Atomic uint32_t lock_contention;
+#endif
 #endif
 #if HZ6_TRANSFER_CLASS_PRESENCE_GATE_L1
   _Atomic uint32_t class_count[HZ6_FRONT_CACHE_CLASS_COUNT];
@@ -10,6 +10,9 @@ void hz6_transfer_backend_init_single(Hz6TransferBackend* backend,
   backend->shard_count = 0;
   backend->next_push_shard = 0;
   hz6_transfer_init(&backend->single_cache, objects, capacity);
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_reset(backend);
+#endif
 }
 
 int hz6_transfer_backend_push(Hz6TransferBackend* backend,
@@ -4,6 +4,10 @@
 #include "../include/hz6_config.h"
 #include "hz6_transfer.h"
 
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+#include <stdatomic.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,8 +23,29 @@ typedef struct Hz6TransferBackend {
   Hz6TransferCache shard[HZ6_TRANSFER_SHARD_COUNT];
   size_t shard_count;
   size_t next_push_shard;
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  /* Shards that producers and consumers start from, 1..shard_count. */
+  _Atomic size_t active_shards;
+  _Atomic uint32_t window_ops;
+  _Atomic uint32_t window_events;
+  _Atomic uint32_t quiet_windows;
+  _Atomic size_t shard_events[HZ6_TRANSFER_SHARD_COUNT];
+  _Atomic size_t grow_count;
+  _Atomic size_t shrink_count;
+#endif
 } Hz6TransferBackend;
 
+/* Start shard for a producer / consumer hint.  Probes still walk all
+ * shard_count shards from there. */
+static inline size_t hz6_transfer_backend_active_shards(
+    const Hz6TransferBackend* backend) {
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  return atomic_load_explicit(&backend->active_shards, memory_order_relaxed);
+#else
+  return backend->shard_count;
+#endif
+}
+
 void hz6_transfer_backend_init_single(Hz6TransferBackend* backend,
                                       Hz6TransferObject* objects,
                                       size_t capacity);
@@ -74,6 +99,24 @@ size_t hz6_transfer_backend_shard_capacity_at(
     const Hz6TransferBackend* backend,
     size_t shard_index);
 
+size_t hz6_transfer_backend_shard_contention_at(
+    const Hz6TransferBackend* backend,
+    size_t shard_index);
+
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+void hz6_transfer_backend_adapt_reset(Hz6TransferBackend* backend);
+
+/* Records one contention event against the shard a probe started from. */
+void hz6_transfer_backend_adapt_note_event(Hz6TransferBackend* backend,
+                                           size_t shard_index);
+
+/* Counts one push/pop; every WINDOW-th call evaluates the window. */
+void hz6_transfer_backend_adapt_tick(Hz6TransferBackend* backend);
+
+/* Closes the current window and resizes the active shard count. */
+void hz6_transfer_backend_adapt_window(Hz6TransferBackend* backend);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
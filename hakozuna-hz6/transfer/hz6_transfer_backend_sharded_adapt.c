@@ -0,0 +1,111 @@
+/* TransferAdaptiveShards-L1: resizes the active shard count of a sharded
+ * transfer backend from per-window contention.  Producers and consumers start
+ * probing at hint % active; the probes themselves still cover every physical
+ * shard, so a shrink never strands objects in a retired shard. */
+#include "hz6_transfer_backend.h"
+
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+
+void hz6_transfer_backend_adapt_reset(Hz6TransferBackend* backend) {
+  if (!backend) {
+    return;
+  }
+  /* Start at the profile shape; quiet windows shrink it toward one shard. */
+  atomic_store_explicit(&backend->active_shards, backend->shard_count,
+                        memory_order_relaxed);
+  atomic_store_explicit(&backend->window_ops, 0, memory_order_relaxed);
+  atomic_store_explicit(&backend->window_events, 0, memory_order_relaxed);
+  atomic_store_explicit(&backend->quiet_windows, 0, memory_order_relaxed);
+  for (size_t i = 0; i < HZ6_TRANSFER_SHARD_COUNT; ++i) {
+    atomic_store_explicit(&backend->shard_events[i], 0,
+                          memory_order_relaxed);
+  }
+  atomic_store_explicit(&backend->grow_count, 0, memory_order_relaxed);
+  atomic_store_explicit(&backend->shrink_count, 0, memory_order_relaxed);
+}
+
+void hz6_transfer_backend_adapt_note_event(Hz6TransferBackend* backend,
+                                           size_t shard_index) {
+  if (!backend || shard_index >= backend->shard_count) {
+    return;
+  }
+  atomic_fetch_add_explicit(&backend->window_events, 1u,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&backend->shard_events[shard_index], 1u,
+                            memory_order_relaxed);
+}
+
+void hz6_transfer_backend_adapt_tick(Hz6TransferBackend* backend) {
+  if (!backend || backend->kind != HZ6_TRANSFER_BACKEND_SHARDED_CACHE) {
+    return;
+  }
+  uint32_t ops = atomic_fetch_add_explicit(&backend->window_ops, 1u,
+                                           memory_order_relaxed) +
+                 1u;
+  if ((ops & (HZ6_TRANSFER_ADAPTIVE_SHARDS_WINDOW - 1u)) == 0) {
+    hz6_transfer_backend_adapt_window(backend);
+  }
+}
+
+static uint32_t hz6_transfer_backend_adapt_drain_lock_events(
+    Hz6TransferBackend* backend) {
+  uint32_t events = 0;
+#if HZ6_TRANSFER_CACHE_LOCK_L1
+  for (size_t i = 0; i < backend->shard_count; ++i) {
+    uint32_t shard_events = atomic_exchange_explicit(
+        &backend->shard[i].lock_contention, 0, memory_order_relaxed);
+    if (shard_events != 0) {
+      atomic_fetch_add_explicit(&backend->shard_events[i], shard_events,
+                                memory_order_relaxed);
+      events += shard_events;
+    }
+  }
+#else
+  (void)backend;
+#endif
+  return events;
+}
+
+void hz6_transfer_backend_adapt_window(Hz6TransferBackend* backend) {
+  if (!backend || backend->kind != HZ6_TRANSFER_BACKEND_SHARDED_CACHE) {
+    return;
+  }
+  /* One caller per window: the tick that lands on the window boundary.
+   * Events racing in during the exchange roll into the next window. */
+  uint32_t events = atomic_exchange_explicit(&backend->window_events, 0,
+                                             memory_order_relaxed);
+  events += hz6_transfer_backend_adapt_drain_lock_events(backend);
+
+  size_t active =
+      atomic_load_explicit(&backend->active_shards, memory_order_relaxed);
+  if (events >= HZ6_TRANSFER_ADAPTIVE_SHARDS_GROW_EVENTS) {
+    atomic_store_explicit(&backend->quiet_windows, 0, memory_order_relaxed);
+    if (active < backend->shard_count) {
+      size_t grown = active * 2u;
+      if (grown > backend->shard_count) {
+        grown = backend->shard_count;
+      }
+      atomic_store_explicit(&backend->active_shards, grown,
+                            memory_order_relaxed);
+      atomic_fetch_add_explicit(&backend->grow_count, 1u,
+                                memory_order_relaxed);
+    }
+    return;
+  }
+  if (events > HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_EVENTS) {
+    atomic_store_explicit(&backend->quiet_windows, 0, memory_order_relaxed);
+    return;
+  }
+  uint32_t quiet = atomic_fetch_add_explicit(&backend->quiet_windows, 1u,
+                                             memory_order_relaxed) +
+                   1u;
+  if (quiet < HZ6_TRANSFER_ADAPTIVE_SHARDS_SHRINK_WINDOWS || active <= 1u) {
+    return;
+  }
+  atomic_store_explicit(&backend->quiet_windows, 0, memory_order_relaxed);
+  atomic_store_explicit(&backend->active_shards, active / 2u,
+                        memory_order_relaxed);
+  atomic_fetch_add_explicit(&backend->shrink_count, 1u, memory_order_relaxed);
+}
+
+#endif
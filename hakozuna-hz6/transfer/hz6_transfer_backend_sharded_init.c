@@ -37,4 +37,7 @@ void hz6_transfer_backend_init_sharded(Hz6TransferBackend* backend,
   for (size_t i = shard_count; i < HZ6_TRANSFER_SHARD_COUNT; ++i) {
     hz6_transfer_init(&backend->shard[i], NULL, 0);
   }
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_reset(backend);
+#endif
 }
@@ -15,7 +15,10 @@ int hz6_transfer_backend_pop_from_shard(Hz6TransferBackend* backend,
     return 0;
   }
 
-  size_t start = home_shard % backend->shard_count;
+  size_t start = home_shard % hz6_transfer_backend_active_shards(backend);
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_tick(backend);
+#endif
   for (size_t i = 0; i < backend->shard_count; ++i) {
     size_t shard_index = (start + i) % backend->shard_count;
     if (hz6_transfer_pop(&backend->shard[shard_index], class_id, out)) {
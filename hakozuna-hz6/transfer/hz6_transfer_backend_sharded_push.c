@@ -14,14 +14,25 @@ int hz6_transfer_backend_push_to_shard(Hz6TransferBackend* backend,
     return 0;
   }
 
-  size_t start = producer_shard % backend->shard_count;
+  size_t start = producer_shard % hz6_transfer_backend_active_shards(backend);
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_tick(backend);
+#endif
   for (size_t i = 0; i < backend->shard_count; ++i) {
     size_t shard_index = (start + i) % backend->shard_count;
     if (hz6_transfer_push(&backend->shard[shard_index], object)) {
       backend->next_push_shard = (shard_index + 1u) % backend->shard_count;
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+      if (i != 0) {
+        hz6_transfer_backend_adapt_note_event(backend, start);
+      }
+#endif
       return 1;
     }
   }
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_note_event(backend, start);
+#endif
   return 0;
 }
 
@@ -40,14 +51,25 @@ int hz6_transfer_backend_reserve_to_shard(
     return 0;
   }
 
-  size_t start = producer_shard % backend->shard_count;
+  size_t start = producer_shard % hz6_transfer_backend_active_shards(backend);
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_tick(backend);
+#endif
   for (size_t i = 0; i < backend->shard_count; ++i) {
     size_t shard_index = (start + i) % backend->shard_count;
     if (hz6_transfer_reserve(&backend->shard[shard_index], out)) {
       backend->next_push_shard = (shard_index + 1u) % backend->shard_count;
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+      if (i != 0) {
+        hz6_transfer_backend_adapt_note_event(backend, start);
+      }
+#endif
       return 1;
     }
   }
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  hz6_transfer_backend_adapt_note_event(backend, start);
+#endif
   return 0;
 }
 
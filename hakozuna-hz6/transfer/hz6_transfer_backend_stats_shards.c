@@ -30,3 +30,20 @@ size_t hz6_transfer_backend_shard_capacity_at(
   }
   return backend->shard[shard_index].capacity;
 }
+
+size_t hz6_transfer_backend_shard_contention_at(
+    const Hz6TransferBackend* backend,
+    size_t shard_index) {
+#if HZ6_TRANSFER_ADAPTIVE_SHARDS_L1
+  if (!backend || backend->kind != HZ6_TRANSFER_BACKEND_SHARDED_CACHE ||
+      shard_index >= backend->shard_count) {
+    return 0;
+  }
+  return atomic_load_explicit(&backend->shard_events[shard_index],
+                              memory_order_relaxed);
+#else
+  (void)backend;
+  (void)shard_index;
+  return 0;
+#endif
+}
@@ -46,6 +46,11 @@ typedef struct H8Stats {
   size_t direct_large_free_bytes;
   size_t direct_large_live_bytes;
   size_t direct_large_live_peak_bytes;
+  size_t realloc_copy_count;
+  size_t realloc_copy_bytes;
+  size_t direct_large_realloc_remap_count;
+  size_t direct_large_realloc_remap_bytes;
+  size_t direct_large_realloc_inplace_count;
   size_t direct_large_alloc_bucket[4];
   size_t direct_large_free_bucket[4];
   size_t direct_large_reuse_distance_0_1;
@@ -707,6 +712,8 @@ typedef struct H8DebugStats {
   size_t handoff_fail_count;
   size_t invalid_count;
   size_t miss_count;
+  size_t sized_free_count;
+  size_t sized_free_class_mismatch;
   size_t owner_transition_count;
   size_t adoption_scan_count;
   size_t adoption_candidate_count;
@@ -723,6 +730,11 @@ void* h8_malloc(size_t size);
 void* h8_calloc(size_t count, size_t size);
 void* h8_realloc(void* ptr, size_t size);
 void h8_free(void* ptr);
+void* h8_aligned_alloc(size_t alignment, size_t size);
+int h8_posix_memalign(void** memptr, size_t alignment, size_t size);
+void* h8_memalign(size_t alignment, size_t size);
+void h8_free_sized(void* ptr, size_t size);
+void h8_free_aligned_sized(void* ptr, size_t alignment, size_t size);
 H8RouteKind h8_route(void* ptr);
 H8Stats h8_stats(void);
 H8DebugStats h8_debug_stats(void);
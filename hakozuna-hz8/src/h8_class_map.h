@@ -68,6 +68,13 @@ static inline uint32_t h8_class_factor(uint32_t class_id) {
 #endif
 }
 
+/* Slots sit at span_base + slot * class_size, so a class is naturally aligned
+ * to the lowest set bit of its size (capped by the span base alignment). */
+static inline uint32_t h8_class_natural_alignment(uint32_t class_id) {
+  uint32_t size = h8_class_size(class_id);
+  return size & (0u - size);
+}
+
 static inline uint32_t h8_class_for_size(size_t size) {
 #if !defined(H8_CLASS_MAP_UPPER1P5)
   if (size <= 16u) {
@@ -106,6 +113,22 @@ static inline uint32_t h8_class_for_size(size_t size) {
 #endif
 }
 
+/* First class at or above `size` whose stride carries `alignment`;
+ * H8_CLASS_COUNT when no small class can serve the request. Shared by the
+ * aligned allocation and aligned sized-free entries so both agree on the class. */
+static inline uint32_t h8_class_for_aligned_size(size_t size, size_t alignment) {
+  if (size > H8_MAX_SMALL_SIZE) {
+    return H8_CLASS_COUNT;
+  }
+  for (uint32_t class_id = h8_class_for_size(size); class_id < H8_CLASS_COUNT;
+       ++class_id) {
+    if (h8_class_natural_alignment(class_id) >= alignment) {
+      return class_id;
+    }
+  }
+  return H8_CLASS_COUNT;
+}
+
 static inline size_t h8_class_slot_count(uint32_t class_id) {
 #if defined(H8_CLASS_MAP_UPPER1P5) || defined(H8_CLASS_MAP_UPPER3072)
 #if defined(H8_CLASS_MAP_UPPER3072)
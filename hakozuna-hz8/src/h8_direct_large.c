@@ -109,11 +109,20 @@ static void h8_direct_large_free_raw(void* ptr, size_t bytes) {
 
 static size_t h8_direct_large_payload_capacity(const H8DirectLarge* node) {
   if (node->mapped_size > H8_DIRECT_LARGE_HEADER_BYTES) {
-    return node->mapped_size - H8_DIRECT_LARGE_HEADER_BYTES;
+    uintptr_t end = (uintptr_t)node + node->mapped_size;
+    return (size_t)(end - (uintptr_t)node->user_ptr);
   }
   return node->usable_size;
 }
 
+/* Aligned carves keep the header at the raw base and move user_ptr forward to
+ * the requested boundary; they are never recycled through the size caches,
+ * whose fit checks assume user_ptr == header end. */
+static bool h8_direct_large_node_carved(const H8DirectLarge* node) {
+  return (const uint8_t*)node->user_ptr !=
+         (const uint8_t*)node + H8_DIRECT_LARGE_HEADER_BYTES;
+}
+
 static size_t h8_direct_large_mapped_size_for(size_t size) {
   size_t bytes = size + H8_DIRECT_LARGE_HEADER_BYTES;
 #if defined(H8_LARGE_DIRECT_MMAP_PAYLOAD_L1)
@@ -459,6 +468,41 @@ void* h8_direct_large_malloc(size_t size) {
   return user;
 }
 
+void* h8_direct_large_aligned_malloc(size_t size, size_t alignment) {
+  if (alignment == 0u || (alignment & (alignment - 1u)) != 0u ||
+      !h8_direct_large_size_supported(size) ||
+      size > SIZE_MAX - H8_DIRECT_LARGE_HEADER_BYTES - alignment) {
+    return NULL;
+  }
+  if (alignment <= _Alignof(max_align_t)) {
+    return h8_direct_large_malloc(size);
+  }
+  /* Worst-case slack is one alignment step past the header; untouched slack
+   * pages stay virtual, so RSS accounting still tracks `size`. */
+  size_t mapped_size = h8_direct_large_mapped_size_for(size + alignment);
+  uint8_t* raw = h8_direct_large_alloc_raw(mapped_size);
+  if (!raw) {
+    return NULL;
+  }
+  uintptr_t user_addr =
+      ((uintptr_t)raw + H8_DIRECT_LARGE_HEADER_BYTES + alignment - 1u) &
+      ~(uintptr_t)(alignment - 1u);
+  H8DirectLarge* node = (H8DirectLarge*)raw;
+  node->magic = H8_DIRECT_LARGE_MAGIC_LIVE;
+  node->requested_size = size;
+  node->usable_size = size;
+  node->mapped_size = mapped_size;
+  node->user_ptr = (void*)user_addr;
+  node->hash_next = NULL;
+  node->hash_prev = NULL;
+  node->cache_next = NULL;
+  h8_platform_mutex_lock(&h8_direct_large_lock);
+  h8_direct_large_insert_locked(node);
+  h8_platform_mutex_unlock(&h8_direct_large_lock);
+  h8_direct_large_record_alloc(size);
+  return node->user_ptr;
+}
+
 bool h8_direct_large_free_inner(void* ptr, bool* owned_out) {
   *owned_out = false;
   if (!ptr || !h8_direct_large_maybe_contains(ptr)) {
@@ -490,27 +534,29 @@ bool h8_direct_large_free_inner(void* ptr, bool* owned_out) {
     return false;
   }
   size_t size = node->usable_size;
+  if (!h8_direct_large_node_carved(node)) {
 #if defined(H8_LARGE_DIRECT_SHARDED_HOT_CACHE_L1)
-  if (h8_direct_large_sharded_hot_cache_push(node)) {
-    h8_platform_mutex_unlock(&h8_direct_large_lock);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_sharded_hot_cache_push(node)) {
+      h8_platform_mutex_unlock(&h8_direct_large_lock);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
 #if defined(H8_LARGE_DIRECT_HOTCOLD_CACHE_L1)
-  if (h8_direct_large_hotcold_push_locked(node)) {
-    h8_direct_large_unlock_hotcold(hold_start);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_hotcold_push_locked(node)) {
+      h8_direct_large_unlock_hotcold(hold_start);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
 #if defined(H8_DIRECT_LARGE_CACHE_L1)
-  if (h8_direct_large_cache_push_locked(node)) {
-    h8_platform_mutex_unlock(&h8_direct_large_lock);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_cache_push_locked(node)) {
+      h8_platform_mutex_unlock(&h8_direct_large_lock);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
+  }
   h8_direct_large_remove_locked(node);
   size_t mapped_size = node->mapped_size;
   node->magic = H8_DIRECT_LARGE_MAGIC_DEAD;
@@ -562,27 +608,29 @@ bool h8_direct_large_free_exact_inner(void* ptr, bool* owned_out) {
     return false;
   }
   size_t size = node->usable_size;
+  if (!h8_direct_large_node_carved(node)) {
 #if defined(H8_LARGE_DIRECT_SHARDED_HOT_CACHE_L1)
-  if (h8_direct_large_sharded_hot_cache_push(node)) {
-    h8_platform_mutex_unlock(&h8_direct_large_lock);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_sharded_hot_cache_push(node)) {
+      h8_platform_mutex_unlock(&h8_direct_large_lock);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
 #if defined(H8_LARGE_DIRECT_HOTCOLD_CACHE_L1)
-  if (h8_direct_large_hotcold_push_locked(node)) {
-    h8_direct_large_unlock_hotcold(hold_start);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_hotcold_push_locked(node)) {
+      h8_direct_large_unlock_hotcold(hold_start);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
 #if defined(H8_DIRECT_LARGE_CACHE_L1)
-  if (h8_direct_large_cache_push_locked(node)) {
-    h8_platform_mutex_unlock(&h8_direct_large_lock);
-    h8_direct_large_record_free(size);
-    return true;
-  }
+    if (h8_direct_large_cache_push_locked(node)) {
+      h8_platform_mutex_unlock(&h8_direct_large_lock);
+      h8_direct_large_record_free(size);
+      return true;
+    }
 #endif
+  }
   h8_direct_large_remove_locked(node);
   size_t mapped_size = node->mapped_size;
   node->magic = H8_DIRECT_LARGE_MAGIC_DEAD;
@@ -680,6 +728,86 @@ H8RouteKind h8_direct_large_route_exact_inner(void* ptr) {
                                                    : H8_ROUTE_INVALID;
 }
 
+static void h8_direct_large_record_resize(size_t old_size, size_t new_size) {
+  if (new_size >= old_size) {
+    size_t live = atomic_fetch_add_explicit(&h8g.direct_large_live_bytes,
+                                            new_size - old_size,
+                                            memory_order_relaxed) +
+                  (new_size - old_size);
+    h8_direct_large_update_live_peak(live);
+  } else {
+    atomic_fetch_sub_explicit(&h8g.direct_large_live_bytes,
+                              old_size - new_size, memory_order_relaxed);
+  }
+}
+
+/*
+ * Resize a live exact direct-large block without malloc+copy+free. Requests
+ * that fit the current payload (including slack left by a hot/cold cache hit)
+ * are answered in place; otherwise the whole mapping, header included, is
+ * moved with h8_platform_remap(). The node leaves the hash while the syscall
+ * runs so the lock is never held across mremap. NULL means the caller must
+ * copy: sizes outside the direct-large band, non-mmap payloads, aligned
+ * carves, or a failed remap.
+ */
+void* h8_direct_large_realloc_inner(void* ptr, size_t size) {
+  if (!h8_direct_large_size_supported(size) ||
+      size > SIZE_MAX - H8_DIRECT_LARGE_HEADER_BYTES -
+                 H8_DIRECT_LARGE_PAGE_BYTES ||
+      !h8_direct_large_maybe_contains(ptr)) {
+    return NULL;
+  }
+  h8_platform_mutex_lock(&h8_direct_large_lock);
+  H8DirectLarge* node = h8_direct_large_find_exact_locked(ptr);
+  if (!node || node->magic != H8_DIRECT_LARGE_MAGIC_LIVE ||
+      h8_direct_large_node_carved(node)) {
+    h8_platform_mutex_unlock(&h8_direct_large_lock);
+    return NULL;
+  }
+  size_t old_size = node->usable_size;
+  size_t mapped_size = node->mapped_size;
+  size_t new_mapped = h8_direct_large_mapped_size_for(size);
+  if (size <= h8_direct_large_payload_capacity(node) &&
+      new_mapped >= mapped_size) {
+    node->requested_size = size;
+    node->usable_size = size;
+    h8_platform_mutex_unlock(&h8_direct_large_lock);
+    h8_direct_large_record_resize(old_size, size);
+    atomic_fetch_add_explicit(&h8g.direct_large_realloc_inplace_count, 1,
+                              memory_order_relaxed);
+    return ptr;
+  }
+#if defined(H8_LARGE_DIRECT_MMAP_PAYLOAD_L1)
+  h8_direct_large_remove_locked(node);
+  h8_platform_mutex_unlock(&h8_direct_large_lock);
+  H8DirectLarge* moved =
+      (H8DirectLarge*)h8_platform_remap(node, mapped_size, new_mapped);
+  h8_platform_mutex_lock(&h8_direct_large_lock);
+  if (!moved) {
+    h8_direct_large_insert_locked(node);
+    h8_platform_mutex_unlock(&h8_direct_large_lock);
+    return NULL;
+  }
+  moved->requested_size = size;
+  moved->usable_size = size;
+  moved->mapped_size = new_mapped;
+  moved->user_ptr = (uint8_t*)moved + H8_DIRECT_LARGE_HEADER_BYTES;
+  h8_direct_large_insert_locked(moved);
+  h8_platform_mutex_unlock(&h8_direct_large_lock);
+  h8_direct_large_record_resize(old_size, size);
+  atomic_fetch_add_explicit(&h8g.direct_large_realloc_remap_count, 1,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&h8g.direct_large_realloc_remap_bytes,
+                            old_size < size ? old_size : size,
+                            memory_order_relaxed);
+  return moved->user_ptr;
+#else
+  h8_platform_mutex_unlock(&h8_direct_large_lock);
+  (void)mapped_size;
+  return NULL;
+#endif
+}
+
 #else
 
 bool h8_direct_large_size_supported(size_t size) {
@@ -692,6 +820,12 @@ void* h8_direct_large_malloc(size_t size) {
   return NULL;
 }
 
+void* h8_direct_large_aligned_malloc(size_t size, size_t alignment) {
+  (void)size;
+  (void)alignment;
+  return NULL;
+}
+
 bool h8_direct_large_free_inner(void* ptr, bool* owned_out) {
   (void)ptr;
   *owned_out = false;
@@ -725,6 +859,12 @@ H8RouteKind h8_direct_large_route_inner(void* ptr) {
   return H8_ROUTE_MISS;
 }
 
+void* h8_direct_large_realloc_inner(void* ptr, size_t size) {
+  (void)ptr;
+  (void)size;
+  return NULL;
+}
+
 H8RouteKind h8_direct_large_route_exact_inner(void* ptr) {
   (void)ptr;
   return H8_ROUTE_MISS;
@@ -108,6 +108,11 @@
 extern H8Global h8g;
 extern _Thread_local H8ThreadCtx* h8_tls_ctx H8_TLS_FAST;
 
+/* Checked builds verify the sized-free class against the span record. */
+#if defined(H8_ENABLE_DEBUG_STATS) && !defined(H8_SIZED_FREE_CHECKED)
+#define H8_SIZED_FREE_CHECKED 1
+#endif
+
 #if defined(H8_ENABLE_DEBUG_STATS)
 #define H8_DEBUG_INC(field) \
   atomic_fetch_add_explicit(&h8g.field, 1, memory_order_relaxed)
@@ -381,10 +386,13 @@ void h8_system_init(void);
 void* h8_sys_malloc(size_t size);
 void* h8_sys_calloc(size_t count, size_t size);
 void* h8_sys_realloc(void* ptr, size_t size);
+void* h8_sys_aligned_alloc(size_t alignment, size_t size);
 void h8_sys_free(void* ptr);
 
 bool h8_direct_large_size_supported(size_t size);
 void* h8_direct_large_malloc(size_t size);
+void* h8_direct_large_aligned_malloc(size_t size, size_t alignment);
+void* h8_direct_large_realloc_inner(void* ptr, size_t size);
 bool h8_direct_large_free_exact_inner(void* ptr, bool* owned_out);
 bool h8_direct_large_free_inner(void* ptr, bool* owned_out);
 bool h8_direct_large_usable_size_exact_inner(void* ptr, size_t* usable_out,
@@ -467,8 +475,11 @@ H8PublishResult h8_remote_free_publish(void* ptr);
 H8PublishResult h8_remote_free_publish_known(H8Span* span, size_t slot);
 H8RouteKind h8_route_inner(void* ptr);
 void* h8_malloc_inner(size_t size);
+void* h8_aligned_malloc_inner(size_t alignment, size_t size);
 void* h8_realloc_inner(void* ptr, size_t size);
 void h8_free_inner(void* ptr);
+void h8_free_sized_inner(void* ptr, size_t size);
+void h8_free_aligned_sized_inner(void* ptr, size_t alignment, size_t size);
 bool h8_usable_size_inner(void* ptr, size_t* usable_out, bool* owned_out);
 size_t h8_collect_owner_pending_budget(H8OwnerRecord* owner, size_t budget);
 bool h8_span_pending_quiescent(H8Span* span);
@@ -112,6 +112,13 @@ void* h8_platform_reserve_rw_aligned(size_t bytes, size_t alignment) {
   return NULL;
 }
 
+void* h8_platform_remap(void* ptr, size_t old_bytes, size_t new_bytes) {
+  (void)ptr;
+  (void)old_bytes;
+  (void)new_bytes;
+  return NULL;
+}
+
 void h8_platform_release(void* ptr, size_t bytes) {
   (void)bytes;
   if (ptr) {
@@ -223,6 +230,20 @@ void* h8_platform_reserve_rw_aligned(size_t bytes, size_t alignment) {
   return (void*)aligned;
 }
 
+/* Linux only: grow or shrink a private anonymous mapping, letting the kernel
+ * move the page tables instead of copying. NULL means the caller must copy. */
+void* h8_platform_remap(void* ptr, size_t old_bytes, size_t new_bytes) {
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+  void* next = mremap(ptr, old_bytes, new_bytes, MREMAP_MAYMOVE);
+  return next == MAP_FAILED ? NULL : next;
+#else
+  (void)ptr;
+  (void)old_bytes;
+  (void)new_bytes;
+  return NULL;
+#endif
+}
+
 void h8_platform_release(void* ptr, size_t bytes) {
   if (ptr && bytes) {
     munmap(ptr, bytes);
@@ -44,6 +44,7 @@ void* h8_platform_reserve(size_t bytes);
 int h8_platform_commit(void* ptr, size_t bytes);
 void* h8_platform_reserve_rw(size_t bytes);
 void* h8_platform_reserve_rw_aligned(size_t bytes, size_t alignment);
+void* h8_platform_remap(void* ptr, size_t old_bytes, size_t new_bytes);
 void h8_platform_release(void* ptr, size_t bytes);
 int h8_platform_purge(void* ptr, size_t bytes);
 int h8_platform_decommit(void* ptr, size_t bytes);
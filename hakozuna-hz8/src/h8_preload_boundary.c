@@ -9,9 +9,6 @@
 #include <dlfcn.h>
 
 typedef size_t (*H8RealMallocUsableSizeFn)(void*);
-typedef int (*H8RealPosixMemalignFn)(void**, size_t, size_t);
-typedef void* (*H8RealAlignedAllocFn)(size_t, size_t);
-typedef void* (*H8RealMemalignFn)(size_t, size_t);
 
 static H8RealMallocUsableSizeFn h8_real_malloc_usable_size_fn(void) {
   static H8RealMallocUsableSizeFn fn;
@@ -23,40 +20,6 @@ static H8RealMallocUsableSizeFn h8_real_malloc_usable_size_fn(void) {
   return fn;
 }
 
-static H8RealPosixMemalignFn h8_real_posix_memalign_fn(void) {
-  static H8RealPosixMemalignFn fn;
-  static bool loaded;
-  if (!loaded) {
-    fn = (H8RealPosixMemalignFn)dlsym(RTLD_NEXT, "posix_memalign");
-    loaded = true;
-  }
-  return fn;
-}
-
-static H8RealAlignedAllocFn h8_real_aligned_alloc_fn(void) {
-  static H8RealAlignedAllocFn fn;
-  static bool loaded;
-  if (!loaded) {
-    fn = (H8RealAlignedAllocFn)dlsym(RTLD_NEXT, "aligned_alloc");
-    loaded = true;
-  }
-  return fn;
-}
-
-static H8RealMemalignFn h8_real_memalign_fn(void) {
-  static H8RealMemalignFn fn;
-  static bool loaded;
-  if (!loaded) {
-    fn = (H8RealMemalignFn)dlsym(RTLD_NEXT, "memalign");
-    loaded = true;
-  }
-  return fn;
-}
-
-static bool h8_is_power_of_two(size_t value) {
-  return value != 0 && (value & (value - 1u)) == 0;
-}
-
 __attribute__((visibility("default"))) void* malloc(size_t size) {
   return h8_malloc_inner(size);
 }
@@ -73,6 +36,37 @@ __attribute__((visibility("default"))) void free(void* ptr) {
   h8_free_inner(ptr);
 }
 
+__attribute__((visibility("default"))) void free_sized(void* ptr, size_t size) {
+  h8_free_sized_inner(ptr, size);
+}
+
+__attribute__((visibility("default"))) void free_aligned_sized(void* ptr,
+                                                             size_t alignment,
+                                                             size_t size) {
+  h8_free_aligned_sized_inner(ptr, alignment, size);
+}
+
+/* C++14 sized and C++17 aligned-sized operator delete, exported under their
+ * Itanium-mangled names so -fsized-deallocation callers reach the sized path
+ * without a C++ translation unit in the preload library. */
+__attribute__((visibility("default"))) void _ZdlPvm(void* ptr, size_t size) {
+  h8_free_sized_inner(ptr, size);
+}
+
+__attribute__((visibility("default"))) void _ZdaPvm(void* ptr, size_t size) {
+  h8_free_sized_inner(ptr, size);
+}
+
+__attribute__((visibility("default"))) void _ZdlPvmSt11align_val_t(
+    void* ptr, size_t size, size_t alignment) {
+  h8_free_aligned_sized_inner(ptr, alignment, size);
+}
+
+__attribute__((visibility("default"))) void _ZdaPvmSt11align_val_t(
+    void* ptr, size_t size, size_t alignment) {
+  h8_free_aligned_sized_inner(ptr, alignment, size);
+}
+
 __attribute__((visibility("default"))) size_t malloc_usable_size(void* ptr) {
   size_t usable = 0;
   bool owned = false;
@@ -89,51 +83,17 @@ __attribute__((visibility("default"))) size_t malloc_usable_size(void* ptr) {
 __attribute__((visibility("default"))) int posix_memalign(void** memptr,
                                                           size_t alignment,
                                                           size_t size) {
-  H8RealPosixMemalignFn next = h8_real_posix_memalign_fn();
-  if (next) {
-    return next(memptr, alignment, size);
-  }
-  if (alignment < sizeof(void*) || !h8_is_power_of_two(alignment)) {
-    return EINVAL;
-  }
-  if (alignment > _Alignof(max_align_t)) {
-    *memptr = NULL;
-    return ENOMEM;
-  }
-  void* ptr = h8_malloc_inner(size);
-  if (!ptr) {
-    *memptr = NULL;
-    return ENOMEM;
-  }
-  *memptr = ptr;
-  return 0;
+  return h8_posix_memalign(memptr, alignment, size);
 }
 
 __attribute__((visibility("default"))) void* aligned_alloc(size_t alignment,
                                                            size_t size) {
-  H8RealAlignedAllocFn next = h8_real_aligned_alloc_fn();
-  if (next) {
-    return next(alignment, size);
-  }
-  if (!h8_is_power_of_two(alignment) || alignment > _Alignof(max_align_t) ||
-      (alignment != 0 && (size % alignment) != 0)) {
-    errno = EINVAL;
-    return NULL;
-  }
-  return h8_malloc_inner(size);
+  return h8_aligned_alloc(alignment, size);
 }
 
 __attribute__((visibility("default"))) void* memalign(size_t alignment,
                                                       size_t size) {
-  H8RealMemalignFn next = h8_real_memalign_fn();
-  if (next) {
-    return next(alignment, size);
-  }
-  if (!h8_is_power_of_two(alignment) || alignment > _Alignof(max_align_t)) {
-    errno = EINVAL;
-    return NULL;
-  }
-  return h8_malloc_inner(size);
+  return h8_memalign(alignment, size);
 }
 
 /* HZ8_DUMP_STATS: opt-in, default-off RSS/attribution dump at process exit.
@@ -161,6 +121,10 @@ __attribute__((constructor)) static void hz8_dump_stats_init(void) {
 }
 #endif
 
+static bool h8_is_power_of_two(size_t value) {
+  return value != 0 && (value & (value - 1u)) == 0;
+}
+
 void* h8_malloc(size_t size) {
   return h8_malloc_inner(size);
 }
@@ -184,3 +148,42 @@ void* h8_realloc(void* ptr, size_t size) {
 void h8_free(void* ptr) {
   h8_free_inner(ptr);
 }
+
+void h8_free_sized(void* ptr, size_t size) {
+  h8_free_sized_inner(ptr, size);
+}
+
+void h8_free_aligned_sized(void* ptr, size_t alignment, size_t size) {
+  h8_free_aligned_sized_inner(ptr, alignment, size);
+}
+
+void* h8_aligned_alloc(size_t alignment, size_t size) {
+  if (!h8_is_power_of_two(alignment)) {
+    errno = EINVAL;
+    return NULL;
+  }
+  void* ptr = h8_aligned_malloc_inner(alignment, size);
+  if (!ptr) {
+    errno = ENOMEM;
+  }
+  return ptr;
+}
+
+int h8_posix_memalign(void** memptr, size_t alignment, size_t size) {
+  if (!memptr) {
+    return EINVAL;
+  }
+  if (alignment < sizeof(void*) || !h8_is_power_of_two(alignment)) {
+    return EINVAL;
+  }
+  void* ptr = h8_aligned_malloc_inner(alignment, size);
+  if (!ptr) {
+    return ENOMEM;
+  }
+  *memptr = ptr;
+  return 0;
+}
+
+void* h8_memalign(size_t alignment, size_t size) {
+  return h8_aligned_alloc(alignment, size);
+}
@@ -64,6 +64,34 @@ static inline bool h8_slot_index_from_ptr_checked(const H8Span* span,
   return true;
 }
 
+/*
+ * Sized-free twin of h8_slot_index_from_ptr_checked(): the geometry comes from
+ * a caller-derived class instead of span->class_id/slot_count, so the slot can
+ * be decoded without waiting on the span record load.
+ */
+static inline bool h8_slot_index_for_class_checked(uint32_t class_id,
+                                                   uintptr_t offset,
+                                                   size_t* slot_out) {
+  uint32_t shift = h8_class_shift(class_id);
+  uintptr_t mask = ((uintptr_t)1 << shift) - (uintptr_t)1;
+  if ((offset & mask) != 0) {
+    return false;
+  }
+  uintptr_t quantum = offset >> shift;
+  size_t slot = (size_t)quantum;
+  if (H8_UNLIKELY(h8_class_factor(class_id) == 3u)) {
+    if ((quantum % 3u) != 0) {
+      return false;
+    }
+    slot = (size_t)(quantum / 3u);
+  }
+  if (slot >= h8_class_slot_count(class_id)) {
+    return false;
+  }
+  *slot_out = slot;
+  return true;
+}
+
 static inline void* h8_slot_ptr(const H8Span* span, size_t slot) {
 #if defined(H8_CLASS_MAP_UPPER3072)
   uint32_t class_id = span->class_id;
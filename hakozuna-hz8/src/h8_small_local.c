@@ -674,6 +674,43 @@ void* h8_malloc_inner(size_t size) {
   return h8_small_alloc_from_span(span);
 }
 
+/*
+ * Aligned entry: small and medium classes whose slot stride already carries
+ * the requested alignment are served through h8_malloc_inner() with the
+ * rounded size, so they keep the local fast path and the usual route/free
+ * contract. Larger alignments are carved from a direct-large mapping; only
+ * what HZ8 cannot own falls back to the platform allocator.
+ */
+void* h8_aligned_malloc_inner(size_t alignment, size_t size) {
+  if (alignment == 0 || (alignment & (alignment - 1u)) != 0) {
+    return NULL;
+  }
+  if (size == 0) {
+    size = 1;
+  }
+  if (alignment <= _Alignof(max_align_t)) {
+    return h8_malloc_inner(size);
+  }
+  uint32_t class_id = h8_class_for_aligned_size(size, alignment);
+  if (class_id < H8_CLASS_COUNT) {
+    return h8_malloc_inner(h8_class_size(class_id));
+  }
+  if (size <= H8_MEDIUM_MAX_SIZE) {
+    uint32_t rounded = h8_medium_aligned_rounded_size(size, alignment);
+    if (rounded != 0u) {
+      return h8_malloc_inner(rounded);
+    }
+  }
+  size_t direct_size = size > H8_MEDIUM_MAX_SIZE ? size : H8_MEDIUM_MAX_SIZE + 1u;
+  if (h8_direct_large_size_supported(direct_size)) {
+    void* ptr = h8_direct_large_aligned_malloc(direct_size, alignment);
+    if (ptr) {
+      return ptr;
+    }
+  }
+  return h8_sys_aligned_alloc(alignment, size);
+}
+
 static bool h8_local_free(H8ThreadCtx* ctx, H8OwnerRecord* owner, H8Span* span,
                           size_t slot) {
   if (span->owner_slot != owner->slot ||
@@ -745,6 +782,47 @@ static bool h8_local_free(H8ThreadCtx* ctx, H8OwnerRecord* owner, H8Span* span,
   return true;
 }
 
+static inline void h8_free_small_known(void* ptr, H8Span* span, size_t slot) {
+  H8ThreadCtx* ctx = h8_thread_ctx_fast();
+  if (!ctx) {
+    h8_fail_invalid_free();
+    return;
+  }
+  H8OwnerRecord* owner = h8_ctx_owner_assume(ctx);
+  if (h8_local_free(ctx, owner, span, slot)) {
+    return;
+  }
+  H8PublishResult first = h8_remote_free_publish_known(span, slot);
+  if (first == H8_PUBLISH_OK) {
+    return;
+  }
+  if (first != H8_PUBLISH_OWNER_TRANSITION) {
+    h8_fail_invalid_free();
+    return;
+  }
+#if defined(H8_REMOTE_TRANSITION_BACKOFF_L1)
+  size_t transition_retries = 0;
+#endif
+  for (;;) {
+    H8PublishResult res = h8_remote_free_publish(ptr);
+    if (res == H8_PUBLISH_OK) {
+      return;
+    }
+    if (res != H8_PUBLISH_OWNER_TRANSITION) {
+      break;
+    }
+#if defined(H8_REMOTE_TRANSITION_BACKOFF_L1)
+    transition_retries++;
+    if ((transition_retries & 63u) == 0) {
+      h8_platform_sleep_ns(1000000ull);
+      continue;
+    }
+#endif
+    h8_platform_yield();
+  }
+  h8_fail_invalid_free();
+}
+
 void h8_free_inner(void* ptr) {
   if (!ptr) {
     return;
@@ -930,44 +1008,70 @@ void h8_free_inner(void* ptr) {
     h8_fail_invalid_free();
     return;
   }
-  H8ThreadCtx* ctx = h8_thread_ctx_fast();
-  if (!ctx) {
+  h8_free_small_known(ptr, span, slot);
+}
+
+/*
+ * Sized free: the caller's size names the small class directly, so the slot
+ * index is decoded from the span offset without the span->class_id load that
+ * h8_free_inner() depends on. Checked builds still compare the derived class
+ * against the span record; a mismatch fails closed. Anything outside the
+ * small arena keeps the unsized route.
+ */
+static inline void h8_free_small_class(void* ptr, uint32_t class_id) {
+  H8_DEBUG_INC(sized_free_count);
+  uintptr_t offset =
+      ((uintptr_t)ptr - (uintptr_t)h8g.arena_base) & (H8_SPAN_BYTES - 1u);
+  size_t slot = 0;
+  if (!h8_slot_index_for_class_checked(class_id, offset, &slot)) {
     h8_fail_invalid_free();
     return;
   }
-  H8OwnerRecord* owner = h8_ctx_owner_assume(ctx);
-  if (h8_local_free(ctx, owner, span, slot)) {
-    return;
-  }
-  H8PublishResult first = h8_remote_free_publish_known(span, slot);
-  if (first == H8_PUBLISH_OK) {
+  H8Span* span = atomic_load_explicit(
+      &h8g.spans[h8_span_index_from_ptr(ptr)], memory_order_acquire);
+  if (!span || h8_span_state_load(span) == H8_SPAN_RETIRED) {
+    h8_fail_invalid_free();
     return;
   }
-  if (first != H8_PUBLISH_OWNER_TRANSITION) {
+#if defined(H8_SIZED_FREE_CHECKED)
+  if (H8_UNLIKELY(span->class_id != class_id)) {
+    H8_DEBUG_INC(sized_free_class_mismatch);
     h8_fail_invalid_free();
     return;
   }
-#if defined(H8_REMOTE_TRANSITION_BACKOFF_L1)
-  size_t transition_retries = 0;
-#endif
-  for (;;) {
-    H8PublishResult res = h8_remote_free_publish(ptr);
-    if (res == H8_PUBLISH_OK) {
-      return;
-    }
-    if (res != H8_PUBLISH_OWNER_TRANSITION) {
-      break;
-    }
-#if defined(H8_REMOTE_TRANSITION_BACKOFF_L1)
-    transition_retries++;
-    if ((transition_retries & 63u) == 0) {
-      h8_platform_sleep_ns(1000000ull);
-      continue;
-    }
 #endif
-    h8_platform_yield();
+  h8_free_small_known(ptr, span, slot);
+}
+
+void h8_free_sized_inner(void* ptr, size_t size) {
+  if (!ptr) {
+    return;
   }
-  h8_fail_invalid_free();
+  if (size > H8_MAX_SMALL_SIZE ||
+      H8_UNLIKELY(!atomic_load_explicit(&h8g.ready, memory_order_acquire)) ||
+      !h8_arena_contains(ptr)) {
+    h8_free_inner(ptr);
+    return;
+  }
+  h8_free_small_class(ptr, h8_class_for_size(size));
+}
+
+void h8_free_aligned_sized_inner(void* ptr, size_t alignment, size_t size) {
+  if (alignment <= _Alignof(max_align_t)) {
+    h8_free_sized_inner(ptr, size);
+    return;
+  }
+  if (!ptr) {
+    return;
+  }
+  uint32_t class_id = h8_class_for_aligned_size(size ? size : 1u, alignment);
+  if (class_id >= H8_CLASS_COUNT ||
+      H8_UNLIKELY(!atomic_load_explicit(&h8g.ready, memory_order_acquire)) ||
+      !h8_arena_contains(ptr)) {
+    h8_free_inner(ptr);
+    return;
+  }
+  h8_free_small_class(ptr, class_id);
 }
 
 static bool h8_small_usable_size(void* ptr, size_t* usable_out) {
@@ -1080,6 +1184,9 @@ void* h8_realloc_inner(void* ptr, size_t size) {
 
   size_t old_size = 0;
   bool owned = false;
+#if defined(H8_LARGE_DIRECT_OWNED_L1)
+  bool direct_exact = false;
+#endif
   if (h8_arena_contains(ptr)) {
     owned = true;
     if (!h8_small_usable_size(ptr, &old_size)) {
@@ -1105,6 +1212,7 @@ void* h8_realloc_inner(void* ptr, size_t size) {
         h8_direct_large_usable_size_exact_inner(ptr, &old_size,
                                                 &direct_owned)) {
       owned = true;
+      direct_exact = true;
     } else if (direct_owned) {
       errno = EINVAL;
       return NULL;
@@ -1139,12 +1247,24 @@ void* h8_realloc_inner(void* ptr, size_t size) {
   }
 #endif
 
+#if defined(H8_LARGE_DIRECT_OWNED_L1)
+  if (direct_exact && size > H8_MEDIUM_MAX_SIZE) {
+    void* resized = h8_direct_large_realloc_inner(ptr, size);
+    if (resized) {
+      return resized;
+    }
+  }
+#endif
+
   void* next = h8_malloc_inner(size);
   if (!next) {
     return NULL;
   }
   size_t copy_size = old_size < size ? old_size : size;
   memcpy(next, ptr, copy_size);
+  atomic_fetch_add_explicit(&h8g.realloc_copy_count, 1, memory_order_relaxed);
+  atomic_fetch_add_explicit(&h8g.realloc_copy_bytes, copy_size,
+                            memory_order_relaxed);
   h8_free_inner(ptr);
   return next;
 }
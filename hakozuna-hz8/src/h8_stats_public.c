@@ -48,6 +48,16 @@ void h8_stats_snapshot(H8Stats* out) {
       atomic_load_explicit(&h8g.direct_large_live_bytes, memory_order_acquire);
   out->direct_large_live_peak_bytes = atomic_load_explicit(
       &h8g.direct_large_live_peak_bytes, memory_order_acquire);
+  out->realloc_copy_count =
+      atomic_load_explicit(&h8g.realloc_copy_count, memory_order_acquire);
+  out->realloc_copy_bytes =
+      atomic_load_explicit(&h8g.realloc_copy_bytes, memory_order_acquire);
+  out->direct_large_realloc_remap_count = atomic_load_explicit(
+      &h8g.direct_large_realloc_remap_count, memory_order_acquire);
+  out->direct_large_realloc_remap_bytes = atomic_load_explicit(
+      &h8g.direct_large_realloc_remap_bytes, memory_order_acquire);
+  out->direct_large_realloc_inplace_count = atomic_load_explicit(
+      &h8g.direct_large_realloc_inplace_count, memory_order_acquire);
   for (size_t i = 0; i < 4; ++i) {
     out->direct_large_alloc_bucket[i] = atomic_load_explicit(
         &h8g.direct_large_alloc_bucket[i], memory_order_acquire);
@@ -1,6 +1,16 @@
 #include "h8_internal.h"
 
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) && !defined(H8_BUILD_LD_PRELOAD)
+#include <malloc.h>
+
+/* Win64 has no posix_memalign and _aligned_malloc blocks cannot be released
+ * with free(), so every system-owned block goes through the _aligned_* family
+ * and h8_sys_free() stays a single release path. */
+#define H8_SYS_WIN_ALIGN ((size_t)16)
+#endif
 
 #ifdef H8_BUILD_LD_PRELOAD
 #include <dlfcn.h>
@@ -9,6 +19,7 @@ static void* (*h8_real_malloc_fn)(size_t) = NULL;
 static void* (*h8_real_calloc_fn)(size_t, size_t) = NULL;
 static void* (*h8_real_realloc_fn)(void*, size_t) = NULL;
 static void (*h8_real_free_fn)(void*) = NULL;
+static int (*h8_real_posix_memalign_fn)(void**, size_t, size_t) = NULL;
 
 static void h8_load_real_allocators(void) {
   if (h8_real_malloc_fn) {
@@ -18,6 +29,7 @@ static void h8_load_real_allocators(void) {
   h8_real_calloc_fn = dlsym(RTLD_NEXT, "calloc");
   h8_real_realloc_fn = dlsym(RTLD_NEXT, "realloc");
   h8_real_free_fn = dlsym(RTLD_NEXT, "free");
+  h8_real_posix_memalign_fn = dlsym(RTLD_NEXT, "posix_memalign");
 }
 #endif
 
@@ -31,6 +43,8 @@ void* h8_sys_malloc(size_t size) {
 #ifdef H8_BUILD_LD_PRELOAD
   h8_load_real_allocators();
   return h8_real_malloc_fn ? h8_real_malloc_fn(size) : NULL;
+#elif defined(_WIN32)
+  return _aligned_malloc(size ? size : 1, H8_SYS_WIN_ALIGN);
 #else
   return malloc(size);
 #endif
@@ -40,6 +54,16 @@ void* h8_sys_calloc(size_t count, size_t size) {
 #ifdef H8_BUILD_LD_PRELOAD
   h8_load_real_allocators();
   return h8_real_calloc_fn ? h8_real_calloc_fn(count, size) : NULL;
+#elif defined(_WIN32)
+  if (size && count > SIZE_MAX / size) {
+    return NULL;
+  }
+  size_t bytes = count * size;
+  void* ptr = _aligned_malloc(bytes ? bytes : 1, H8_SYS_WIN_ALIGN);
+  if (ptr) {
+    memset(ptr, 0, bytes);
+  }
+  return ptr;
 #else
   return calloc(count, size);
 #endif
@@ -49,17 +73,46 @@ void* h8_sys_realloc(void* ptr, size_t size) {
 #ifdef H8_BUILD_LD_PRELOAD
   h8_load_real_allocators();
   return h8_real_realloc_fn ? h8_real_realloc_fn(ptr, size) : NULL;
+#elif defined(_WIN32)
+  return _aligned_realloc(ptr, size, H8_SYS_WIN_ALIGN);
 #else
   return realloc(ptr, size);
 #endif
 }
 
+/* Platform fallback for aligned requests HZ8 cannot carve natively. The
+ * result must stay releasable through h8_sys_free(). */
+void* h8_sys_aligned_alloc(size_t alignment, size_t size) {
+  void* ptr = NULL;
+#ifdef H8_BUILD_LD_PRELOAD
+  h8_load_real_allocators();
+  if (!h8_real_posix_memalign_fn ||
+      h8_real_posix_memalign_fn(&ptr, alignment, size) != 0) {
+    return NULL;
+  }
+  return ptr;
+#elif defined(_WIN32)
+  (void)ptr;
+  if (alignment < H8_SYS_WIN_ALIGN) {
+    alignment = H8_SYS_WIN_ALIGN;
+  }
+  return _aligned_malloc(size ? size : 1, alignment);
+#else
+  if (posix_memalign(&ptr, alignment, size) != 0) {
+    return NULL;
+  }
+  return ptr;
+#endif
+}
+
 void h8_sys_free(void* ptr) {
 #ifdef H8_BUILD_LD_PRELOAD
   h8_load_real_allocators();
   if (h8_real_free_fn) {
     h8_real_free_fn(ptr);
   }
+#elif defined(_WIN32)
+  _aligned_free(ptr);
 #else
   free(ptr);
 #endif
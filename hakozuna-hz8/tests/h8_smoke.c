@@ -1,6 +1,7 @@
 #include "../include/h8.h"
 #include "../src/h8_adaptive_shadow.h"
 #include "../src/h8_medium.h"
+#include "../src/h8_internal.h"
 #if defined(H8_UNIFIED_MEDIUM_DOMAIN_STABLE_RECORD_L0)
 #include "../src/h8_medium_domain_shadow.h"
 #endif
@@ -301,6 +302,164 @@ static int check_realloc_api(void) {
     fprintf(stderr, "h8_realloc zero did not return NULL\n");
     return 69;
   }
+
+  H8Stats before_large = h8_stats();
+  size_t large_size = 80000u;
+  unsigned char* large = h8_malloc(large_size);
+  if (!large) {
+    fprintf(stderr, "h8_realloc large setup failed\n");
+    return 81;
+  }
+  memset(large, 0x4C, large_size);
+  /* Inside the direct-large window: resized without a copy. */
+  size_t window_size = H8_DIRECT_FALLBACK_LIMIT;
+  unsigned char* grown = h8_realloc(large, window_size);
+  if (!grown) {
+    fprintf(stderr, "h8_realloc large grow %zu failed\n", window_size);
+    return 82;
+  }
+  for (size_t i = 0; i < large_size; ++i) {
+    if (grown[i] != 0x4Cu) {
+      fprintf(stderr, "h8_realloc large grow lost byte %zu\n", i);
+      return 83;
+    }
+  }
+  memset(grown + large_size, 0x4C, window_size - large_size);
+  large = grown;
+  large_size = window_size;
+#if defined(H8_LARGE_DIRECT_OWNED_L1) && defined(H8_LARGE_DIRECT_MMAP_PAYLOAD_L1) && \
+    defined(__linux__)
+  H8Stats after_large = h8_stats();
+  if (after_large.direct_large_realloc_remap_count ==
+          before_large.direct_large_realloc_remap_count ||
+      after_large.realloc_copy_count != before_large.realloc_copy_count) {
+    fprintf(stderr, "direct-large realloc copied instead of remapping\n");
+    return 85;
+  }
+#else
+  (void)before_large;
+#endif
+  /* Past the window: copied out to the system allocator. */
+  for (size_t next_size = 2u * large_size; next_size <= (4u << 20u);
+       next_size *= 2u) {
+    grown = h8_realloc(large, next_size);
+    if (!grown) {
+      fprintf(stderr, "h8_realloc large grow %zu failed\n", next_size);
+      return 82;
+    }
+    for (size_t i = 0; i < large_size; ++i) {
+      if (grown[i] != 0x4Cu) {
+        fprintf(stderr, "h8_realloc large grow lost byte %zu\n", i);
+        return 83;
+      }
+    }
+    memset(grown + large_size, 0x4C, next_size - large_size);
+    large = grown;
+    large_size = next_size;
+  }
+  if (h8_route(large) == H8_ROUTE_VALID) {
+    fprintf(stderr, "h8_realloc past the direct-large window stayed owned\n");
+    return 86;
+  }
+  unsigned char* shrunk = h8_realloc(large, 100000u);
+  if (!shrunk || shrunk[99999] != 0x4Cu) {
+    fprintf(stderr, "h8_realloc large shrink failed\n");
+    return 84;
+  }
+  h8_free(shrunk);
+  return 0;
+}
+
+static int check_aligned_api(void) {
+  static const size_t alignments[] = {32u, 64u, 256u, 4096u, 16384u, 131072u};
+  static const size_t sizes[] = {24u, 200u, 3000u, 12000u, 70000u};
+  for (size_t a = 0; a < sizeof(alignments) / sizeof(alignments[0]); ++a) {
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t align = alignments[a];
+      size_t size = sizes[s];
+      void* p = NULL;
+      if (h8_posix_memalign(&p, align, size) != 0 || !p) {
+        fprintf(stderr, "h8_posix_memalign(%zu, %zu) failed\n", align, size);
+        return 70;
+      }
+      if (((uintptr_t)p & (align - 1u)) != 0) {
+        fprintf(stderr, "h8_posix_memalign(%zu, %zu) misaligned %p\n", align,
+                size, p);
+        return 71;
+      }
+      memset(p, 0x5A, size);
+      /* Direct-large ownership is lane-dependent; small/medium is not. */
+      bool native = size <= H8_MAX_SMALL_SIZE ? align <= H8_MAX_SMALL_SIZE
+                    : size <= H8_MEDIUM_MAX_SIZE
+                        ? align <= H8_MEDIUM_QUANTUM_BYTES
+                        : false;
+      if (native && h8_route(p) != H8_ROUTE_VALID) {
+        fprintf(stderr, "h8_posix_memalign(%zu, %zu) not HZ8-owned\n", align,
+                size);
+        return 72;
+      }
+      h8_free(p);
+    }
+  }
+  void* q = h8_aligned_alloc(64u, 64u);
+  void* m = h8_memalign(4096u, 100u);
+  if (!q || !m || ((uintptr_t)q & 63u) != 0 || ((uintptr_t)m & 4095u) != 0 ||
+      h8_route(q) != H8_ROUTE_VALID || h8_route(m) != H8_ROUTE_VALID) {
+    fprintf(stderr, "h8_aligned_alloc/h8_memalign mismatch\n");
+    return 73;
+  }
+  h8_free(q);
+  h8_free(m);
+  void* bad = NULL;
+  if (h8_posix_memalign(&bad, 24u, 64u) == 0 ||
+      h8_posix_memalign(&bad, 2u, 64u) == 0 || h8_aligned_alloc(0u, 64u)) {
+    fprintf(stderr, "aligned API accepted an invalid alignment\n");
+    return 74;
+  }
+  return 0;
+}
+
+static int check_sized_free_api(void) {
+  H8DebugStats before = h8_debug_stats();
+  static const size_t sizes[] = {1u, 16u, 100u, 1000u, 4096u, 9000u, 70000u};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    void* p = h8_malloc(sizes[i]);
+    if (!p) {
+      fprintf(stderr, "sized free setup %zu failed\n", sizes[i]);
+      return 75;
+    }
+    memset(p, 0x3C, sizes[i]);
+    h8_free_sized(p, sizes[i]);
+    if (sizes[i] <= 9000u && h8_route(p) == H8_ROUTE_VALID) {
+      fprintf(stderr, "h8_free_sized(%zu) left the slot live\n", sizes[i]);
+      return 76;
+    }
+  }
+  void* aligned = h8_aligned_alloc(256u, 40u);
+  if (!aligned) {
+    fprintf(stderr, "aligned sized free setup failed\n");
+    return 77;
+  }
+  h8_free_aligned_sized(aligned, 256u, 40u);
+  if (h8_route(aligned) == H8_ROUTE_VALID) {
+    fprintf(stderr, "h8_free_aligned_sized left the slot live\n");
+    return 78;
+  }
+  H8DebugStats after = h8_debug_stats();
+  if (after.sized_free_count - before.sized_free_count != 6u) {
+    fprintf(stderr, "sized free count mismatch %zu\n",
+            after.sized_free_count - before.sized_free_count);
+    return 79;
+  }
+  void* wrong = h8_malloc(64u);
+  h8_free_sized(wrong, 16u);
+  H8DebugStats mismatch = h8_debug_stats();
+  if (mismatch.sized_free_class_mismatch == after.sized_free_class_mismatch ||
+      h8_route(wrong) != H8_ROUTE_VALID) {
+    fprintf(stderr, "checked sized free accepted a class mismatch\n");
+    return 80;
+  }
+  h8_free(wrong);
   return 0;
 }
 
@@ -784,6 +943,14 @@ int main(void) {
          (unsigned long long)domain.stable_owner_current_miss,
          (unsigned long long)domain.stable_pool_current_bytes);
 #endif
+  int aligned_rc = check_aligned_api();
+  if (aligned_rc != 0) {
+    return aligned_rc;
+  }
+  int sized_rc = check_sized_free_api();
+  if (sized_rc != 0) {
+    return sized_rc;
+  }
   H8Stats stats = h8_stats();
 #if defined(H8_ADAPTIVE_TRANSFER_SHADOW_L0)
   H8AdaptiveShadowSnapshot adaptive = h8_adaptive_shadow_snapshot();
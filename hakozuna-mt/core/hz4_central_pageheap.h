@@ -17,21 +17,137 @@ enum {
 // Forward declarations
 typedef struct hz4_page_meta hz4_page_meta_t;
 
-// CPH per-sc stack: locked LIFO of page_meta pointers (ABA回避)
+// ============================================================================
+// CPH stack: lock-free LIFO of page_meta pointers (tagged Treiber)
+// ============================================================================
+// top = meta pointer (low 48 bits) | ABA tag (high 16 bits), bumped on every
+// successful CAS. Metas live in segment headers, which are never released
+// while CPH is on (HZ4_SEG_RELEASE_EMPTY is rejected), so reading cph_next of
+// a stale top is always safe and the tag rejects the stale CAS.
+//
+// Membership is cph_queued (NONE/QUEUED/INFLIGHT); the physical link is
+// cph_linked. Targeted removal only claims the state (QUEUED -> x) and leaves
+// the node linked as a tombstone; pops unlink tombstones as they reach them.
+// Exactly one side links a node: whoever flips cph_linked 0 -> 1. A push that
+// finds its node still linked revives the tombstone in place.
+//
+// Stacks are sharded by owner tid ([shard][sc], so one thread's classes share
+// lines instead of one class's threads). Owner-strict pops stay in the home
+// shard; 2TIER pops steal from other shards and move a batch home.
 typedef struct hz4_cph_sc {
-    atomic_flag lock;
-    hz4_page_meta_t* top;
+    _Atomic(uint64_t) top;
 } hz4_cph_sc_t;
 
-extern hz4_cph_sc_t g_cph_sc[HZ4_SC_MAX];
+#define HZ4_CPH_PTR_BITS 48
+#define HZ4_CPH_PTR_MASK ((UINT64_C(1) << HZ4_CPH_PTR_BITS) - 1u)
+#define HZ4_CPH_TAG_ONE  (UINT64_C(1) << HZ4_CPH_PTR_BITS)
+
+extern hz4_cph_sc_t g_cph_sc[HZ4_CPH_SHARDS][HZ4_SC_MAX];
 
 #if HZ4_CPH_2TIER
-extern hz4_cph_sc_t g_cph_hot_sc[HZ4_SC_MAX];
-extern hz4_cph_sc_t g_cph_cold_sc[HZ4_SC_MAX];
+extern hz4_cph_sc_t g_cph_hot_sc[HZ4_CPH_SHARDS][HZ4_SC_MAX];
+extern hz4_cph_sc_t g_cph_cold_sc[HZ4_CPH_SHARDS][HZ4_SC_MAX];
 extern _Atomic(uint32_t) g_cph_hot_count[HZ4_SC_MAX];
 static inline bool hz4_cph_remove_meta_any(hz4_page_meta_t* meta);
 #endif
 
+// Shards are keyed by owner tid, not NUMA node: the tree has no topology API.
+// A node mapping only has to replace this function.
+static inline uint32_t hz4_cph_shard(uint16_t tid) {
+    return (uint32_t)tid & (HZ4_CPH_SHARDS - 1u);
+}
+
+static inline hz4_page_meta_t* hz4_cph_top_ptr(uint64_t v) {
+    return (hz4_page_meta_t*)(uintptr_t)(v & HZ4_CPH_PTR_MASK);
+}
+
+static inline uint64_t hz4_cph_top_make(uint64_t old, hz4_page_meta_t* meta) {
+    return ((old & ~HZ4_CPH_PTR_MASK) + HZ4_CPH_TAG_ONE) | (uint64_t)(uintptr_t)meta;
+}
+
+// Push a private chain head..tail (one CAS).
+static inline void hz4_cph_stack_push_chain(hz4_cph_sc_t* st,
+                                            hz4_page_meta_t* head,
+                                            hz4_page_meta_t* tail) {
+#if HZ4_FAILFAST
+    if (((uint64_t)(uintptr_t)head & ~HZ4_CPH_PTR_MASK) != 0) {
+        HZ4_FAIL("CPH push: meta pointer exceeds 48 bits");
+    }
+#endif
+    uint64_t old = atomic_load_explicit(&st->top, memory_order_relaxed);
+    do {
+        tail->cph_next = hz4_cph_top_ptr(old);
+    } while (!atomic_compare_exchange_weak_explicit(&st->top, &old, hz4_cph_top_make(old, head),
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+// Physically pop one node (may be a tombstone).
+static inline hz4_page_meta_t* hz4_cph_stack_pop(hz4_cph_sc_t* st) {
+    uint64_t old = atomic_load_explicit(&st->top, memory_order_acquire);
+    for (;;) {
+        hz4_page_meta_t* cur = hz4_cph_top_ptr(old);
+        if (!cur) {
+            return NULL;
+        }
+        hz4_page_meta_t* next = cur->cph_next;
+        if (atomic_compare_exchange_weak_explicit(&st->top, &old, hz4_cph_top_make(old, next),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return cur;
+        }
+    }
+}
+
+// Detach the whole chain (one CAS).
+static inline hz4_page_meta_t* hz4_cph_stack_take_all(hz4_cph_sc_t* st) {
+    uint64_t old = atomic_load_explicit(&st->top, memory_order_acquire);
+    for (;;) {
+        hz4_page_meta_t* cur = hz4_cph_top_ptr(old);
+        if (!cur) {
+            return NULL;
+        }
+        if (atomic_compare_exchange_weak_explicit(&st->top, &old, hz4_cph_top_make(old, NULL),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return cur;
+        }
+    }
+}
+
+// Publish a meta that just won NONE -> QUEUED (seq_cst, pairs with unlink).
+static inline void hz4_cph_link(hz4_cph_sc_t* st, hz4_page_meta_t* meta) {
+    if (atomic_exchange_explicit(&meta->cph_linked, 1, memory_order_seq_cst) == 0) {
+        hz4_cph_stack_push_chain(st, meta, meta);
+    }
+}
+
+// Claim a physically popped node: true if it was live (now INFLIGHT).
+// A tombstone is unlinked; if a push revived it meanwhile, re-link it here
+// unless the pusher already saw it unlinked and linked it itself.
+static inline bool hz4_cph_claim_popped(hz4_cph_sc_t* st, hz4_page_meta_t* meta) {
+    uint8_t expected = HZ4_CPH_QUEUED;
+    if (atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, HZ4_CPH_INFLIGHT,
+                                                memory_order_seq_cst,
+                                                memory_order_seq_cst)) {
+        atomic_store_explicit(&meta->cph_linked, 0, memory_order_release);
+        return true;
+    }
+    atomic_store_explicit(&meta->cph_linked, 0, memory_order_seq_cst);
+    if (atomic_load_explicit(&meta->cph_queued, memory_order_seq_cst) == HZ4_CPH_QUEUED) {
+        hz4_cph_link(st, meta);
+    }
+    return false;
+}
+
+// Targeted removal: claim the state only, the node stays linked as a tombstone.
+static inline bool hz4_cph_claim_queued(hz4_page_meta_t* meta, uint8_t to) {
+    uint8_t expected = HZ4_CPH_QUEUED;
+    return atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, to,
+                                                   memory_order_seq_cst,
+                                                   memory_order_acquire);
+}
+
 // Push empty page to central heap (meta version)
 // Uses meta->cph_next for linking (avoids conflict with dqnext/reuse_next)
 static inline void hz4_cph_push_empty_meta(hz4_page_meta_t* meta) {
@@ -55,49 +171,91 @@ static inline void hz4_cph_push_empty_meta(hz4_page_meta_t* meta) {
 #endif
     uint8_t expected = HZ4_CPH_NONE;
     if (!atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, HZ4_CPH_QUEUED,
-                                                 memory_order_acq_rel,
+                                                 memory_order_seq_cst,
                                                  memory_order_acquire)) {
         return;
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_sc[sc_idx];
+    hz4_cph_link(&g_cph_sc[hz4_cph_shard(meta->owner_tid)][sc_idx], meta);
+}
 
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
+// Owner-strict pop helper: returns cur if it is a live (sc, tid) page (now
+// INFLIGHT). Otherwise a tombstone is dropped, a node revived in another
+// shard/sc stack is moved where its owner looks, and a foreign owner's node is
+// appended to the private skip chain.
+static inline hz4_page_meta_t* hz4_cph_owner_sort(hz4_cph_sc_t* st,
+                                                  hz4_page_meta_t* cur,
+                                                  uint8_t sc,
+                                                  uint16_t tid,
+                                                  hz4_page_meta_t** skip_head,
+                                                  hz4_page_meta_t** skip_tail,
+                                                  uint32_t* skipped) {
+    if (cur->owner_tid == tid && cur->sc == sc) {
+        return hz4_cph_claim_popped(st, cur) ? cur : NULL;
+    }
+    uint32_t home = hz4_cph_shard(cur->owner_tid);
+    if ((home != hz4_cph_shard(tid) || cur->sc != sc) && cur->sc < HZ4_SC_MAX) {
+        hz4_cph_stack_push_chain(&g_cph_sc[home][cur->sc], cur, cur);
+        return NULL;
     }
-    meta->cph_next = sc_stack->top;
-    sc_stack->top = meta;
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    cur->cph_next = NULL;
+    if (*skip_tail) {
+        (*skip_tail)->cph_next = cur;
+    } else {
+        *skip_head = cur;
+    }
+    *skip_tail = cur;
+    (*skipped)++;
+    return NULL;
 }
 
 // Pop empty page from central heap (owner-strict meta version)
+// Foreign owners sharing the shard are set aside and pushed back in one CAS.
+// After HZ4_CPH_OWNER_SCAN set-asides the rest of the stack is detached in one
+// CAS and scanned in full, so an owner page buried under foreign pages is
+// still found; the shard looks empty to other owners for that walk.
 static inline hz4_page_meta_t* hz4_cph_pop_empty_meta(uint8_t sc, uint16_t tid) {
     uint32_t sc_idx = (uint32_t)sc;
     if (sc_idx >= HZ4_SC_MAX) {
         return NULL;
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_sc[sc_idx];
+    hz4_cph_sc_t* st = &g_cph_sc[hz4_cph_shard(tid)][sc_idx];
 
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    hz4_page_meta_t* prev = NULL;
-    hz4_page_meta_t* cur = sc_stack->top;
-    while (cur && cur->owner_tid != tid) {
-        prev = cur;
-        cur = cur->cph_next;
+    hz4_page_meta_t* got = NULL;
+    hz4_page_meta_t* skip_head = NULL;
+    hz4_page_meta_t* skip_tail = NULL;
+    uint32_t skipped = 0;
+    hz4_page_meta_t* cur;
+    while (!got && skipped < HZ4_CPH_OWNER_SCAN && (cur = hz4_cph_stack_pop(st)) != NULL) {
+        got = hz4_cph_owner_sort(st, cur, sc, tid, &skip_head, &skip_tail, &skipped);
+    }
+    if (!got && skipped >= HZ4_CPH_OWNER_SCAN) {
+        cur = hz4_cph_stack_take_all(st);
+        while (cur && !got) {
+            hz4_page_meta_t* next = cur->cph_next;
+            got = hz4_cph_owner_sort(st, cur, sc, tid, &skip_head, &skip_tail, &skipped);
+            cur = next;
+        }
+        if (cur) {
+            // Unscanned rest of the detached chain goes back with the skip chain.
+            hz4_page_meta_t* tail = cur;
+            while (tail->cph_next) {
+                tail = tail->cph_next;
+            }
+            if (skip_tail) {
+                skip_tail->cph_next = cur;
+            } else {
+                skip_head = cur;
+            }
+            skip_tail = tail;
+        }
     }
-    if (!cur) {
-        atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
-        return NULL;
+    if (skip_head) {
+        hz4_cph_stack_push_chain(st, skip_head, skip_tail);
     }
-    hz4_page_meta_t* next = cur->cph_next;
-    if (prev) {
-        prev->cph_next = next;
-    } else {
-        sc_stack->top = next;
+    if (got) {
+        got->cph_next = NULL;
     }
-    cur->cph_next = NULL;
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
-    atomic_store_explicit(&cur->cph_queued, HZ4_CPH_INFLIGHT, memory_order_release);
-    return cur;
+    return got;
 }
 
 // Remove a specific meta from central heap (safety adopt path)
@@ -112,33 +270,7 @@ static inline bool hz4_cph_remove_meta(hz4_page_meta_t* meta) {
     if (sc_idx >= HZ4_SC_MAX) {
         return false;
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_sc[sc_idx];
-
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    hz4_page_meta_t* prev = NULL;
-    hz4_page_meta_t* cur = sc_stack->top;
-    bool removed = false;
-    while (cur) {
-        if (cur == meta) {
-            hz4_page_meta_t* next = cur->cph_next;
-            if (prev) {
-                prev->cph_next = next;
-            } else {
-                sc_stack->top = next;
-            }
-            cur->cph_next = NULL;
-            removed = true;
-            break;
-        }
-        prev = cur;
-        cur = cur->cph_next;
-    }
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
-    if (removed) {
-        atomic_store_explicit(&meta->cph_queued, HZ4_CPH_INFLIGHT, memory_order_release);
-    }
-    return removed;
+    return hz4_cph_claim_queued(meta, HZ4_CPH_INFLIGHT);
 #endif
 }
 
@@ -152,26 +284,26 @@ static inline bool hz4_cph_hot_push_meta(hz4_page_meta_t* meta) {
     if (atomic_load_explicit(&meta->queued, memory_order_acquire) != 0) {
         return false;
     }
-    uint8_t expected = HZ4_CPH_NONE;
-    if (!atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, HZ4_CPH_QUEUED,
-                                                 memory_order_acq_rel,
-                                                 memory_order_acquire)) {
+    // Push is owner-only: tier and hot_count are settled before QUEUED is
+    // published, so a claimer always sees the state it has to account for.
+    if (atomic_load_explicit(&meta->cph_queued, memory_order_acquire) != HZ4_CPH_NONE) {
         return false;
     }
     uint32_t prev = atomic_fetch_add_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
     if (prev >= HZ4_CPH_HOT_MAX_PAGES) {
         atomic_fetch_sub_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
-        atomic_store_explicit(&meta->cph_queued, HZ4_CPH_NONE, memory_order_release);
         hz4_os_stats_cph_hot_full();
         return false;
     }
     atomic_store_explicit(&meta->cph_state, HZ4_CPH_HOT, memory_order_release);
-    hz4_cph_sc_t* sc_stack = &g_cph_hot_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
+    uint8_t expected = HZ4_CPH_NONE;
+    if (!atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, HZ4_CPH_QUEUED,
+                                                 memory_order_seq_cst,
+                                                 memory_order_acquire)) {
+        atomic_fetch_sub_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
+        return false;
     }
-    meta->cph_next = sc_stack->top;
-    sc_stack->top = meta;
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    hz4_cph_link(&g_cph_hot_sc[hz4_cph_shard(meta->owner_tid)][sc_idx], meta);
     hz4_os_stats_cph_hot_push();
     return true;
 }
@@ -185,60 +317,136 @@ static inline bool hz4_cph_cold_push_meta(hz4_page_meta_t* meta) {
     if (atomic_load_explicit(&meta->queued, memory_order_acquire) != 0) {
         return false;
     }
+    if (atomic_load_explicit(&meta->cph_queued, memory_order_acquire) != HZ4_CPH_NONE) {
+        return false;
+    }
+    atomic_store_explicit(&meta->cph_state, HZ4_CPH_COLD, memory_order_release);
     uint8_t expected = HZ4_CPH_NONE;
     if (!atomic_compare_exchange_strong_explicit(&meta->cph_queued, &expected, HZ4_CPH_QUEUED,
-                                                 memory_order_acq_rel,
+                                                 memory_order_seq_cst,
                                                  memory_order_acquire)) {
         return false;
     }
-    atomic_store_explicit(&meta->cph_state, HZ4_CPH_COLD, memory_order_release);
-    hz4_cph_sc_t* sc_stack = &g_cph_cold_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    meta->cph_next = sc_stack->top;
-    sc_stack->top = meta;
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    hz4_cph_link(&g_cph_cold_sc[hz4_cph_shard(meta->owner_tid)][sc_idx], meta);
     hz4_os_stats_cph_cold_push();
     return true;
 }
 
-static inline hz4_page_meta_t* hz4_cph_hot_pop_meta(uint8_t sc) {
-    uint32_t sc_idx = (uint32_t)sc;
-    if (sc_idx >= HZ4_SC_MAX) {
-        return NULL;
+// A claimed node is accounted once: hot_count follows its state, not its stack
+// (a revived tombstone may sit in the other tier's stack).
+static inline void hz4_cph_claimed_account(hz4_page_meta_t* meta) {
+    if (atomic_load_explicit(&meta->cph_state, memory_order_acquire) == HZ4_CPH_HOT) {
+        atomic_fetch_sub_explicit(&g_cph_hot_count[meta->sc], 1, memory_order_acq_rel);
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_hot_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
+}
+
+// Misfiled node (revived after its page changed sc): push it where it belongs.
+static inline void hz4_cph_refile(hz4_page_meta_t* meta) {
+    uint8_t state = atomic_load_explicit(&meta->cph_state, memory_order_acquire);
+    atomic_store_explicit(&meta->cph_queued, HZ4_CPH_NONE, memory_order_release);
+    if (state == HZ4_CPH_HOT && hz4_cph_hot_push_meta(meta)) {
+        return;
     }
-    hz4_page_meta_t* cur = sc_stack->top;
-    if (cur) {
-        sc_stack->top = cur->cph_next;
+    (void)hz4_cph_cold_push_meta(meta);
+}
+
+static inline hz4_page_meta_t* hz4_cph_tier_pop_local(hz4_cph_sc_t* st, uint8_t sc) {
+    hz4_page_meta_t* cur;
+    while ((cur = hz4_cph_stack_pop(st)) != NULL) {
+        if (!hz4_cph_claim_popped(st, cur)) {
+            continue;  // tombstone dropped
+        }
+        hz4_cph_claimed_account(cur);
+        if (cur->sc != sc) {
+            hz4_cph_refile(cur);
+            continue;
+        }
         cur->cph_next = NULL;
+        return cur;
+    }
+    return NULL;
+}
+
+// Steal: detach a victim shard, claim one page and move up to
+// HZ4_CPH_STEAL_BATCH-1 more to the home shard; the rest goes back.
+static inline hz4_page_meta_t* hz4_cph_tier_steal(hz4_cph_sc_t* victim,
+                                                  hz4_cph_sc_t* home,
+                                                  uint8_t sc) {
+    hz4_page_meta_t* cur = hz4_cph_stack_take_all(victim);
+    hz4_page_meta_t* got = NULL;
+    hz4_page_meta_t* move_head = NULL;
+    hz4_page_meta_t* move_tail = NULL;
+    uint32_t moved = 0;
+    while (cur && (!got || moved + 1u < HZ4_CPH_STEAL_BATCH)) {
+        hz4_page_meta_t* next = cur->cph_next;
+        if (!got) {
+            if (hz4_cph_claim_popped(home, cur)) {
+                hz4_cph_claimed_account(cur);
+                if (cur->sc == sc) {
+                    cur->cph_next = NULL;
+                    got = cur;
+                } else {
+                    hz4_cph_refile(cur);
+                }
+            }
+        } else {
+            cur->cph_next = NULL;
+            if (move_tail) {
+                move_tail->cph_next = cur;
+            } else {
+                move_head = cur;
+            }
+            move_tail = cur;
+            moved++;
+        }
+        cur = next;
+    }
+    if (move_head) {
+        hz4_cph_stack_push_chain(home, move_head, move_tail);
+    }
+    if (cur) {
+        hz4_page_meta_t* tail = cur;
+        while (tail->cph_next) {
+            tail = tail->cph_next;
+        }
+        hz4_cph_stack_push_chain(victim, cur, tail);
     }
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    return got;
+}
+
+static inline hz4_page_meta_t* hz4_cph_tier_pop(hz4_cph_sc_t (*tier)[HZ4_SC_MAX],
+                                                uint8_t sc,
+                                                uint16_t tid) {
+    uint32_t home = hz4_cph_shard(tid);
+    hz4_page_meta_t* meta = hz4_cph_tier_pop_local(&tier[home][sc], sc);
+    for (uint32_t i = 1; !meta && i < HZ4_CPH_SHARDS; i++) {
+        uint32_t v = (home + i) & (HZ4_CPH_SHARDS - 1u);
+        if (!hz4_cph_top_ptr(atomic_load_explicit(&tier[v][sc].top, memory_order_relaxed))) {
+            continue;
+        }
+        meta = hz4_cph_tier_steal(&tier[v][sc], &tier[home][sc], sc);
+    }
+    return meta;  // already INFLIGHT (claimed)
+}
+
+static inline hz4_page_meta_t* hz4_cph_hot_pop_meta(uint8_t sc, uint16_t tid) {
+    uint32_t sc_idx = (uint32_t)sc;
+    if (sc_idx >= HZ4_SC_MAX) {
+        return NULL;
+    }
+    hz4_page_meta_t* cur = hz4_cph_tier_pop(g_cph_hot_sc, sc, tid);
     if (!cur) return NULL;
-    atomic_store_explicit(&cur->cph_queued, HZ4_CPH_INFLIGHT, memory_order_release);
-    atomic_fetch_sub_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
     hz4_os_stats_cph_hot_pop();
     return cur;
 }
 
-static inline hz4_page_meta_t* hz4_cph_cold_pop_meta(uint8_t sc) {
+static inline hz4_page_meta_t* hz4_cph_cold_pop_meta(uint8_t sc, uint16_t tid) {
     uint32_t sc_idx = (uint32_t)sc;
     if (sc_idx >= HZ4_SC_MAX) {
         return NULL;
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_cold_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    hz4_page_meta_t* cur = sc_stack->top;
-    if (cur) {
-        sc_stack->top = cur->cph_next;
-        cur->cph_next = NULL;
-    }
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    hz4_page_meta_t* cur = hz4_cph_tier_pop(g_cph_cold_sc, sc, tid);
     if (!cur) return NULL;
-    atomic_store_explicit(&cur->cph_queued, HZ4_CPH_INFLIGHT, memory_order_release);
     hz4_os_stats_cph_cold_pop();
     return cur;
 }
@@ -263,71 +471,23 @@ static inline bool hz4_cph_hot_try_extract_for_decommit(hz4_page_meta_t* meta) {
     if (sc_idx >= HZ4_SC_MAX) {
         return false;
     }
-    hz4_cph_sc_t* sc_stack = &g_cph_hot_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    hz4_page_meta_t* prev = NULL;
-    hz4_page_meta_t* cur = sc_stack->top;
-    bool removed = false;
-    while (cur) {
-        if (cur == meta) {
-            hz4_page_meta_t* next = cur->cph_next;
-            if (prev) {
-                prev->cph_next = next;
-            } else {
-                sc_stack->top = next;
-            }
-            cur->cph_next = NULL;
-            removed = true;
-            break;
-        }
-        prev = cur;
-        cur = cur->cph_next;
-    }
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
-    if (!removed) {
+    if (!hz4_cph_claim_queued(meta, HZ4_CPH_NONE)) {
         hz4_os_stats_cph_extract_fail_notfound();
         return false;
     }
 
     atomic_fetch_sub_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
-    atomic_store_explicit(&meta->cph_queued, HZ4_CPH_NONE, memory_order_release);
     atomic_store_explicit(&meta->cph_state, HZ4_CPH_ACTIVE, memory_order_release);
     return true;
 }
 
 static inline bool hz4_cph_remove_meta_any(hz4_page_meta_t* meta) {
     if (!meta) return false;
-    uint8_t state = atomic_load_explicit(&meta->cph_state, memory_order_acquire);
     uint32_t sc_idx = (uint32_t)meta->sc;
     if (sc_idx >= HZ4_SC_MAX) return false;
-    hz4_cph_sc_t* sc_stack = (state == HZ4_CPH_COLD) ? &g_cph_cold_sc[sc_idx] : &g_cph_hot_sc[sc_idx];
-    while (atomic_flag_test_and_set_explicit(&sc_stack->lock, memory_order_acquire)) {
-    }
-    hz4_page_meta_t* prev = NULL;
-    hz4_page_meta_t* cur = sc_stack->top;
-    bool removed = false;
-    while (cur) {
-        if (cur == meta) {
-            hz4_page_meta_t* next = cur->cph_next;
-            if (prev) {
-                prev->cph_next = next;
-            } else {
-                sc_stack->top = next;
-            }
-            cur->cph_next = NULL;
-            removed = true;
-            break;
-        }
-        prev = cur;
-        cur = cur->cph_next;
-    }
-    atomic_flag_clear_explicit(&sc_stack->lock, memory_order_release);
+    bool removed = hz4_cph_claim_queued(meta, HZ4_CPH_INFLIGHT);
     if (removed) {
-        atomic_store_explicit(&meta->cph_queued, HZ4_CPH_INFLIGHT, memory_order_release);
-        if (state == HZ4_CPH_HOT) {
-            atomic_fetch_sub_explicit(&g_cph_hot_count[sc_idx], 1, memory_order_acq_rel);
-        }
+        hz4_cph_claimed_account(meta);
     }
     return removed;
 }
@@ -199,6 +199,20 @@
 #define HZ4_CPH_HOT_MAX_PAGES 256  // per sc
 #endif
 
+// CPH stacks are lock-free (tagged Treiber) and sharded by owner tid.
+#ifndef HZ4_CPH_SHARDS
+#define HZ4_CPH_SHARDS 16  // stacks per sc (per tier), power-of-two
+#endif
+#if (HZ4_CPH_SHARDS & (HZ4_CPH_SHARDS - 1)) != 0
+#error "HZ4_CPH_SHARDS must be a power of two"
+#endif
+#ifndef HZ4_CPH_STEAL_BATCH
+#define HZ4_CPH_STEAL_BATCH 8  // 2TIER: pages moved from a victim shard per steal
+#endif
+#ifndef HZ4_CPH_OWNER_SCAN
+#define HZ4_CPH_OWNER_SCAN 32  // owner-strict pop: per-node set-asides before a full-scan detach
+#endif
+
 #if HZ4_CPH_2TIER
 #ifndef HZ4_CPH_ACTIVE
 #define HZ4_CPH_ACTIVE 0
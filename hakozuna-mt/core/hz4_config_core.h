@@ -56,6 +56,18 @@
 #define HZ4_TLS_DIRECT 1
 #endif
 
+// OwnerIdRecycleBox:
+// owner tid (hz4_tls_t.tid / page owner_tid / PTAG owner field) is 16-bit.
+// A plain counter wraps after 65535 thread lifetimes and hands a live
+// thread's id to a new thread. With recycling, ids return to a free list at
+// thread exit, so ids stay unique among live threads (<= HZ4_TID_MAX) for any
+// number of lifetimes; a recycled id adopts the exited thread's pages.
+// Beyond HZ4_TID_MAX live threads new ids are shared round-robin (warned once).
+#ifndef HZ4_TID_RECYCLE
+#define HZ4_TID_RECYCLE 1
+#endif
+#define HZ4_TID_MAX 0xFFFFu  // tid 0 = no owner
+
 // SegAcquire budgets (kept even when boxes are archived).
 // - Also referenced by non-archived CoolingBox knobs.
 #ifndef HZ4_SEG_ACQ_BUDGET
@@ -89,9 +101,19 @@
 #ifndef HZ4_SC_MIN
 #define HZ4_SC_MIN 1  // 8 bytes (sc 0 is sentinel)
 #endif
+// PageRunBandBox: 2KB..28KB geometric classes carved from single pages
+// (see include/hz4_sizeclass.h). Opt-in; 0 keeps the 2KB small/mid boundary.
+// 28KB..64KB would need multi-page runs and is not implemented.
+#ifndef HZ4_PAGE_RUN_BAND
+#define HZ4_PAGE_RUN_BAND 0  // default OFF (opt-in)
+#endif
 #ifndef HZ4_SC_MAX
+#if HZ4_PAGE_RUN_BAND
+#define HZ4_SC_MAX 144  // 128 linear (16..2048B) + 15 page-run classes, padded to 8
+#else
 #define HZ4_SC_MAX 128  // 16B aligned classes for 16..2048B
 #endif
+#endif
 
 // Page/Segment sizes (must be consistent)
 // NOTE: These defaults match the original monolithic hz4_config.h
@@ -465,6 +487,7 @@
 // HZ4_PAGE_TAG_TABLE: Enable page tag table for fast routing
 // Default OFF - previously NO-GO at -3.1% (Phase 6)
 // Tag format: bit 31..28=kind, bit 27..16=sc, bit 15..0=owner_tid
+// owner_tid stays 16-bit: HZ4_TID_RECYCLE keeps it unique among up to HZ4_TID_MAX live threads.
 #ifndef HZ4_PAGE_TAG_TABLE
 #define HZ4_PAGE_TAG_TABLE 0
 #endif
@@ -22,9 +22,13 @@ void hz4_pagetag_init(void* arena_base);
 // ============================================================================
 // Tag format (32-bit):
 //   bit 31..28: kind (0=unknown, 1=small, 2=mid)
-//   bit 27..16: sc (size class, 0-127 for small)
+//   bit 27..16: sc (size class, 0-127 linear + page-run band for small)
 //   bit 15..0 : owner_tid (16-bit)
 //
+// owner_tid is a logical owner, not an OS thread: with HZ4_TID_RECYCLE an
+// exited thread's tid (and TLS) is adopted by the next new thread, so 16 bits
+// bound concurrently live threads only and tags never go stale on reuse.
+//
 // tag=0 means "unknown" → fallback to legacy path
 // Large は tag 登録しない（mmap 分散で arena 外になる可能性）
 
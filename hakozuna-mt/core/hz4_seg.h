@@ -116,6 +116,7 @@ typedef struct hz4_page_meta {
 #if HZ4_CENTRAL_PAGEHEAP
     // ---- Phase 17: CentralPageHeapBox ----
     _Atomic(uint8_t) cph_queued;     // 0=not in CPH, 1=in CPH
+    _Atomic(uint8_t) cph_linked;     // physically on a CPH stack (may be a claimed tombstone)
     struct hz4_page_meta* cph_next;  // next in central pageheap (avoid conflict with dqnext/reuse_next)
 #if HZ4_CPH_2TIER
     _Atomic(uint8_t) cph_state;      // ACTIVE/SEALING/HOT/COLD
@@ -1,4 +1,4 @@
-// hz4_sizeclass.h - HZ4 Size Class Box (16B aligned, 16..2048B)
+// hz4_sizeclass.h - HZ4 Size Class Box (16B aligned 16..2048B + page-run band)
 #ifndef HZ4_SIZECLASS_H
 #define HZ4_SIZECLASS_H
 
@@ -9,12 +9,29 @@
 
 #define HZ4_SIZE_ALIGN 16u
 #define HZ4_SIZE_MIN   16u
-#define HZ4_SIZE_MAX   2048u
-#define HZ4_SC_COUNT   (HZ4_SIZE_MAX / HZ4_SIZE_ALIGN)
+#define HZ4_LINEAR_SIZE_MAX 2048u
+#define HZ4_LINEAR_SC_COUNT (HZ4_LINEAR_SIZE_MAX / HZ4_SIZE_ALIGN)  // sc 0..127
 #define HZ4_SC_INVALID 0xFFu
 
+// PageRunBandBox: geometric classes above 2KB, 4 per power of two
+// (2560, 3072, 3584, 4096, 5120, ... 28672B). Every object still lives in
+// one 64KB page (>= 2 objects/page), so free keeps routing by ptr & ~page_mask
+// and remote frees go through the same inbox / remote_page_rbuf path as small.
+#if HZ4_PAGE_RUN_BAND
+#define HZ4_RUN_SC_SHIFT 2u  // log2(classes per doubling)
+#define HZ4_RUN_SC_COUNT 15u
+#define HZ4_SIZE_MAX     28672u
+#else
+#define HZ4_RUN_SC_COUNT 0u
+#define HZ4_SIZE_MAX     HZ4_LINEAR_SIZE_MAX
+#endif
+#define HZ4_SC_COUNT (HZ4_LINEAR_SC_COUNT + HZ4_RUN_SC_COUNT)
+
 #if HZ4_SC_MAX < HZ4_SC_COUNT
-#error "HZ4_SC_MAX too small for 16..2048B size classes"
+#error "HZ4_SC_MAX too small for the configured size classes"
+#endif
+#if HZ4_SC_MAX >= HZ4_SC_INVALID
+#error "HZ4_SC_MAX must stay below HZ4_SC_INVALID (sc is uint8_t)"
 #endif
 
 static inline size_t hz4_align_up(size_t v, size_t a) {
@@ -26,13 +43,31 @@ static inline uint8_t hz4_size_to_sc(size_t size) {
         size = HZ4_SIZE_MIN;
     }
     size = hz4_align_up(size, HZ4_SIZE_ALIGN);
-    if (size > HZ4_SIZE_MAX) {
-        return HZ4_SC_INVALID;
+    if (size <= HZ4_LINEAR_SIZE_MAX) {
+        return (uint8_t)((size / HZ4_SIZE_ALIGN) - 1);
+    }
+#if HZ4_PAGE_RUN_BAND
+    if (size <= HZ4_SIZE_MAX) {
+        // lg >= 11; step = 2^(lg - shift); sub in [0, 3]
+        size_t s = size - 1;
+        uint32_t lg = 63u - (uint32_t)__builtin_clzll((unsigned long long)s);
+        uint32_t step_shift = lg - HZ4_RUN_SC_SHIFT;
+        uint32_t sub = (uint32_t)(s >> step_shift) - (1u << HZ4_RUN_SC_SHIFT);
+        return (uint8_t)(HZ4_LINEAR_SC_COUNT + ((lg - 11u) << HZ4_RUN_SC_SHIFT) + sub);
     }
-    return (uint8_t)((size / HZ4_SIZE_ALIGN) - 1);
+#endif
+    return HZ4_SC_INVALID;
 }
 
 static inline size_t hz4_sc_to_size(uint8_t sc) {
+#if HZ4_PAGE_RUN_BAND
+    if (sc >= HZ4_LINEAR_SC_COUNT) {
+        uint32_t r = (uint32_t)sc - HZ4_LINEAR_SC_COUNT;
+        uint32_t sub = r & ((1u << HZ4_RUN_SC_SHIFT) - 1u);
+        uint32_t step_shift = 11u - HZ4_RUN_SC_SHIFT + (r >> HZ4_RUN_SC_SHIFT);
+        return (size_t)((1u << HZ4_RUN_SC_SHIFT) + sub + 1u) << step_shift;
+    }
+#endif
     return (size_t)(sc + 1) * HZ4_SIZE_ALIGN;
 }
 
@@ -69,6 +69,7 @@ void hz4_seg_init_pages(hz4_seg_t* seg, uint8_t owner) {
         meta->initialized = 0;
 #if HZ4_CENTRAL_PAGEHEAP
         atomic_store_explicit(&meta->cph_queued, 0, memory_order_relaxed);
+        atomic_store_explicit(&meta->cph_linked, 0, memory_order_relaxed);
         meta->cph_next = NULL;
 #if HZ4_CPH_2TIER
         atomic_store_explicit(&meta->cph_state, HZ4_CPH_ACTIVE, memory_order_relaxed);
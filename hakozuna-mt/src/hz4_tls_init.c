@@ -7,8 +7,130 @@
 #include "hz4_central_pageheap.h"
 #endif
 
-#if HZ4_TLS_DIRECT
+#if HZ4_TID_RECYCLE
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "hz4_os.h"
+#endif
+
+// ============================================================================
+// OwnerIdRecycleBox: tid acquire/release (thread start/exit only)
+// ============================================================================
+// A tid is a logical owner: pages, segments, carry and bins are keyed by it.
+// At thread exit the whole hz4_tls_t is parked under its tid; the next new
+// thread adopts a parked owner (memcpy back) before any fresh id is bumped,
+// so ids stay unique among live threads and the exited thread's pages keep
+// being served instead of leaking. The lock is thread start/exit only.
+
+#if HZ4_TID_RECYCLE
+typedef struct hz4_tid_park {
+    struct hz4_tid_park* next;
+    hz4_tls_t tls;
+} hz4_tid_park_t;
+
+static atomic_flag g_hz4_tid_lock = ATOMIC_FLAG_INIT;
+static hz4_tid_park_t* g_hz4_tid_parked = NULL;  // exited owners (LIFO)
+static hz4_tid_park_t* g_hz4_tid_spare = NULL;   // emptied park blocks
+static uint32_t g_hz4_tid_bump = 1;              // next never-used id
+static uint32_t g_hz4_tid_shared = 0;            // ids handed out past HZ4_TID_MAX
+
+static pthread_key_t g_hz4_tid_key;
+static pthread_once_t g_hz4_tid_key_once = PTHREAD_ONCE_INIT;
+
+static inline void hz4_tid_lock(void) {
+    while (atomic_flag_test_and_set_explicit(&g_hz4_tid_lock, memory_order_acquire)) {
+    }
+}
+
+static inline void hz4_tid_unlock(void) {
+    atomic_flag_clear_explicit(&g_hz4_tid_lock, memory_order_release);
+}
+
+// Returns 1 if a parked owner was adopted into *tls, else fills a fresh tid.
+static int hz4_tid_acquire(hz4_tls_t* tls, uint16_t* tid_out) {
+    uint32_t tid = 0;
+    hz4_tid_lock();
+    hz4_tid_park_t* park = g_hz4_tid_parked;
+    if (park) {
+        g_hz4_tid_parked = park->next;
+        memcpy(tls, &park->tls, sizeof(*tls));
+        park->next = g_hz4_tid_spare;
+        g_hz4_tid_spare = park;
+        hz4_tid_unlock();
+        *tid_out = tls->tid;
+        return 1;
+    }
+    int first_shared = 0;
+    if (g_hz4_tid_bump <= HZ4_TID_MAX) {
+        tid = g_hz4_tid_bump++;
+    } else {
+        // More than HZ4_TID_MAX live threads: share ids round-robin, which is
+        // the HZ4_TID_RECYCLE=0 wrap behavior (minus tid 0), instead of
+        // aborting. Owners that share an id are not isolated from each other.
+        first_shared = (g_hz4_tid_shared == 0);
+        tid = 1u + (g_hz4_tid_shared++ % HZ4_TID_MAX);
+    }
+    hz4_tid_unlock();
+    if (first_shared) {
+        fprintf(stderr, "[HZ4_WARN] owner tid space exhausted (%u live threads), sharing ids\n",
+                (unsigned)HZ4_TID_MAX);
+    }
+    *tid_out = (uint16_t)tid;
+    return 0;
+}
+
+// Park the exiting owner. If no block can be mapped the tid is simply never
+// reused (its pages stay orphaned, as without recycling).
+static void hz4_tid_park(const hz4_tls_t* tls) {
+    hz4_tid_lock();
+    hz4_tid_park_t* park = g_hz4_tid_spare;
+    if (park) {
+        g_hz4_tid_spare = park->next;
+    }
+    hz4_tid_unlock();
+    if (!park) {
+        park = (hz4_tid_park_t*)hz4_os_large_acquire(sizeof(hz4_tid_park_t));
+        if (!park) {
+            return;
+        }
+    }
+    memcpy(&park->tls, tls, sizeof(*tls));
+    hz4_tid_lock();
+    park->next = g_hz4_tid_parked;
+    g_hz4_tid_parked = park;
+    hz4_tid_unlock();
+}
+
+static void hz4_tid_exit_destructor(void* value);
+
+static void hz4_tid_key_init(void) {
+    (void)pthread_key_create(&g_hz4_tid_key, hz4_tid_exit_destructor);
+}
+
+// Called after the TLS is marked initialized: pthread_setspecific may
+// allocate, and that allocation must not re-enter init.
+static void hz4_tid_register_exit(uint16_t tid) {
+    pthread_once(&g_hz4_tid_key_once, hz4_tid_key_init);
+    (void)pthread_setspecific(g_hz4_tid_key, (void*)(uintptr_t)tid);
+}
+
+static inline void hz4_tls_acquire_init(hz4_tls_t* tls) {
+    uint16_t tid = 0;
+    if (!hz4_tid_acquire(tls, &tid)) {
+        hz4_tls_init(tls, tid);
+    }
+}
+#else
 static _Atomic(uint16_t) g_hz4_tid_next = 1;
+
+static inline void hz4_tls_acquire_init(hz4_tls_t* tls) {
+    uint16_t tid = atomic_fetch_add_explicit(&g_hz4_tid_next, 1, memory_order_relaxed);
+    hz4_tls_init(tls, tid);
+}
+#endif
+
+#if HZ4_TLS_DIRECT
 __thread hz4_tls_t g_hz4_tls;
 __thread uint8_t g_hz4_tls_inited = 0;
 
@@ -23,16 +145,17 @@ void hz4_tls_init_slow(void) {
         hz4_cph_init();
     }
 #endif
-    uint16_t tid = atomic_fetch_add_explicit(&g_hz4_tid_next, 1, memory_order_relaxed);
-    hz4_tls_init(&g_hz4_tls, tid);
+    hz4_tls_acquire_init(&g_hz4_tls);
     g_hz4_tls_inited = 1;
+#if HZ4_TID_RECYCLE
+    hz4_tid_register_exit(g_hz4_tls.tid);
+#endif
 }
 
 #else
 // Legacy 実装 (HZ4_TLS_DIRECT=0)
 __thread hz4_tls_t tls;
 static __thread uint8_t g_hz4_tls_inited = 0;
-static _Atomic(uint16_t) g_hz4_tid_next = 1;
 
 #if HZ4_CENTRAL_PAGEHEAP
 static _Atomic(uint8_t) g_cph_inited = 0;
@@ -46,10 +169,28 @@ hz4_tls_t* hz4_tls_get(void) {
             hz4_cph_init();
         }
 #endif
-        uint16_t tid = atomic_fetch_add_explicit(&g_hz4_tid_next, 1, memory_order_relaxed);
-        hz4_tls_init(&tls, tid);
+        hz4_tls_acquire_init(&tls);
         g_hz4_tls_inited = 1;
+#if HZ4_TID_RECYCLE
+        hz4_tid_register_exit(tls.tid);
+#endif
     }
     return &tls;
 }
 #endif
+
+#if HZ4_TID_RECYCLE
+// Thread exit: drop the TLS before parking so any later malloc/free from other
+// TLS destructors re-inits (adopting or bumping) instead of touching the
+// parked owner.
+static void hz4_tid_exit_destructor(void* value) {
+    (void)value;
+#if HZ4_TLS_DIRECT
+    g_hz4_tls_inited = 0;
+    hz4_tid_park(&g_hz4_tls);
+#else
+    g_hz4_tls_inited = 0;
+    hz4_tid_park(&tls);
+#endif
+}
+#endif
@@ -0,0 +1,193 @@
+// hz4_cph_stress_test.c - CPH LockFreeBox push/pop/remove stress
+// Worker threads push, pop and remove a fixed pool of metas concurrently.
+// Every meta a thread gets from CPH must be exclusively held (no double
+// ownership), popped metas must be INFLIGHT, and after the run every meta is
+// drained exactly once. Built owner-strict and with HZ4_CPH_2TIER=1.
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hz4_seg.h"
+#include "hz4_central_pageheap.h"
+
+#define METAS 48
+#define THREADS 4
+#define ITERS 1000000
+
+#if HZ4_CPH_2TIER
+#define CPH_MODE "2tier"
+#else
+#define CPH_MODE "owner-strict"
+#endif
+
+static hz4_page_meta_t g_metas[METAS];
+static _Atomic int g_held[METAS];
+static _Atomic long g_ops[3];  // push, pop, remove
+static _Atomic int g_failures = 0;
+
+#define CHECK(cond, msg)                             \
+    do {                                             \
+        if (!(cond)) {                               \
+            fprintf(stderr, "FAIL: %s\n", msg);      \
+            atomic_fetch_add(&g_failures, 1);        \
+        }                                            \
+    } while (0)
+
+static void take(hz4_page_meta_t* m) {
+    int i = (int)(m - g_metas);
+    CHECK(atomic_exchange(&g_held[i], 1) == 0, "meta owned twice");
+}
+
+static void meta_reset(hz4_page_meta_t* m, uint16_t tid) {
+    m->owner_tid = tid;
+    m->sc = 0;
+    m->decommitted = 1;
+#if HZ4_CPH_2TIER
+    atomic_store(&m->cph_state, HZ4_CPH_ACTIVE);
+#endif
+    atomic_store(&m->cph_queued, HZ4_CPH_NONE);
+}
+
+// Hand a held meta to CPH; false if CPH refused it (still held).
+static bool give(hz4_page_meta_t* m, uint16_t tid, unsigned r) {
+    meta_reset(m, tid);
+    atomic_store(&g_held[m - g_metas], 0);
+#if HZ4_CPH_2TIER
+    bool ok = (r & 1u) ? hz4_cph_hot_push_meta(m) : hz4_cph_cold_push_meta(m);
+#else
+    (void)r;
+    hz4_cph_push_empty_meta(m);
+    bool ok = true;
+#endif
+    if (!ok) {
+        take(m);
+    }
+    return ok;
+}
+
+static hz4_page_meta_t* pop(uint16_t tid, unsigned r) {
+#if HZ4_CPH_2TIER
+    return (r & 2u) ? hz4_cph_hot_pop_meta(0, tid) : hz4_cph_cold_pop_meta(0, tid);
+#else
+    // Owner-strict: mostly pop as self, sometimes as another worker.
+    uint16_t as = (r & 2u) ? tid : (uint16_t)((r >> 4) % THREADS + 1u);
+    return hz4_cph_pop_empty_meta(0, as);
+#endif
+}
+
+static void* worker(void* arg) {
+    long id = (long)arg;
+    uint16_t tid = (uint16_t)(id + 1);
+    unsigned r = (unsigned)id * 2654435761u + 1u;
+    hz4_page_meta_t* mine[METAS];
+    int n = 0;
+
+    for (int i = (int)id; i < METAS; i += THREADS) {
+        take(&g_metas[i]);
+        mine[n++] = &g_metas[i];
+    }
+    for (long it = 0; it < ITERS; it++) {
+        r = r * 1103515245u + 12345u;
+        unsigned op = (r >> 16) % 3u;
+        if (op == 0 && n > 0) {
+            int k = (int)((r >> 8) % (unsigned)n);
+            hz4_page_meta_t* m = mine[k];
+            mine[k] = mine[--n];
+            if (give(m, tid, r)) {
+                atomic_fetch_add(&g_ops[0], 1);
+            } else {
+                mine[n++] = m;
+            }
+        } else if (op == 1) {
+            hz4_page_meta_t* m = pop(tid, r);
+            if (m) {
+                CHECK(atomic_load(&m->cph_queued) == HZ4_CPH_INFLIGHT, "popped meta is INFLIGHT");
+                take(m);
+                mine[n++] = m;
+                atomic_fetch_add(&g_ops[1], 1);
+            }
+        } else {
+            hz4_page_meta_t* m = &g_metas[(r >> 8) % METAS];
+            if (hz4_cph_remove_meta(m)) {
+                take(m);
+                mine[n++] = m;
+                atomic_fetch_add(&g_ops[2], 1);
+            }
+        }
+    }
+    while (n > 0) {
+        hz4_page_meta_t* m = mine[--n];
+        while (!give(m, tid, 0u)) {
+        }
+    }
+    return NULL;
+}
+
+#if !HZ4_CPH_2TIER
+// An owner page pushed first and buried under more than HZ4_CPH_OWNER_SCAN
+// foreign pages of the same shard must still be found (full-scan fallback).
+static void check_buried_owner(void) {
+    const uint16_t owner = 1;
+    const uint16_t foreign = (uint16_t)(1u + HZ4_CPH_SHARDS);  // same shard
+    const int buried = HZ4_CPH_OWNER_SCAN + 8;
+    CHECK(buried + 1 <= METAS, "enough metas for the buried-owner case");
+
+    meta_reset(&g_metas[0], owner);
+    hz4_cph_push_empty_meta(&g_metas[0]);
+    for (int i = 1; i <= buried; i++) {
+        meta_reset(&g_metas[i], foreign);
+        hz4_cph_push_empty_meta(&g_metas[i]);
+    }
+    CHECK(hz4_cph_pop_empty_meta(0, owner) == &g_metas[0], "buried owner page found");
+    CHECK(hz4_cph_pop_empty_meta(0, owner) == NULL, "no other owner page");
+    int got = 0;
+    while (hz4_cph_pop_empty_meta(0, foreign) != NULL) {
+        got++;
+    }
+    CHECK(got == buried, "foreign pages all put back");
+}
+#endif
+
+int main(void) {
+    hz4_cph_init();
+#if !HZ4_CPH_2TIER
+    check_buried_owner();
+#endif
+
+    pthread_t th[THREADS];
+    for (long i = 0; i < THREADS; i++) {
+        CHECK(pthread_create(&th[i], NULL, worker, (void*)i) == 0, "pthread_create");
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(th[i], NULL);
+    }
+
+    int drained = 0;
+    hz4_page_meta_t* m;
+#if HZ4_CPH_2TIER
+    while ((m = hz4_cph_cold_pop_meta(0, 1)) != NULL || (m = hz4_cph_hot_pop_meta(0, 1)) != NULL) {
+        take(m);
+        drained++;
+    }
+    CHECK(atomic_load(&g_cph_hot_count[0]) == 0, "hot_count back to 0");
+#else
+    for (uint16_t t = 1; t <= THREADS; t++) {
+        while ((m = hz4_cph_pop_empty_meta(0, t)) != NULL) {
+            take(m);
+            drained++;
+        }
+    }
+#endif
+    CHECK(drained == METAS, "every meta drained exactly once");
+
+    if (atomic_load(&g_failures)) {
+        fprintf(stderr, "hz4_cph_stress_test: %d FAILURES (drained=%d/%d)\n",
+                atomic_load(&g_failures), drained, METAS);
+        return 1;
+    }
+    printf("hz4_cph_stress_test ok (%s push=%ld pop=%ld remove=%ld drained=%d)\n",
+           CPH_MODE, atomic_load(&g_ops[0]), atomic_load(&g_ops[1]), atomic_load(&g_ops[2]),
+           drained);
+    return 0;
+}
@@ -0,0 +1,127 @@
+// hz4_size_boundary_test.c - small/mid size-boundary test
+// Allocates at every class edge around the small/mid boundary (HZ4_SIZE_MAX,
+// which is the PageRunBandBox top when HZ4_PAGE_RUN_BAND=1) and checks that
+// the object lands on the expected path, is fully writable, and can be freed
+// both by its owner and cross-thread. Built once per band setting.
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hz4_mid.h"
+#include "hz4_sizeclass.h"
+#include "hz4_tcache.h"
+
+#define MAX_SIZES 128
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+    do {                                       \
+        if (!(cond)) {                         \
+            fprintf(stderr, "FAIL: %s\n", msg); \
+            failures++;                        \
+        }                                      \
+    } while (0)
+
+static size_t g_sizes[MAX_SIZES];
+static int g_nsizes = 0;
+static void* g_remote[MAX_SIZES];
+
+static void add_size(size_t size) {
+    if (size > 0 && g_nsizes < MAX_SIZES) {
+        g_sizes[g_nsizes++] = size;
+    }
+}
+
+static int is_mid(void* p) {
+    uintptr_t base = (uintptr_t)p & ~((uintptr_t)HZ4_PAGE_SIZE - 1u);
+    return *(uint32_t*)base == HZ4_MID_MAGIC;
+}
+
+static void check_one(void* p, size_t size) {
+    CHECK(p != NULL, "alloc at boundary");
+    if (!p) {
+        return;
+    }
+    memset(p, 0x5A, size);
+    if (size <= HZ4_SIZE_MAX) {
+        CHECK(!is_mid(p), "size <= HZ4_SIZE_MAX served by small");
+        CHECK(hz4_small_usable_size(p) >= size, "small usable size covers request");
+    } else {
+        CHECK(is_mid(p), "size > HZ4_SIZE_MAX served by mid");
+    }
+}
+
+static void check_classes(void) {
+    uint8_t prev = 0;
+    for (size_t size = 1; size <= HZ4_SIZE_MAX + HZ4_SIZE_ALIGN; size++) {
+        uint8_t sc = hz4_size_to_sc(size);
+        if (size > HZ4_SIZE_MAX) {
+            CHECK(sc == HZ4_SC_INVALID, "size above HZ4_SIZE_MAX has no small class");
+            continue;
+        }
+        CHECK(sc < HZ4_SC_COUNT, "small class in range");
+        CHECK(hz4_sc_to_size(sc) >= size, "class size covers request");
+        CHECK(sc >= prev, "classes are monotonic");
+        if (sc > 0) {
+            CHECK(hz4_sc_to_size((uint8_t)(sc - 1)) < size, "tightest class chosen");
+        }
+        prev = sc;
+    }
+    CHECK(hz4_sc_to_size((uint8_t)(HZ4_SC_COUNT - 1)) == HZ4_SIZE_MAX, "top class is HZ4_SIZE_MAX");
+}
+
+static void* remote_alloc(void* arg) {
+    (void)arg;
+    for (int i = 0; i < g_nsizes; i++) {
+        g_remote[i] = hz4_malloc(g_sizes[i]);
+        if (g_remote[i]) {
+            memset(g_remote[i], 0xA5, g_sizes[i]);
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    check_classes();
+
+    add_size(HZ4_LINEAR_SIZE_MAX - 1u);
+    add_size(HZ4_LINEAR_SIZE_MAX);
+    add_size(HZ4_LINEAR_SIZE_MAX + 1u);
+    for (uint32_t sc = HZ4_LINEAR_SC_COUNT; sc < HZ4_SC_COUNT; sc++) {
+        size_t edge = hz4_sc_to_size((uint8_t)sc);
+        add_size(edge);
+        add_size(edge + 1u);
+    }
+    add_size(HZ4_SIZE_MAX + 1u);
+    add_size(32768u);
+    add_size(hz4_mid_max_size_inline());
+
+    void* local[MAX_SIZES];
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < g_nsizes; i++) {
+            local[i] = hz4_malloc(g_sizes[i]);
+            check_one(local[i], g_sizes[i]);
+        }
+        for (int i = 0; i < g_nsizes; i++) {
+            hz4_free(local[i]);
+        }
+    }
+
+    pthread_t th;
+    CHECK(pthread_create(&th, NULL, remote_alloc, NULL) == 0, "pthread_create");
+    pthread_join(th, NULL);
+    for (int i = 0; i < g_nsizes; i++) {
+        check_one(g_remote[i], g_sizes[i]);
+        hz4_free(g_remote[i]);
+    }
+
+    if (failures) {
+        fprintf(stderr, "hz4_size_boundary_test: %d FAILURES\n", failures);
+        return 1;
+    }
+    printf("hz4_size_boundary_test ok (band=%d size_max=%u sizes=%d)\n", HZ4_PAGE_RUN_BAND,
+           (unsigned)HZ4_SIZE_MAX, g_nsizes);
+    return 0;
+}
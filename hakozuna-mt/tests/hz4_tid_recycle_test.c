@@ -0,0 +1,81 @@
+// hz4_tid_recycle_test.c - OwnerIdRecycleBox churn test
+// Create/join short-lived threads far past the number that can be live at
+// once. With HZ4_TID_RECYCLE each new thread adopts a parked owner, so the
+// largest tid seen stays near the peak live count instead of tracking the
+// lifetime count. Objects freed cross-thread must still be served.
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hz4_tcache.h"
+#include "hz4_tls_init.h"
+
+#define WORKERS 4
+#define ROUNDS 500
+#define OBJS 32
+#define TID_BOUND 64  // >> WORKERS + 1; without recycling tids reach ROUNDS * WORKERS
+
+typedef struct {
+    uint16_t tid;
+    void* objs[OBJS];
+} worker_arg_t;
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+    do {                                       \
+        if (!(cond)) {                         \
+            fprintf(stderr, "FAIL: %s\n", msg); \
+            failures++;                        \
+        }                                      \
+    } while (0)
+
+static void* worker(void* p) {
+    worker_arg_t* arg = (worker_arg_t*)p;
+    for (int i = 0; i < OBJS; i++) {
+        size_t size = 16u << (i & 7);
+        arg->objs[i] = hz4_malloc(size);
+        if (arg->objs[i]) {
+            memset(arg->objs[i], 0xA5, size);
+        }
+    }
+    arg->tid = hz4_tls_get()->tid;
+    return NULL;
+}
+
+int main(void) {
+    uint16_t max_tid = 0;
+    worker_arg_t args[WORKERS];
+    pthread_t th[WORKERS];
+
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int w = 0; w < WORKERS; w++) {
+            memset(&args[w], 0, sizeof(args[w]));
+            CHECK(pthread_create(&th[w], NULL, worker, &args[w]) == 0, "pthread_create");
+        }
+        for (int w = 0; w < WORKERS; w++) {
+            pthread_join(th[w], NULL);
+            CHECK(args[w].tid != 0, "worker got an owner tid");
+            if (args[w].tid > max_tid) {
+                max_tid = args[w].tid;
+            }
+            // Free from main: the owner has exited and been parked.
+            for (int i = 0; i < OBJS; i++) {
+                CHECK(args[w].objs[i] != NULL, "worker alloc");
+                hz4_free(args[w].objs[i]);
+            }
+        }
+    }
+
+    CHECK(max_tid <= TID_BOUND, "tids reused across thread lifetimes");
+
+    if (failures) {
+        fprintf(stderr, "hz4_tid_recycle_test: %d FAILURES (max_tid=%u)\n", failures,
+                (unsigned)max_tid);
+        return 1;
+    }
+    printf("hz4_tid_recycle_test ok (lifetimes=%d max_tid=%u)\n", ROUNDS * WORKERS,
+           (unsigned)max_tid);
+    return 0;
+}
@@ -10,6 +10,10 @@ void* hz3_realloc(void* ptr, size_t size);
 #if HZ3_S300_OVERALIGNED_MEDIUM_RUNS
 void* hz3_medium_aligned_alloc(size_t size, size_t alignment);
 #endif
+#if HZ3_S301_HEAP_PROFILE
+// S301: write the live-heap sample set as a pprof heap profile (0 = ok, -1 = error).
+int   hz3_heap_profile_dump(const char* path);
+#endif
 
 // Get usable size of hz3-allocated pointer (Day 8: hybrid shim support)
 size_t hz3_usable_size(void* ptr);
@@ -37,6 +37,46 @@ extern _Atomic(uint16_t)* g_hz3_page_tag;
 extern _Atomic(uint32_t)* g_hz3_page_tag32;
 #endif
 
+#if HZ3_S302_ARENA_GROW
+// S302: ArenaGrowBox - extension arenas 1..N (arena 0 = primary above).
+// Each extension arena is HZ3_ARENA_SIZE-aligned, so a pointer maps to its
+// arena number with one directory load. Indices stay flat:
+//   global slot     = arena_no * HZ3_S302_SLOTS_PER_ARENA + local slot
+//   global page_idx = arena_no * HZ3_ARENA_MAX_PAGES + local page
+_Static_assert((HZ3_ARENA_SIZE & (HZ3_ARENA_SIZE - 1)) == 0,
+               "S302 requires a power-of-two HZ3_ARENA_SIZE");
+_Static_assert((unsigned long long)HZ3_S302_ARENA_MAX * HZ3_ARENA_MAX_PAGES <= (1ULL << 32),
+               "S302 global page_idx must fit in 32 bits");
+
+#define HZ3_S302_SLOTS_PER_ARENA ((uint32_t)(HZ3_ARENA_SIZE / HZ3_SEG_SIZE))
+#define HZ3_S302_DIR_SIZE ((size_t)((1ULL << HZ3_S302_ADDR_BITS) / HZ3_ARENA_SIZE))
+
+// 0 = not an extension arena, else arena number (published after its tags).
+extern _Atomic(uint8_t) g_hz3_s302_arena_dir[HZ3_S302_DIR_SIZE];
+
+static inline uint32_t hz3_s302_arena_no(uintptr_t addr) {
+    uintptr_t cell = addr / (uintptr_t)HZ3_ARENA_SIZE;
+    if (__builtin_expect(cell >= HZ3_S302_DIR_SIZE, 0)) {
+        return 0;
+    }
+    return atomic_load_explicit(&g_hz3_s302_arena_dir[cell], memory_order_acquire);
+}
+
+// Extension-arena page index (primary miss path only).
+static inline int hz3_s302_page_index_ext(const void* ptr, uint32_t* page_idx_out) {
+    uintptr_t addr = (uintptr_t)ptr;
+    uint32_t arena_no = hz3_s302_arena_no(addr);
+    if (arena_no == 0) {
+        return 0;
+    }
+    if (page_idx_out) {
+        *page_idx_out = arena_no * (uint32_t)HZ3_ARENA_MAX_PAGES +
+                        (uint32_t)((addr & ((uintptr_t)HZ3_ARENA_SIZE - 1)) >> HZ3_ARENA_PAGE_SHIFT);
+    }
+    return 1;
+}
+#endif
+
 // Slow init: calls pthread_once, use in alloc/segment creation path only
 void hz3_arena_init_slow(void);
 
@@ -136,6 +176,8 @@ void hz3_arena_free(uint32_t idx);
 void* hz3_arena_get_base(void);
 uint32_t hz3_arena_slots(void);
 int hz3_arena_slot_used(uint32_t idx);
+// Slot base address (S302: resolves extension arenas), NULL if out of range.
+void* hz3_arena_slot_base(uint32_t idx);
 
 // ----------------------------------------------------------------------------
 // S46: Global Pressure Box (arena exhaustion broadcast)
@@ -186,7 +228,11 @@ HZ3_WARN_UNUSED_RESULT static inline int hz3_arena_page_index_fast(const void* p
   #else
     if (__builtin_expect(delta >= (uintptr_t)HZ3_ARENA_SIZE, 0)) {
   #endif
+#if HZ3_S302_ARENA_GROW
+        return hz3_s302_page_index_ext(ptr, page_idx_out);
+#else
         return 0;
+#endif
     }
     if (page_idx_out) {
         *page_idx_out = (uint32_t)(delta >> HZ3_ARENA_PAGE_SHIFT);
@@ -200,7 +246,11 @@ HZ3_WARN_UNUSED_RESULT static inline int hz3_arena_page_index_fast(const void* p
     }
     void* end = atomic_load_explicit(&g_hz3_arena_end, memory_order_relaxed);
     if (ptr < base || ptr >= end) {
+#if HZ3_S302_ARENA_GROW
+        return hz3_s302_page_index_ext(ptr, page_idx_out);
+#else
         return 0;  // Outside arena range
+#endif
     }
     if (page_idx_out) {
         *page_idx_out = (uint32_t)(((uintptr_t)ptr - (uintptr_t)base) >> HZ3_ARENA_PAGE_SHIFT);
@@ -452,6 +502,30 @@ static inline void hz3_pagetag32_clear(uint32_t page_idx) {
 }
 
 #if HZ3_PTAG_DSTBIN_FASTLOOKUP
+#if HZ3_S302_ARENA_GROW
+// S302: primary-miss leg of the lookups below (extension arenas).
+static inline int hz3_s302_pagetag32_lookup_ext(const void* ptr, uint32_t* tag_out, int* in_range_out) {
+    uint32_t page_idx;
+    if (!hz3_s302_page_index_ext(ptr, &page_idx)) {
+        if (in_range_out) {
+            *in_range_out = 0;
+        }
+        return 0;
+    }
+    if (in_range_out) {
+        *in_range_out = 1;
+    }
+    uint32_t tag = hz3_pagetag32_load(page_idx);
+    if (tag == 0) {
+        return 0;
+    }
+    if (tag_out) {
+        *tag_out = tag;
+    }
+    return 1;
+}
+#endif
+
 // S18-1: range check + tag load in one helper (false negative OK)
 HZ3_WARN_UNUSED_RESULT static inline int hz3_pagetag32_lookup_fast(const void* ptr, uint32_t* tag_out, int* in_range_out) {
     // Acquire load base to synchronize with release store in do_init.
@@ -488,6 +562,9 @@ HZ3_WARN_UNUSED_RESULT static inline int hz3_pagetag32_lookup_fast(const void* p
     if (__builtin_expect((delta >> 32) != 0, 0)) {
 #else
     if (__builtin_expect(delta >= (uintptr_t)HZ3_ARENA_SIZE, 0)) {
+#endif
+#if HZ3_S302_ARENA_GROW
+        return hz3_s302_pagetag32_lookup_ext(ptr, tag_out, in_range_out);
 #endif
         if (in_range_out) {
             *in_range_out = 0;
@@ -545,6 +622,9 @@ HZ3_WARN_UNUSED_RESULT static inline int hz3_pagetag32_lookup_hit_fast(const voi
     if (__builtin_expect((delta >> 32) != 0, 0)) {
 #else
     if (__builtin_expect(delta >= (uintptr_t)HZ3_ARENA_SIZE, 0)) {
+#endif
+#if HZ3_S302_ARENA_GROW
+        return hz3_s302_pagetag32_lookup_ext(ptr, tag_out, NULL);
 #endif
         return 0;
     }
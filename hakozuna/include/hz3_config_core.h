@@ -100,6 +100,266 @@
 #define HZ3_WATCH_PTR_SHOT 1
 #endif
 
+// ============================================================================
+// S301: HeapProfileBox (allocation sampling + pprof live-heap dump)
+// ============================================================================
+//
+// Samples one allocation per ~HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES (geometric)
+// of bytes handed out by the refill/slow paths; tcache hits are not touched.
+// Sampled objects are served by the large box so free finds them through the
+// large header. Dump on HZ3_S301_HEAP_PROFILE_SIGNAL (0=off) or via
+// hz3_heap_profile_dump(). POSIX only.
+#ifndef HZ3_S301_HEAP_PROFILE
+#define HZ3_S301_HEAP_PROFILE 0
+#endif
+
+#ifndef HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES
+#define HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES (512u * 1024u)
+#endif
+
+#ifndef HZ3_S301_HEAP_PROFILE_MAX_SAMPLES
+#define HZ3_S301_HEAP_PROFILE_MAX_SAMPLES 16384
+#endif
+
+#ifndef HZ3_S301_HEAP_PROFILE_DEPTH
+#define HZ3_S301_HEAP_PROFILE_DEPTH 32
+#endif
+
+// Dump signal number (-1 = SIGUSR2, 0 = no handler). Installed only if the
+// process still has the default disposition for it.
+#ifndef HZ3_S301_HEAP_PROFILE_SIGNAL
+#define HZ3_S301_HEAP_PROFILE_SIGNAL (-1)
+#endif
+
+// Signal-triggered dumps go to "<prefix>.<pid>.<seq>.heap" in the cwd.
+#ifndef HZ3_S301_HEAP_PROFILE_PREFIX
+#define HZ3_S301_HEAP_PROFILE_PREFIX "hz3"
+#endif
+
+#if HZ3_S301_HEAP_PROFILE && defined(_WIN32)
+#error "HZ3_S301_HEAP_PROFILE is POSIX only"
+#endif
+
+// ============================================================================
+// S302: ArenaGrowBox (extension arenas reserved on demand)
+// ============================================================================
+//
+// When the primary arena (HZ3_ARENA_SIZE) has no free slot, reserve another
+// HZ3_ARENA_SIZE-aligned arena instead of running pressure reclaim / OOM.
+// Extension arenas are found through a byte directory indexed by
+// addr / HZ3_ARENA_SIZE; the primary arena keeps its single-compare check.
+// Page tags stay one flat array: arena N owns slice N (reserved up front,
+// committed when the arena is added). POSIX only.
+#ifndef HZ3_S302_ARENA_GROW
+#define HZ3_S302_ARENA_GROW 0
+#endif
+
+// Arena count cap including the primary (<= 255: directory entries are uint8).
+#ifndef HZ3_S302_ARENA_MAX
+#define HZ3_S302_ARENA_MAX 64
+#endif
+
+// User address bits covered by the directory (48 = x86-64 / arm64 4-level).
+#ifndef HZ3_S302_ADDR_BITS
+#define HZ3_S302_ADDR_BITS 48
+#endif
+
+#if HZ3_S302_ARENA_GROW && defined(_WIN32)
+#error "HZ3_S302_ARENA_GROW is POSIX only"
+#endif
+
+#if HZ3_S302_ARENA_GROW && (HZ3_S302_ARENA_MAX < 2 || HZ3_S302_ARENA_MAX > 255)
+#error "HZ3_S302_ARENA_MAX must be in [2, 255]"
+#endif
+
+// ============================================================================
+// S303: ThpSegBox (huge-page advice for arena segments, epoch-only)
+// ============================================================================
+//
+// Arena slots are grouped into PMD-sized units (2MB, or one segment if
+// HZ3_SEG_SIZE is larger; the arena base is aligned to the unit). The epoch
+// scan classifies units by the free-page counts hz3 already keeps (SegMeta for
+// medium, Hz3SegHdr for small): dense -> MADV_HUGEPAGE, sparse ->
+// MADV_NOHUGEPAGE, dense for HZ3_S303_THP_HOT_PASSES scans -> one
+// MADV_COLLAPSE attempt. Fresh slots get MADV_NOHUGEPAGE at carve so THP
+// "always" does not back a near-empty segment with 2MB. Linux only.
+// Small-dominant workloads need HZ3_S134_EPOCH_ON_SMALL_SLOW=1 to tick.
+#ifndef HZ3_S303_THP_SEG
+#define HZ3_S303_THP_SEG 0
+#endif
+
+// Used-page percentage at/above which a unit is dense.
+#ifndef HZ3_S303_THP_DENSE_PCT
+#define HZ3_S303_THP_DENSE_PCT 75
+#endif
+
+// Used-page percentage at/below which a unit is sparse.
+#ifndef HZ3_S303_THP_SPARSE_PCT
+#define HZ3_S303_THP_SPARSE_PCT 25
+#endif
+
+// Consecutive dense scans before MADV_COLLAPSE (0 = never collapse).
+#ifndef HZ3_S303_THP_HOT_PASSES
+#define HZ3_S303_THP_HOT_PASSES 4
+#endif
+
+// Run one scan every N epoch ticks (process-wide, power of 2).
+#ifndef HZ3_S303_THP_TICK_EPOCHS
+#define HZ3_S303_THP_TICK_EPOCHS 4
+#endif
+
+// Units inspected per scan (cursor wraps at the carve high-water mark).
+#ifndef HZ3_S303_THP_SCAN_BUDGET
+#define HZ3_S303_THP_SCAN_BUDGET 64
+#endif
+
+// MADV_NOHUGEPAGE on freshly carved slots.
+#ifndef HZ3_S303_THP_CARVE_NOHUGE
+#define HZ3_S303_THP_CARVE_NOHUGE 1
+#endif
+
+// atexit one-shot madvise counters.
+#ifndef HZ3_S303_THP_STATS
+#define HZ3_S303_THP_STATS 0
+#endif
+
+#if HZ3_S303_THP_SEG && !defined(__linux__)
+#error "HZ3_S303_THP_SEG is Linux only"
+#endif
+
+#if HZ3_S303_THP_SEG && (HZ3_S303_THP_SPARSE_PCT >= HZ3_S303_THP_DENSE_PCT || HZ3_S303_THP_DENSE_PCT > 100)
+#error "HZ3_S303_THP: need SPARSE_PCT < DENSE_PCT <= 100"
+#endif
+
+#if HZ3_S303_THP_SEG && ((HZ3_S303_THP_TICK_EPOCHS & (HZ3_S303_THP_TICK_EPOCHS - 1)) != 0)
+#error "HZ3_S303_THP_TICK_EPOCHS must be a power of 2"
+#endif
+
+// ============================================================================
+// S304: ShardSizingBox (runtime active shard count, least-loaded assignment)
+// ============================================================================
+//
+// HZ3_NUM_SHARDS stays the compile-time capacity (static per-shard tables;
+// owner ids are uint8, PTAG16 owner is 6-bit). The active count starts at
+// online CPUs * HZ3_S304_SHARDS_PER_CPU (clamped to capacity) and grows one
+// shard at a time only when every active shard has a live thread, so threads
+// still collide only at capacity. A colliding thread takes the least-loaded
+// active shard; exits free their shard for the next thread. Per-shard sweeps
+// (outbox / dense bank flush) stop at the active count. Init-only.
+#ifndef HZ3_S304_DYN_SHARDS
+#define HZ3_S304_DYN_SHARDS 0
+#endif
+
+#ifndef HZ3_S304_SHARDS_PER_CPU
+#define HZ3_S304_SHARDS_PER_CPU 1
+#endif
+
+#if HZ3_S304_DYN_SHARDS && HZ3_S304_SHARDS_PER_CPU < 1
+#error "HZ3_S304_SHARDS_PER_CPU must be >= 1"
+#endif
+
+// ============================================================================
+// S305: ReallocInPlaceBox (medium realloc without copy)
+// ============================================================================
+//
+// hz3_realloc() on a medium run owned by the calling shard changes the run's
+// size class in place: growth claims the following segment pages when their
+// free bits are set, shrink returns the tail pages via hz3_segment_free_run().
+// Page tags (sc_tag / PTAG16 / PTAG32 / S113 page_bin_plus1) are rewritten to
+// the new class. Remote-owned runs and blocked growth keep malloc+copy+free.
+#ifndef HZ3_S305_REALLOC_INPLACE
+#define HZ3_S305_REALLOC_INPLACE 0
+#endif
+
+// atexit one-shot grow/shrink counters.
+#ifndef HZ3_S305_REALLOC_STATS
+#define HZ3_S305_REALLOC_STATS 0
+#endif
+
+// ============================================================================
+// S306: KnobCtlBox (per-sc medium knob controller, epoch-only)
+// ============================================================================
+//
+// Replaces the Day-6 learner (one knob, one sc per epoch, global knobs) with a
+// per-thread controller that updates every medium class at each epoch:
+// - bin_target: AIMD on refills per epoch (additive increase when the bin
+//   keeps running dry, halve after idle epochs).
+// - refill_batch: sized from the EWMA of objects the slow path supplied per
+//   epoch (the burst), so a class is refilled ~TARGET_REFILLS times per epoch.
+// - budget: sum(bin_target * size) per thread is kept under CACHE_BUDGET_KB by
+//   halving the largest holders.
+// Writes t_hz3_cache.knobs (TLS); the slow path reads knobs.refill_batch[]
+// instead of HZ3_REFILL_BATCH[]. Exclusive with S58 decay and HZ3_LEARN_ENABLE.
+#ifndef HZ3_S306_KNOB_CTL
+#define HZ3_S306_KNOB_CTL 0
+#endif
+
+// Refills per epoch at/above which bin_target grows by one refill batch.
+#ifndef HZ3_S306_MISS_HI
+#define HZ3_S306_MISS_HI 8
+#endif
+
+// Consecutive refill-free epochs before bin_target is halved (refill_batch is kept).
+#ifndef HZ3_S306_IDLE_EPOCHS
+#define HZ3_S306_IDLE_EPOCHS 2
+#endif
+
+// Desired refills per epoch per busy class (burst / this = refill_batch).
+#ifndef HZ3_S306_TARGET_REFILLS
+#define HZ3_S306_TARGET_REFILLS 8
+#endif
+
+// refill_batch clamp (max is bounded by the 16-entry slow-path batch arrays).
+#ifndef HZ3_S306_REFILL_MIN
+#define HZ3_S306_REFILL_MIN 2
+#endif
+#ifndef HZ3_S306_REFILL_MAX
+#define HZ3_S306_REFILL_MAX 16
+#endif
+
+// bin_target ceiling (objects).
+#ifndef HZ3_S306_TARGET_MAX
+#define HZ3_S306_TARGET_MAX 64
+#endif
+
+// Per-thread medium cache budget: sum(bin_target[sc] * size(sc)).
+#ifndef HZ3_S306_CACHE_BUDGET_KB
+#define HZ3_S306_CACHE_BUDGET_KB 4096
+#endif
+
+// Record knob changes in a process-wide ring, dumped at exit.
+#ifndef HZ3_S306_TRACE
+#define HZ3_S306_TRACE 0
+#endif
+
+#ifndef HZ3_S306_TRACE_RING
+#define HZ3_S306_TRACE_RING 256
+#endif
+
+// atexit one-shot controller counters.
+#ifndef HZ3_S306_STATS
+#define HZ3_S306_STATS 0
+#endif
+
+#if HZ3_S306_KNOB_CTL
+#if HZ3_LEARN_ENABLE
+#error "HZ3_S306_KNOB_CTL replaces the Day-6 learner; set HZ3_LEARN_ENABLE=0"
+#endif
+#if HZ3_S306_REFILL_MIN < 1 || HZ3_S306_REFILL_MAX > 16 || \
+    HZ3_S306_REFILL_MIN > HZ3_S306_REFILL_MAX
+#error "HZ3_S306_REFILL_MIN/MAX must satisfy 1 <= MIN <= MAX <= 16"
+#endif
+#if HZ3_S306_TARGET_MAX < HZ3_S306_REFILL_MAX || HZ3_S306_TARGET_MAX > 255
+#error "HZ3_S306_TARGET_MAX must be in [HZ3_S306_REFILL_MAX, 255]"
+#endif
+#if HZ3_S306_TARGET_REFILLS < 1 || HZ3_S306_IDLE_EPOCHS < 1
+#error "HZ3_S306_TARGET_REFILLS and HZ3_S306_IDLE_EPOCHS must be >= 1"
+#endif
+#if HZ3_S306_TRACE && ((HZ3_S306_TRACE_RING & (HZ3_S306_TRACE_RING - 1)) != 0)
+#error "HZ3_S306_TRACE_RING must be a power of 2"
+#endif
+#endif
+
 // ============================================================================
 // Shard assignment / collision observability (init-only)
 // ============================================================================
@@ -2,9 +2,15 @@
 
 #include <stddef.h>
 
+#include "hz3_config.h"
+
 // Large (>32KB) allocation box (mmap-backed, correctness-first)
 void*  hz3_large_alloc(size_t size);
 void*  hz3_large_aligned_alloc(size_t alignment, size_t size);
 int    hz3_large_free(void* ptr);
 size_t hz3_large_usable_size(const void* ptr);
 void   hz3_large_s240_tls_flush(void);
+#if HZ3_S301_HEAP_PROFILE
+// S301: attach a heap-profile record to a live large block (1 = found).
+int    hz3_large_s301_attach(void* ptr, void* sample);
+#endif
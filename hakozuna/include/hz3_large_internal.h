@@ -41,4 +41,7 @@ typedef struct Hz3LargeHdr {
     uint16_t flags;
     uint32_t direct_slot;
 #endif
+#if HZ3_S301_HEAP_PROFILE
+    void*    s301_sample;           // S301: live heap-profile record (NULL = unsampled)
+#endif
 } Hz3LargeHdr;
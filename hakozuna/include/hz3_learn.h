@@ -5,6 +5,7 @@
 // ============================================================================
 // Day 6: Learning v0 - heuristic-based knob tuning
 // Gate: HZ3_LEARN_ENABLE (default 0 = OFF)
+// Superseded by S306 KnobCtlBox (hz3_s306_knob_ctl.h); the two are exclusive.
 // ============================================================================
 
 #ifndef HZ3_LEARN_ENABLE
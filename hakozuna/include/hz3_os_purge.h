@@ -31,7 +31,16 @@ static inline int hz3_os_in_arena_range(void* addr, size_t len) {
         return 0;  // overflow
     }
 
-    return (start >= (uintptr_t)base) && (end <= (uintptr_t)endp);
+    if ((start >= (uintptr_t)base) && (end <= (uintptr_t)endp)) {
+        return 1;
+    }
+#if HZ3_S302_ARENA_GROW
+    // S302: the range must sit inside one extension arena.
+    uint32_t arena_no = hz3_s302_arena_no(start);
+    return arena_no != 0 && len > 0 && hz3_s302_arena_no(end - 1) == arena_no;
+#else
+    return 0;
+#endif
 }
 
 int hz3_os_madvise_dontneed_checked(void* addr, size_t len);
@@ -88,9 +88,17 @@ static inline unsigned long hz3_thread_id(void) {
     return (unsigned long)GetCurrentThreadId();
 }
 
+// Online CPU count (init-only; >= 1)
+static inline uint32_t hz3_online_cpus(void) {
+    DWORD n = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+    return n ? (uint32_t)n : 1u;
+}
+
 #else  // POSIX (Linux)
 
 #include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
 
 #ifndef HZ3_TLS
 #ifndef HZ3_TLS_DECLSPEC
@@ -136,4 +144,10 @@ static inline unsigned long hz3_thread_id(void) {
     return (unsigned long)pthread_self();
 }
 
+// Online CPU count (init-only; >= 1)
+static inline uint32_t hz3_online_cpus(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (uint32_t)n : 1u;
+}
+
 #endif  // _WIN32
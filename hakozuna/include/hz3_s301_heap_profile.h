@@ -0,0 +1,76 @@
+#pragma once
+
+// S301: HeapProfileBox - allocation sampling + pprof live-heap dump.
+//
+// Sampling point is the refill/slow boundary only (medium alloc_slow, small_v2
+// alloc_slow, sub4k refill, large alloc). Each refill charges the bytes it is
+// about to hand to the thread (batch pops that come back short and page/run
+// carves correct it afterwards); when the per-thread geometric countdown
+// crosses zero the slow path returns a sampled object instead of refilling. Sampled
+// objects come from the large box, so hz3_free() reaches them through the
+// existing large route and the PTAG32 free leaf / tcache hit path are unchanged.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hz3_config.h"
+#include "hz3_platform.h"
+
+#if HZ3_S301_HEAP_PROFILE
+
+extern HZ3_TLS int64_t t_hz3_s301_bytes_left;
+extern _Atomic int g_hz3_s301_dump_pending;
+
+// Out-of-line: pick the sample (or run a pending signal dump). Returns the
+// sampled object, or NULL to let the caller continue its normal refill.
+void* hz3_s301_heap_profile_sample_slow(size_t charge, size_t obj_size);
+
+// Large-box entry used by hz3_malloc() for size > HZ3_SC_MAX_SIZE.
+void* hz3_s301_heap_profile_large_alloc(size_t size);
+
+// Called by hz3_large_free() for a header carrying a sample.
+void hz3_s301_heap_profile_on_free(void* sample);
+
+static inline void* hz3_s301_heap_profile_on_refill(size_t charge, size_t obj_size) {
+    t_hz3_s301_bytes_left -= (int64_t)charge;
+    if (__builtin_expect(t_hz3_s301_bytes_left > 0 &&
+                             !__atomic_load_n(&g_hz3_s301_dump_pending, __ATOMIC_RELAXED),
+                         1)) {
+        return NULL;
+    }
+    return hz3_s301_heap_profile_sample_slow(charge, obj_size);
+}
+
+// Correct the countdown when a refill hands out more (page/run carve) or fewer
+// bytes than it charged up front. Never samples; the next refill pays the debt.
+static inline void hz3_s301_heap_profile_adjust(int64_t delta_bytes) {
+    t_hz3_s301_bytes_left -= delta_bytes;
+}
+
+// A batch pop charged for `want` objects returned only `got` of them: credit
+// the objects that never reached the thread.
+static inline void hz3_s301_heap_profile_refill_short(int want, int got, size_t obj_size) {
+    if (got < want) {
+        hz3_s301_heap_profile_adjust(-(int64_t)(want - got) * (int64_t)obj_size);
+    }
+}
+
+#else
+
+static inline void* hz3_s301_heap_profile_on_refill(size_t charge, size_t obj_size) {
+    (void)charge;
+    (void)obj_size;
+    return NULL;
+}
+
+static inline void hz3_s301_heap_profile_adjust(int64_t delta_bytes) {
+    (void)delta_bytes;
+}
+
+static inline void hz3_s301_heap_profile_refill_short(int want, int got, size_t obj_size) {
+    (void)want;
+    (void)got;
+    (void)obj_size;
+}
+
+#endif  // HZ3_S301_HEAP_PROFILE
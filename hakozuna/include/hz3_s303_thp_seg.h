@@ -0,0 +1,48 @@
+#pragma once
+
+#include "hz3_config.h"
+#include "hz3_types.h"
+
+#if HZ3_S303_THP_SEG
+
+// ============================================================================
+// S303: ThpSegBox - huge-page advice for arena segments
+// ============================================================================
+//
+// Epoch-only scan over arena slots, grouped into PMD-sized units. Density
+// comes from existing free-page accounting (SegMeta.free_pages for medium,
+// Hz3SegHdr.free_pages for small), capped by mincore() residency so runs
+// purged in place count as unused; per-unit state lives in a scanner table
+// that the slot carve resets.
+//
+// Hot path: 0 (epoch tick + slot carve only)
+// Thread boundary: one scanner at a time (process-wide trylock)
+
+// Advice unit: one PMD-sized huge page, or one segment if segments are larger.
+// With 1MB segments (scale lane) a unit is two adjacent slots; the arena base
+// is aligned to the unit so every unit is PMD-aligned.
+#define HZ3_S303_HUGE_SIZE (2u << 20)
+#define HZ3_S303_UNIT_SIZE \
+    ((HZ3_SEG_SIZE > HZ3_S303_HUGE_SIZE) ? HZ3_SEG_SIZE : HZ3_S303_HUGE_SIZE)
+#define HZ3_S303_SLOTS_PER_UNIT ((uint32_t)(HZ3_S303_UNIT_SIZE / HZ3_SEG_SIZE))
+_Static_assert((HZ3_S303_UNIT_SIZE % HZ3_S303_HUGE_SIZE) == 0 &&
+               (HZ3_S303_UNIT_SIZE % HZ3_SEG_SIZE) == 0,
+               "S303 requires HZ3_SEG_SIZE to divide or be a multiple of 2MB");
+
+// Called from hz3_epoch_force(); runs a bounded scan every
+// HZ3_S303_THP_TICK_EPOCHS ticks.
+void hz3_s303_thp_tick(void);
+
+// Called from the arena slot carve (under g_hz3_arena_lock) after mmap:
+// resets the unit state and applies the carve advice.
+void hz3_s303_thp_on_carve(void* seg_base, uint32_t idx);
+
+#else  // !HZ3_S303_THP_SEG
+
+static inline void hz3_s303_thp_tick(void) {}
+static inline void hz3_s303_thp_on_carve(void* seg_base, uint32_t idx) {
+    (void)seg_base;
+    (void)idx;
+}
+
+#endif  // HZ3_S303_THP_SEG
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "hz3_config.h"
+#include "hz3_types.h"
+
+#if HZ3_S306_KNOB_CTL
+
+#include "hz3_tcache.h"
+
+#if HZ3_S58_TCACHE_DECAY
+#error "HZ3_S306_KNOB_CTL and HZ3_S58_TCACHE_DECAY both own knobs.bin_target"
+#endif
+
+// ============================================================================
+// S306: KnobCtlBox - per-sc feedback controller for medium tcache knobs
+// ============================================================================
+//
+// Inputs: t_hz3_cache.stats.refill_calls[] deltas (slow path already counts
+// them; stats are no longer reset by the learner).
+// Outputs: t_hz3_cache.knobs.bin_target[] (epoch trim) and
+// t_hz3_cache.knobs.refill_batch[] (hz3_alloc_slow() want).
+//
+// Hot path: 0 (epoch tick + one TLS load in the slow path)
+// Thread boundary: thread-local state; only the trace ring is shared.
+
+// Called from hz3_epoch_force() before the bin trim.
+void hz3_s306_knob_ctl_tick(void);
+
+// Refill request for sc (slow path).
+static inline int hz3_s306_refill_want(int sc) {
+    return (int)t_hz3_cache.knobs.refill_batch[sc];
+}
+
+#else  // !HZ3_S306_KNOB_CTL
+
+static inline void hz3_s306_knob_ctl_tick(void) {}
+
+#endif  // HZ3_S306_KNOB_CTL
@@ -72,6 +72,19 @@ static inline int hz3_bitmap_find_free_aligned(const uint64_t* bits,
     return -1;
 }
 
+// Check that pages [start, start + pages) are all free
+static inline int hz3_bitmap_range_free(const uint64_t* bits, size_t start, size_t pages) {
+    for (size_t i = 0; i < pages; i++) {
+        size_t idx = start + i;
+        size_t word = idx / 64;
+        size_t bit = idx % 64;
+        if (!(bits[word] & (1ULL << bit))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 // Mark pages as used (clear bits)
 static inline void hz3_bitmap_mark_used(uint64_t* bits, size_t start, size_t pages) {
     for (size_t i = 0; i < pages; i++) {
@@ -579,6 +579,18 @@ int hz3_shard_collision_detected(void);
 uint32_t hz3_shard_live_count(uint8_t shard);
 int hz3_shard_is_exiting(uint8_t shard);
 
+// S304: active shard count (monotonic); every assigned owner id is below it.
+#if HZ3_S304_DYN_SHARDS
+extern _Atomic uint32_t g_hz3_shard_active;
+static inline uint32_t hz3_shard_active_count(void) {
+    return atomic_load_explicit(&g_hz3_shard_active, memory_order_acquire);
+}
+#else
+static inline uint32_t hz3_shard_active_count(void) {
+    return HZ3_NUM_SHARDS;
+}
+#endif
+
 // Get bin for size class (assumes initialized)
 #if HZ3_PTAG_DSTBIN_ENABLE
 static inline int hz3_bin_index_small(int sc) {
@@ -756,6 +768,12 @@ void* hz3_alloc_slow(int sc);
 void* hz3_s236_medium_mailbox_try_pop(int sc);
 void* hz3_s236_minirefill_try(int sc);
 
+#if HZ3_S305_REALLOC_INPLACE
+// S305: resize a live medium run from old_sc to new_sc without moving it.
+// Returns 1 on success, 0 if the caller must copy (implemented in hz3_tcache_alloc.c).
+int hz3_medium_resize_inplace(void* ptr, int old_sc, int new_sc);
+#endif
+
 // S46: Global Pressure Box - pressure check and flush handler
 #if HZ3_ARENA_PRESSURE_BOX
 void hz3_pressure_check_and_flush(void);
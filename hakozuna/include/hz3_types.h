@@ -376,6 +376,13 @@ typedef struct {
     uint8_t  s58_overage[HZ3_NUM_SC];     // overage count (3 triggers shrink)
     uint16_t s58_lowwater[HZ3_NUM_SC];    // min len observed in epoch interval
 #endif
+#if HZ3_S306_KNOB_CTL
+    // S306: KnobCtlBox per-sc controller state (epoch-only)
+    uint32_t s306_prev_refills[HZ3_NUM_SC];  // stats.refill_calls at last tick
+    uint32_t s306_burst[HZ3_NUM_SC];         // EWMA objects supplied per epoch (x16)
+    uint8_t  s306_idle[HZ3_NUM_SC];          // consecutive refill-free epochs
+    uint32_t s306_ticks;
+#endif
 #if HZ3_S60_PURGE_RANGE_QUEUE
     // S60: PurgeRangeQueueBox (captures freed ranges for epoch madvise)
     Hz3PurgeRangeQueue purge_queue;
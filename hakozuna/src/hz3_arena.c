@@ -13,6 +13,9 @@
 #if HZ3_S49_SEGMENT_PACKING
 #include "hz3_segment_packing.h"
 #endif
+#if HZ3_S303_THP_SEG
+#include "hz3_s303_thp_seg.h"
+#endif
 
 #include <stdatomic.h>
 #include <stdio.h>   // for fprintf (gate metrics)
@@ -29,6 +32,7 @@
 
 #include "hz3_arena_globals.inc"
 #include "hz3_arena_s256_obs.inc"
+#include "hz3_arena_s302_grow.inc"
 #include "hz3_arena_init.inc"
 #include "hz3_arena_accessors.inc"
 #include "hz3_arena_alloc_slot.inc"
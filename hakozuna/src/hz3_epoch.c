@@ -34,6 +34,12 @@
 #if HZ3_S65_MEDIUM_RECLAIM
 #include "hz3_s65_medium_reclaim.h"
 #endif
+#if HZ3_S303_THP_SEG
+#include "hz3_s303_thp_seg.h"
+#endif
+#if HZ3_S306_KNOB_CTL
+#include "hz3_s306_knob_ctl.h"
+#endif
 
 #include <string.h>
 
@@ -279,7 +285,8 @@ void hz3_epoch_force(void) {
 #endif
 
     // 1. Flush all outboxes
-    for (int owner = 0; owner < HZ3_NUM_SHARDS; owner++) {
+    int owners = (int)hz3_shard_active_count();  // S304: owner ids < active
+    for (int owner = 0; owner < owners; owner++) {
         for (int sc = 0; sc < HZ3_NUM_SC; sc++) {
             hz3_outbox_flush((uint8_t)owner, sc);
         }
@@ -295,7 +302,12 @@ void hz3_epoch_force(void) {
     hz3_s58_adjust_targets();
 #endif
 
-    // 2. Trim bins to target (S58-1 may have adjusted bin_target)
+#if HZ3_S306_KNOB_CTL
+    // S306: Per-sc bin_target / refill_batch controller (before trim)
+    hz3_s306_knob_ctl_tick();
+#endif
+
+    // 2. Trim bins to target (S58-1 / S306 may have adjusted bin_target)
     for (int sc = 0; sc < HZ3_NUM_SC; sc++) {
         hz3_bin_trim(sc, t_hz3_cache.knobs.bin_target[sc]);
     }
@@ -360,6 +372,11 @@ void hz3_epoch_force(void) {
 
 #endif  // S65_REMOTE_GUARD
 
+#if HZ3_S303_THP_SEG
+    // S303: Huge-page advice after reclaim/purge settled segment occupancy
+    hz3_s303_thp_tick();
+#endif
+
     // 3. Update knobs snapshot if version changed
     uint32_t ver = atomic_load_explicit(&g_hz3_knobs_ver, memory_order_acquire);
     if (t_hz3_cache.knobs_ver != ver) {
@@ -367,7 +384,7 @@ void hz3_epoch_force(void) {
         t_hz3_cache.knobs_ver = ver;
     }
 
-    // 4. Day 6: Learning v0 (only when HZ3_LEARN_ENABLE=1)
+    // 4. Day 6: Learning v0 (only when HZ3_LEARN_ENABLE=1; S306 replaces it)
     hz3_learn_update(&t_hz3_cache.stats);
 
 #if HZ3_S55_RETENTION_OBSERVE && !HZ3_SHIM_FORWARD_ONLY
@@ -12,6 +12,7 @@
 #include "hz3_medium_debug.h"
 #include "hz3_sub4k.h"
 #include "hz3_watch_ptr.h"
+#include "hz3_s301_heap_profile.h"
 #include "hz3_tag.h"
 #include "hz3_arena.h"  // Task 3: for hz3_arena_contains_fast()
 
@@ -108,7 +109,11 @@ void* hz3_malloc(size_t size) {
     int sc = hz3_sc_from_size(size);
     if (sc < 0) {
         if (size > HZ3_SC_MAX_SIZE) {
+#if HZ3_S301_HEAP_PROFILE
+            return hz3_s301_heap_profile_large_alloc(size);
+#else
             return hz3_large_alloc(size);
+#endif
         }
         // Out of range, fallback
         return hz3_next_malloc(size);
@@ -296,6 +301,45 @@ void* hz3_calloc(size_t nmemb, size_t size) {
 #endif
 }
 
+#if HZ3_ENABLE && !HZ3_SHIM_FORWARD_ONLY
+// Copying resize inside hz3 (old_size = usable size of ptr).
+static void* hz3_realloc_copy(void* ptr, size_t old_size, size_t size) {
+    void* new_ptr = hz3_malloc(size);
+    if (!new_ptr) {
+        return NULL;
+    }
+    size_t copy_size = (size < old_size) ? size : old_size;
+    __builtin_memcpy(new_ptr, ptr, copy_size);
+    hz3_free(ptr);
+    return new_ptr;
+}
+
+// hz3-owned pointer whose size cannot be resolved (tag cleared / unknown kind).
+// Same policy as hz3_free(): never hand arena memory to the next allocator.
+static void* hz3_realloc_unknown(void* ptr) {
+    (void)ptr;
+#if HZ3_PTAG_FAILFAST
+    abort();
+#else
+    return NULL;
+#endif
+}
+
+#if HZ3_S305_REALLOC_INPLACE
+// S305: medium -> medium resize without copy. Returns 1 if ptr now holds size.
+static inline int hz3_realloc_medium_inplace(void* ptr, int old_sc, size_t size) {
+    int new_sc = hz3_sc_from_size(size < HZ3_SC_MIN_SIZE ? HZ3_SC_MIN_SIZE : size);
+    if (new_sc < 0) {
+        return 0;  // grows past medium
+    }
+    if (new_sc == old_sc) {
+        return 1;
+    }
+    return hz3_medium_resize_inplace(ptr, old_sc, new_sc);
+}
+#endif
+#endif
+
 void* hz3_realloc(void* ptr, size_t size) {
 #if !HZ3_ENABLE || HZ3_SHIM_FORWARD_ONLY
     return hz3_next_realloc(ptr, size);
@@ -319,23 +363,18 @@ void* hz3_realloc(void* ptr, size_t size) {
         uint32_t bin = hz3_pagetag32_bin(tag32);
         size_t old_size = hz3_bin_to_usable_size(bin);
         if (old_size == 0) {
-#if HZ3_PTAG_FAILFAST
-            abort();
-#else
-            return NULL;
-#endif
+            return hz3_realloc_unknown(ptr);
         }
-        if (size <= old_size) {
+#if HZ3_S305_REALLOC_INPLACE
+        if (bin >= HZ3_MEDIUM_BIN_BASE && bin < HZ3_MEDIUM_BIN_LIMIT &&
+            hz3_realloc_medium_inplace(ptr, (int)(bin - HZ3_MEDIUM_BIN_BASE), size)) {
             return ptr;
         }
-        void* new_ptr = hz3_malloc(size);
-        if (!new_ptr) {
-            return NULL;
+#endif
+        if (size <= old_size) {
+            return ptr;
         }
-        size_t copy_size = (size < old_size) ? size : old_size;
-        __builtin_memcpy(new_ptr, ptr, copy_size);
-        hz3_free(ptr);
-        return new_ptr;
+        return hz3_realloc_copy(ptr, old_size, size);
     }
     // S21-2: in_range && tag==0 -> fall through to slow path
     // (arena internal but tag not set, don't pass to foreign)
@@ -414,6 +453,11 @@ void* hz3_realloc(void* ptr, size_t size) {
             hz3_large_free(ptr);
             return new_ptr;
         }
+        uint32_t arena_idx;
+        void* arena_base;
+        if (hz3_arena_contains_fast(ptr, &arena_idx, &arena_base)) {
+            return hz3_realloc_unknown(ptr);  // arena-internal, never foreign
+        }
         // Not our allocation, fallback
         return hz3_next_realloc(ptr, size);
     }
@@ -424,8 +468,8 @@ void* hz3_realloc(void* ptr, size_t size) {
     uint16_t tag = meta->sc_tag[seg_page_idx];
 
     if (tag == 0) {
-        // Unknown, fallback
-        return hz3_next_realloc(ptr, size);
+        // Our segment but no live run here
+        return hz3_realloc_unknown(ptr);
     }
 
     uint8_t kind = hz3_tag_kind(tag);
@@ -440,27 +484,21 @@ void* hz3_realloc(void* ptr, size_t size) {
                ) {
         old_size = hz3_sc_to_size(old_sc);
     } else {
-        return hz3_next_realloc(ptr, size);
+        return hz3_realloc_unknown(ptr);
     }
 
-    if (size <= old_size) {
+#if HZ3_S305_REALLOC_INPLACE
+    if (kind == HZ3_TAG_KIND_LARGE && hz3_realloc_medium_inplace(ptr, old_sc, size)) {
         return ptr;
     }
+#endif
 
-    // Need to reallocate
-    void* new_ptr = hz3_malloc(size);
-    if (!new_ptr) {
-        return NULL;
+    if (size <= old_size) {
+        return ptr;
     }
 
-    // Copy old data (min of old and new size)
-    size_t copy_size = (size < old_size) ? size : old_size;
-    __builtin_memcpy(new_ptr, ptr, copy_size);
-
-    // Free old
-    hz3_free(ptr);
-
-    return new_ptr;
+    // Need to reallocate
+    return hz3_realloc_copy(ptr, old_size, size);
 #endif
 }
 
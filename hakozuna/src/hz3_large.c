@@ -6,6 +6,7 @@
 #include "hz3_large_internal.h"
 #include "hz3_oom.h"
 #include "hz3_watch_ptr.h"
+#include "hz3_s301_heap_profile.h"
 #include "hz3_platform.h"
 #include "hz3_tcache.h"
 
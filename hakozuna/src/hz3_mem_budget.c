@@ -196,7 +196,7 @@ size_t hz3_mem_budget_reclaim_segments(size_t target_bytes) {
         }
 
         // Calculate segment base address
-        void* seg_base = (char*)arena_base + (size_t)i * HZ3_SEG_SIZE;
+        void* seg_base = hz3_arena_slot_base(i);
 
         // Get segment metadata from segmap
         Hz3SegMeta* meta = hz3_segmap_get(seg_base);
@@ -752,7 +752,7 @@ size_t hz3_mem_budget_reclaim_segments_budget(size_t target_bytes, uint32_t scan
         }
 
         // Calculate segment base address
-        void* seg_base = (char*)arena_base + (size_t)slot * HZ3_SEG_SIZE;
+        void* seg_base = hz3_arena_slot_base(slot);
 
         // Get segment metadata from segmap
         Hz3SegMeta* meta = hz3_segmap_get(seg_base);
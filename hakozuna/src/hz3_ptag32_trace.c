@@ -417,7 +417,12 @@ void hz3_ptag32_store_trace(uint32_t page_idx, uint32_t old_tag, uint32_t new_ta
 	    void* arena_base = atomic_load_explicit(&g_hz3_arena_base, memory_order_acquire);
 	    void* page_addr = NULL;
 	    if (arena_base) {
-	        page_addr = (void*)((uintptr_t)arena_base + ((uintptr_t)page_idx << HZ3_ARENA_PAGE_SHIFT));
+	        // Global page_idx -> slot + page (S302 extension arenas resolve via the slot table).
+	        uint32_t seg_pages = (uint32_t)(HZ3_SEG_SIZE >> HZ3_ARENA_PAGE_SHIFT);
+	        char* slot_base = (char*)hz3_arena_slot_base(page_idx / seg_pages);
+	        if (slot_base) {
+	            page_addr = slot_base + ((size_t)(page_idx % seg_pages) << HZ3_ARENA_PAGE_SHIFT);
+	        }
 	    }
 
 	    fprintf(stderr,
@@ -0,0 +1,459 @@
+#define _GNU_SOURCE
+
+#include "hz3_s301_heap_profile.h"
+
+#if HZ3_S301_HEAP_PROFILE
+
+#include "hz3.h"
+#include "hz3_large.h"
+#include "hz3_sc.h"
+
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <link.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// ============================================================================
+// State
+// ============================================================================
+
+typedef struct Hz3S301Sample {
+    void*    ptr;
+    size_t   obj_size;
+    size_t   weight;      // estimated live bytes this sample stands for
+    uint32_t depth;
+    uint32_t live;
+    int32_t  next_free;
+    void*    stack[HZ3_S301_HEAP_PROFILE_DEPTH];
+} Hz3S301Sample;
+
+HZ3_TLS int64_t t_hz3_s301_bytes_left = 0;
+_Atomic int g_hz3_s301_dump_pending = 0;
+
+static HZ3_TLS int      t_hz3_s301_busy = 0;
+static HZ3_TLS int      t_hz3_s301_armed = 0;
+static HZ3_TLS uint64_t t_hz3_s301_rng = 0;
+
+static Hz3S301Sample g_hz3_s301_pool[HZ3_S301_HEAP_PROFILE_MAX_SAMPLES];
+static hz3_lock_t    g_hz3_s301_lock = HZ3_LOCK_INITIALIZER;
+static int32_t       g_hz3_s301_free_head = -1;
+static uint32_t      g_hz3_s301_pool_used = 0;   // never-used tail watermark
+static uint64_t      g_hz3_s301_dropped = 0;     // pool exhausted
+static _Atomic uint32_t g_hz3_s301_dump_seq = 0;
+
+// Leading backtrace frames inside this object are allocator frames; trimmed
+// unless hz3 is linked into the main executable (then user frames share it).
+static uintptr_t g_hz3_s301_self_base = 0;
+
+// ============================================================================
+// Math (no libm: the LD_PRELOAD lane links only libc/pthread/dl)
+// ============================================================================
+
+// ln(x) for x in (0, 1]: x = m * 2^e, m in [1, 2), ln m = 2 atanh((m-1)/(m+1)).
+static double hz3_s301_ln(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int e = (int)((bits >> 52) & 0x7FFu) - 1023;
+    bits = (bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+    double s = (m - 1.0) / (m + 1.0);
+    double s2 = s * s;
+    double term = s;
+    double sum = 0.0;
+    for (int k = 1; k < 24; k += 2) {
+        sum += term / (double)k;
+        term *= s2;
+    }
+    return (double)e * 0.69314718055994530942 + 2.0 * sum;
+}
+
+// exp(-x) for x >= 0: halve into [0, 0.5), Taylor, square back.
+static double hz3_s301_exp_neg(double x) {
+    if (x > 64.0) {
+        return 0.0;
+    }
+    int halvings = 0;
+    while (x >= 0.5) {
+        x *= 0.5;
+        halvings++;
+    }
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k < 14; k++) {
+        term *= -x / (double)k;
+        sum += term;
+    }
+    while (halvings-- > 0) {
+        sum *= sum;
+    }
+    return sum;
+}
+
+static uint64_t hz3_s301_rand(void) {
+    uint64_t x = t_hz3_s301_rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    t_hz3_s301_rng = x;
+    return x;
+}
+
+// Geometric (exponential) gap with mean HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES.
+static int64_t hz3_s301_next_interval(void) {
+    // 53-bit uniform in (0, 1].
+    double u = (double)((hz3_s301_rand() >> 11) + 1u) * (1.0 / 9007199254740992.0);
+    double gap = -hz3_s301_ln(u) * (double)HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES;
+    if (gap < 1.0) {
+        gap = 1.0;
+    }
+    return (int64_t)gap;
+}
+
+// A refill of `charge` bytes is sampled with p = 1 - exp(-charge/R). A sampled
+// refill hands out one obj_size object instead of `charge` bytes, so it stands
+// for charge/p - charge + obj_size: p * weight = (1-p)*charge + p*obj_size is
+// what the refill hands out on average, so the live estimate stays unbiased.
+static size_t hz3_s301_weight(size_t charge, size_t obj_size) {
+    double r = (double)HZ3_S301_HEAP_PROFILE_SAMPLE_BYTES;
+    double p = 1.0 - hz3_s301_exp_neg((double)charge / r);
+    if (p <= 0.0) {
+        return (size_t)r;
+    }
+    return (size_t)((double)charge / p - (double)charge) + obj_size;
+}
+
+// ============================================================================
+// Stack capture
+// ============================================================================
+
+static int hz3_s301_find_exe_base(struct dl_phdr_info* info, size_t size, void* arg) {
+    (void)size;
+    uintptr_t lo = UINTPTR_MAX;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        if (info->dlpi_phdr[i].p_type == PT_LOAD && info->dlpi_phdr[i].p_vaddr < lo) {
+            lo = info->dlpi_phdr[i].p_vaddr;
+        }
+    }
+    *(uintptr_t*)arg = (uintptr_t)info->dlpi_addr + (lo & ~(uintptr_t)4095u);
+    return 1;  // first entry is the main program
+}
+
+static uint32_t hz3_s301_capture(void** out) {
+    void* frames[HZ3_S301_HEAP_PROFILE_DEPTH + 8];
+    int n = backtrace(frames, (int)(sizeof(frames) / sizeof(frames[0])));
+    int skip = 0;
+    if (g_hz3_s301_self_base) {
+        while (skip < n) {
+            Dl_info info;
+            if (!dladdr(frames[skip], &info) ||
+                (uintptr_t)info.dli_fbase != g_hz3_s301_self_base) {
+                break;
+            }
+            skip++;
+        }
+    }
+    uint32_t depth = 0;
+    for (int i = skip; i < n && depth < HZ3_S301_HEAP_PROFILE_DEPTH; i++) {
+        out[depth++] = frames[i];
+    }
+    return depth;
+}
+
+// ============================================================================
+// Sample pool
+// ============================================================================
+
+static Hz3S301Sample* hz3_s301_pool_get(void) {
+    Hz3S301Sample* s = NULL;
+    hz3_lock_acquire(&g_hz3_s301_lock);
+    if (g_hz3_s301_free_head >= 0) {
+        s = &g_hz3_s301_pool[g_hz3_s301_free_head];
+        g_hz3_s301_free_head = s->next_free;
+    } else if (g_hz3_s301_pool_used < HZ3_S301_HEAP_PROFILE_MAX_SAMPLES) {
+        s = &g_hz3_s301_pool[g_hz3_s301_pool_used++];
+    } else {
+        g_hz3_s301_dropped++;
+    }
+    hz3_lock_release(&g_hz3_s301_lock);
+    return s;
+}
+
+static void hz3_s301_pool_put_locked(Hz3S301Sample* s) {
+    s->live = 0;
+    s->ptr = NULL;
+    s->next_free = g_hz3_s301_free_head;
+    g_hz3_s301_free_head = (int32_t)(s - g_hz3_s301_pool);
+}
+
+static void* hz3_s301_record(size_t obj_size, size_t weight) {
+    Hz3S301Sample* s = hz3_s301_pool_get();
+    if (!s) {
+        return NULL;
+    }
+    s->depth = hz3_s301_capture(s->stack);
+    s->obj_size = obj_size;
+    s->weight = weight;
+    // Medium runs are page aligned and shims rely on it (HZ3_PAGE_MEDIUM_ALIGNED
+    // serves alignment <= page with plain hz3_malloc()), so a sample standing in
+    // for a medium object keeps that alignment.
+    void* p = (obj_size >= HZ3_SC_MIN_SIZE && obj_size <= HZ3_SC_MAX_SIZE)
+                  ? hz3_large_aligned_alloc(HZ3_PAGE_SIZE, obj_size)
+                  : hz3_large_alloc(obj_size);
+    if (!p || !hz3_large_s301_attach(p, s)) {
+        if (p) {
+            hz3_large_free(p);
+        }
+        hz3_lock_acquire(&g_hz3_s301_lock);
+        hz3_s301_pool_put_locked(s);
+        hz3_lock_release(&g_hz3_s301_lock);
+        return NULL;
+    }
+    hz3_lock_acquire(&g_hz3_s301_lock);
+    s->ptr = p;
+    s->live = 1;
+    hz3_lock_release(&g_hz3_s301_lock);
+    return p;
+}
+
+void hz3_s301_heap_profile_on_free(void* sample) {
+    Hz3S301Sample* s = (Hz3S301Sample*)sample;
+    hz3_lock_acquire(&g_hz3_s301_lock);
+    hz3_s301_pool_put_locked(s);
+    hz3_lock_release(&g_hz3_s301_lock);
+}
+
+// ============================================================================
+// Dump (pprof heap_v2 text; pre-scaled estimates, so sampling rate is 1)
+// ============================================================================
+
+typedef struct {
+    int    fd;
+    size_t len;
+    int    err;
+    char   buf[4096];
+} Hz3S301Out;
+
+static void hz3_s301_out_flush(Hz3S301Out* o) {
+    size_t off = 0;
+    while (off < o->len && !o->err) {
+        ssize_t w = write(o->fd, o->buf + off, o->len - off);
+        if (w <= 0) {
+            o->err = 1;
+            break;
+        }
+        off += (size_t)w;
+    }
+    o->len = 0;
+}
+
+static void hz3_s301_out_put(Hz3S301Out* o, const char* s, size_t n) {
+    while (n > 0) {
+        size_t room = sizeof(o->buf) - o->len;
+        size_t k = n < room ? n : room;
+        memcpy(o->buf + o->len, s, k);
+        o->len += k;
+        s += k;
+        n -= k;
+        if (o->len == sizeof(o->buf)) {
+            hz3_s301_out_flush(o);
+        }
+    }
+}
+
+static void hz3_s301_out_fmt_line(Hz3S301Out* o, const char* fmt,
+                                  unsigned long long a, unsigned long long b) {
+    char line[96];
+    int n = snprintf(line, sizeof(line), fmt, a, b);
+    if (n > 0) {
+        hz3_s301_out_put(o, line, (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1);
+    }
+}
+
+static void hz3_s301_out_maps(Hz3S301Out* o) {
+    hz3_s301_out_put(o, "\nMAPPED_LIBRARIES:\n", 19);
+#if defined(__linux__)
+    int fd = open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    char chunk[1024];
+    for (;;) {
+        ssize_t r = read(fd, chunk, sizeof(chunk));
+        if (r <= 0) {
+            break;
+        }
+        hz3_s301_out_put(o, chunk, (size_t)r);
+    }
+    close(fd);
+#endif
+}
+
+static int hz3_s301_dump_to(const char* path) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    static Hz3S301Out out;  // guarded by g_hz3_s301_lock
+    hz3_lock_acquire(&g_hz3_s301_lock);
+    out.fd = fd;
+    out.len = 0;
+    out.err = 0;
+
+    unsigned long long total_count = 0;
+    unsigned long long total_bytes = 0;
+    for (uint32_t i = 0; i < g_hz3_s301_pool_used; i++) {
+        const Hz3S301Sample* s = &g_hz3_s301_pool[i];
+        if (s->live) {
+            size_t count = s->obj_size ? s->weight / s->obj_size : 1;
+            total_count += count ? count : 1;
+            total_bytes += s->weight;
+        }
+    }
+    hz3_s301_out_fmt_line(&out, "heap profile: %llu: %llu [", total_count, total_bytes);
+    hz3_s301_out_fmt_line(&out, "%llu: %llu] @ heap_v2/1\n", total_count, total_bytes);
+
+    for (uint32_t i = 0; i < g_hz3_s301_pool_used; i++) {
+        const Hz3S301Sample* s = &g_hz3_s301_pool[i];
+        if (!s->live) {
+            continue;
+        }
+        size_t count = s->obj_size ? s->weight / s->obj_size : 1;
+        hz3_s301_out_fmt_line(&out, "%llu: %llu [0: 0] @",
+                              (unsigned long long)(count ? count : 1),
+                              (unsigned long long)s->weight);
+        for (uint32_t d = 0; d < s->depth; d++) {
+            char frame[24];
+            int n = snprintf(frame, sizeof(frame), " 0x%llx",
+                             (unsigned long long)(uintptr_t)s->stack[d]);
+            if (n > 0) {
+                hz3_s301_out_put(&out, frame, (size_t)n);
+            }
+        }
+        hz3_s301_out_put(&out, "\n", 1);
+    }
+    hz3_s301_out_maps(&out);
+    hz3_s301_out_flush(&out);
+    int err = out.err;
+    hz3_lock_release(&g_hz3_s301_lock);
+    if (close(fd) != 0) {
+        err = 1;
+    }
+    return err ? -1 : 0;
+}
+
+int hz3_heap_profile_dump(const char* path) {
+    if (!path) {
+        return -1;
+    }
+    int was_busy = t_hz3_s301_busy;
+    t_hz3_s301_busy = 1;
+    int rc = hz3_s301_dump_to(path);
+    t_hz3_s301_busy = was_busy;
+    return rc;
+}
+
+static void hz3_s301_dump_signal_pending(void) {
+    char path[256];
+    uint32_t seq = atomic_fetch_add_explicit(&g_hz3_s301_dump_seq, 1u, memory_order_relaxed);
+    snprintf(path, sizeof(path), "%s.%ld.%04u.heap", HZ3_S301_HEAP_PROFILE_PREFIX,
+             (long)getpid(), (unsigned)seq);
+    if (hz3_s301_dump_to(path) != 0) {
+        static const char msg[] = "[HZ3_S301] heap profile dump failed\n";
+        ssize_t w = write(STDERR_FILENO, msg, sizeof(msg) - 1);
+        (void)w;
+    }
+}
+
+// ============================================================================
+// Slow-path entry points
+// ============================================================================
+
+void* hz3_s301_heap_profile_sample_slow(size_t charge, size_t obj_size) {
+    if (t_hz3_s301_busy) {
+        // Re-entered from backtrace()/dladdr()/dump; keep the countdown
+        // non-positive so the next outer refill takes the sample.
+        return NULL;
+    }
+    t_hz3_s301_busy = 1;
+
+    if (atomic_load_explicit(&g_hz3_s301_dump_pending, memory_order_relaxed) &&
+        atomic_exchange_explicit(&g_hz3_s301_dump_pending, 0, memory_order_acq_rel)) {
+        hz3_s301_dump_signal_pending();
+    }
+
+    void* out = NULL;
+    if (!t_hz3_s301_armed) {
+        // First refill of this thread: seed and draw the first gap.
+        t_hz3_s301_armed = 1;
+        t_hz3_s301_rng = ((uint64_t)(uintptr_t)&t_hz3_s301_rng * 0x9E3779B97F4A7C15ull) ^
+                         (uint64_t)time(NULL) ^ 1u;
+        t_hz3_s301_bytes_left = hz3_s301_next_interval() - (int64_t)charge;
+    }
+    if (t_hz3_s301_bytes_left <= 0) {
+        t_hz3_s301_bytes_left = hz3_s301_next_interval();
+        out = hz3_s301_record(obj_size, hz3_s301_weight(charge, obj_size));
+    }
+
+    t_hz3_s301_busy = 0;
+    return out;
+}
+
+void* hz3_s301_heap_profile_large_alloc(size_t size) {
+    void* p = hz3_s301_heap_profile_on_refill(size, size);
+    return p ? p : hz3_large_alloc(size);
+}
+
+// ============================================================================
+// Init (constructor): self-base for frame trimming, signal hook, warm-up
+// ============================================================================
+
+#if HZ3_S301_HEAP_PROFILE_SIGNAL != 0
+static void hz3_s301_on_signal(int sig) {
+    (void)sig;
+    // Async-signal context: only raise the flag; the next slow path dumps.
+    atomic_store_explicit(&g_hz3_s301_dump_pending, 1, memory_order_relaxed);
+}
+#endif
+
+__attribute__((constructor))
+static void hz3_s301_heap_profile_init(void) {
+    t_hz3_s301_busy = 1;
+
+    Dl_info self;
+    if (dladdr((void*)&hz3_s301_heap_profile_init, &self) && self.dli_fbase) {
+        uintptr_t exe_base = 0;
+        dl_iterate_phdr(hz3_s301_find_exe_base, &exe_base);
+        if ((uintptr_t)self.dli_fbase != exe_base) {
+            g_hz3_s301_self_base = (uintptr_t)self.dli_fbase;
+        }
+    }
+
+    // backtrace() lazily dlopens the unwinder (which mallocs); pay that here.
+    void* warm[2];
+    (void)backtrace(warm, 2);
+
+#if HZ3_S301_HEAP_PROFILE_SIGNAL != 0
+    int sig = (HZ3_S301_HEAP_PROFILE_SIGNAL < 0) ? SIGUSR2 : HZ3_S301_HEAP_PROFILE_SIGNAL;
+    struct sigaction old;
+    if (sigaction(sig, NULL, &old) == 0 && !(old.sa_flags & SA_SIGINFO) &&
+        old.sa_handler == SIG_DFL) {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = hz3_s301_on_signal;
+        sa.sa_flags = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(sig, &sa, NULL);
+    }
+#endif
+
+    t_hz3_s301_busy = 0;
+}
+
+#endif  // HZ3_S301_HEAP_PROFILE
@@ -0,0 +1,299 @@
+#define _GNU_SOURCE
+
+#include "hz3_s303_thp_seg.h"
+
+#if HZ3_S303_THP_SEG
+
+#include "hz3_types.h"
+#include "hz3_arena.h"
+#include "hz3_seg_hdr.h"
+#include "hz3_segmap.h"
+#include "hz3_dtor_stats.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+
+// Linux 6.1+; older headers lack the constant (the kernel returns EINVAL).
+#ifndef MADV_COLLAPSE
+#define MADV_COLLAPSE 25
+#endif
+
+// ============================================================================
+// S303: ThpSegBox - dense units on huge pages, sparse ones off them
+// ============================================================================
+//
+// Unit state (g_s303_unit_state[unit], scanner-owned, carve resets to 0):
+//   bits 0-1: FRESH / SPARSE / DENSE / COLLAPSED
+//   bits 8-15: consecutive dense scans (saturating)
+//
+// Transitions (hysteresis between SPARSE_PCT and DENSE_PCT keeps the state):
+//   used >= DENSE_PCT   : FRESH/SPARSE -> DENSE     (MADV_HUGEPAGE)
+//   DENSE x HOT_PASSES  : DENSE -> COLLAPSED        (MADV_COLLAPSE, once)
+//   used <= SPARSE_PCT  : DENSE/COLLAPSED -> SPARSE (MADV_NOHUGEPAGE)
+// A unit with a free slot counts as sparse: khugepaged must not refill a
+// range that hz3_arena_free() just released.
+//
+// used = min(accounted used pages, resident pages). The accounting alone only
+// moves when pages go back to the segment (S62/S64 retire, S65 release mode);
+// in the scale lane small pages never do and S65 medium reclaim purges runs in
+// place, so a purged unit would stay DENSE forever. mincore() sees every
+// DONTNEED (S65 purge_only, ledger, S62/S64 purge) without a hot-path counter.
+//
+// The scanner reads free_pages without the owner's cooperation; a stale count
+// only delays a transition by one scan. State is published with CAS so a carve
+// that raced the scan wins (FRESH) and the next scan re-advises the unit.
+
+#define HZ3_S303_ST_FRESH     0u
+#define HZ3_S303_ST_SPARSE    1u
+#define HZ3_S303_ST_DENSE     2u
+#define HZ3_S303_ST_COLLAPSED 3u
+#define HZ3_S303_ST_MASK      3u
+#define HZ3_S303_STREAK_SHIFT 8
+
+#define HZ3_S303_UNIT_PAGES   ((uint32_t)HZ3_PAGES_PER_SEG * HZ3_S303_SLOTS_PER_UNIT)
+#define HZ3_S303_DENSE_PAGES  (HZ3_S303_UNIT_PAGES * HZ3_S303_THP_DENSE_PCT / 100u)
+#define HZ3_S303_SPARSE_PAGES (HZ3_S303_UNIT_PAGES * HZ3_S303_THP_SPARSE_PCT / 100u)
+
+#if HZ3_S302_ARENA_GROW
+#define HZ3_S303_ARENAS ((size_t)HZ3_S302_ARENA_MAX)
+#else
+#define HZ3_S303_ARENAS ((size_t)1)
+#endif
+#define HZ3_S303_MAX_UNITS (HZ3_S303_ARENAS * (size_t)(HZ3_ARENA_SIZE / HZ3_S303_UNIT_SIZE))
+
+_Static_assert((HZ3_ARENA_SIZE % HZ3_S303_UNIT_SIZE) == 0,
+               "S303 requires HZ3_ARENA_SIZE to be a multiple of the THP unit");
+
+// Untouched entries stay zero pages (.bss), so the table costs no RSS until used.
+static _Atomic(uint16_t) g_s303_unit_state[HZ3_S303_MAX_UNITS];
+
+// One past the highest unit ever carved: scans stay inside the touched
+// prefix instead of walking the whole reservation.
+static _Atomic(uint32_t) g_s303_unit_hwm = 0;
+
+static _Atomic(uint32_t) g_s303_tick = 0;
+static _Atomic(int) g_s303_busy = 0;
+static uint32_t g_s303_cursor = 0;            // guarded by g_s303_busy
+static _Atomic(int) g_s303_collapse_off = 0;  // kernel without MADV_COLLAPSE
+static unsigned char g_s303_mincore_vec[HZ3_S303_UNIT_PAGES];  // guarded by g_s303_busy
+
+#if HZ3_S303_THP_STATS
+HZ3_DTOR_STAT(g_s303_scans);
+HZ3_DTOR_STAT(g_s303_units);
+HZ3_DTOR_STAT(g_s303_carve_nohuge);
+HZ3_DTOR_STAT(g_s303_huge);
+HZ3_DTOR_STAT(g_s303_nohuge);
+HZ3_DTOR_STAT(g_s303_collapse_ok);
+HZ3_DTOR_STAT(g_s303_collapse_fail);
+HZ3_DTOR_STAT(g_s303_madvise_fail);
+HZ3_DTOR_ATEXIT_FLAG(g_s303);
+
+static void hz3_s303_atexit_dump(void) {
+    fprintf(stderr, "[HZ3_S303_THP] scans=%u units=%u carve_nohuge=%u huge=%u nohuge=%u "
+                    "collapse_ok=%u collapse_fail=%u madvise_fail=%u\n",
+            HZ3_DTOR_STAT_LOAD(g_s303_scans), HZ3_DTOR_STAT_LOAD(g_s303_units),
+            HZ3_DTOR_STAT_LOAD(g_s303_carve_nohuge), HZ3_DTOR_STAT_LOAD(g_s303_huge),
+            HZ3_DTOR_STAT_LOAD(g_s303_nohuge), HZ3_DTOR_STAT_LOAD(g_s303_collapse_ok),
+            HZ3_DTOR_STAT_LOAD(g_s303_collapse_fail), HZ3_DTOR_STAT_LOAD(g_s303_madvise_fail));
+}
+#define HZ3_S303_STAT_INC(name) HZ3_DTOR_STAT_INC(name)
+#else
+#define HZ3_S303_STAT_INC(name) ((void)0)
+#endif
+
+// Used pages of one slot from the allocator's own accounting.
+// Returns 0 if the slot is not a classifiable segment.
+static int hz3_s303_slot_used_pages(uint32_t idx, uint32_t* used_out) {
+    void* seg_base = hz3_arena_slot_base(idx);
+    if (!seg_base) {
+        return 0;
+    }
+    uint32_t free_pages;
+    Hz3SegMeta* meta = hz3_segmap_get(seg_base);
+    if (meta && meta->seg_base == seg_base) {
+        free_pages = meta->free_pages;  // medium: Hz3SegHdr.free_pages is not maintained
+    } else {
+        Hz3SegHdr* hdr = (Hz3SegHdr*)seg_base;
+        if (hdr->magic != HZ3_SEG_HDR_MAGIC || hdr->kind != HZ3_SEG_KIND_SMALL) {
+            return 0;
+        }
+        free_pages = hdr->free_pages;
+    }
+    if (free_pages > HZ3_PAGES_PER_SEG) {
+        return 0;  // torn read
+    }
+    *used_out = (uint32_t)HZ3_PAGES_PER_SEG - free_pages;
+    return 1;
+}
+
+// Sum used pages over the unit's slots. Returns 0 if any used slot could not
+// be classified; *all_used_out = 0 if some slot of the unit is free.
+static int hz3_s303_unit_used_pages(uint32_t unit, uint32_t* used_out, int* all_used_out) {
+    uint32_t first = unit * HZ3_S303_SLOTS_PER_UNIT;
+    uint32_t used = 0;
+    int all_used = 1;
+    for (uint32_t k = 0; k < HZ3_S303_SLOTS_PER_UNIT; k++) {
+        if (!hz3_arena_slot_used(first + k)) {
+            all_used = 0;
+            continue;
+        }
+        uint32_t slot_used;
+        if (!hz3_s303_slot_used_pages(first + k, &slot_used)) {
+            return 0;
+        }
+        used += slot_used;
+    }
+    *used_out = used;
+    *all_used_out = all_used;
+    return 1;
+}
+
+// Resident 4KB pages of the unit. Returns 0 if mincore() failed.
+static int hz3_s303_unit_resident_pages(void* unit_base, uint32_t* resident_out) {
+    if (mincore(unit_base, HZ3_S303_UNIT_SIZE, g_s303_mincore_vec) != 0) {
+        return 0;
+    }
+    uint32_t resident = 0;
+    for (uint32_t i = 0; i < HZ3_S303_UNIT_PAGES; i++) {
+        resident += g_s303_mincore_vec[i] & 1u;
+    }
+    *resident_out = resident;
+    return 1;
+}
+
+static int hz3_s303_unit_all_used(uint32_t unit) {
+    uint32_t first = unit * HZ3_S303_SLOTS_PER_UNIT;
+    for (uint32_t k = 0; k < HZ3_S303_SLOTS_PER_UNIT; k++) {
+        if (!hz3_arena_slot_used(first + k)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void hz3_s303_try_collapse(void* unit_base) {
+    if (atomic_load_explicit(&g_s303_collapse_off, memory_order_relaxed)) {
+        return;
+    }
+    if (madvise(unit_base, HZ3_S303_UNIT_SIZE, MADV_COLLAPSE) == 0) {
+        HZ3_S303_STAT_INC(g_s303_collapse_ok);
+        return;
+    }
+    if (errno == EINVAL) {
+        // Pre-6.1 kernel: khugepaged still collapses MADV_HUGEPAGE ranges.
+        atomic_store_explicit(&g_s303_collapse_off, 1, memory_order_relaxed);
+    }
+    HZ3_S303_STAT_INC(g_s303_collapse_fail);
+}
+
+static void hz3_s303_visit(uint32_t unit) {
+    uint32_t used;
+    int all_used;
+    if (!hz3_s303_unit_used_pages(unit, &used, &all_used)) {
+        return;
+    }
+    void* unit_base = hz3_arena_slot_base(unit * HZ3_S303_SLOTS_PER_UNIT);
+    if (!unit_base) {
+        return;
+    }
+    HZ3_S303_STAT_INC(g_s303_units);
+
+    uint32_t resident;
+    if (hz3_s303_unit_resident_pages(unit_base, &resident) && resident < used) {
+        used = resident;  // purged in place: the accounting still counts it
+    }
+
+    uint16_t cur = atomic_load_explicit(&g_s303_unit_state[unit], memory_order_relaxed);
+    uint32_t st = cur & HZ3_S303_ST_MASK;
+    uint32_t streak = (uint32_t)cur >> HZ3_S303_STREAK_SHIFT;
+
+    if (all_used && used >= HZ3_S303_DENSE_PAGES) {
+        if (st == HZ3_S303_ST_FRESH || st == HZ3_S303_ST_SPARSE) {
+            if (madvise(unit_base, HZ3_S303_UNIT_SIZE, MADV_HUGEPAGE) != 0) {
+                HZ3_S303_STAT_INC(g_s303_madvise_fail);
+                return;
+            }
+            HZ3_S303_STAT_INC(g_s303_huge);
+            st = HZ3_S303_ST_DENSE;
+            streak = 0;
+        }
+        if (streak < 255u) {
+            streak++;
+        }
+        if (st == HZ3_S303_ST_DENSE && HZ3_S303_THP_HOT_PASSES > 0 &&
+            streak >= (uint32_t)HZ3_S303_THP_HOT_PASSES &&
+            hz3_s303_unit_all_used(unit)) {
+            hz3_s303_try_collapse(unit_base);
+            st = HZ3_S303_ST_COLLAPSED;  // one attempt per dense period
+        }
+    } else if (!all_used || used <= HZ3_S303_SPARSE_PAGES) {
+        if (st == HZ3_S303_ST_FRESH || st == HZ3_S303_ST_SPARSE) {
+            return;  // carve advice already applies
+        }
+        if (madvise(unit_base, HZ3_S303_UNIT_SIZE, MADV_NOHUGEPAGE) != 0) {
+            HZ3_S303_STAT_INC(g_s303_madvise_fail);
+            return;
+        }
+        HZ3_S303_STAT_INC(g_s303_nohuge);
+        st = HZ3_S303_ST_SPARSE;
+        streak = 0;
+    } else {
+        streak = 0;  // hot means dense on consecutive scans
+    }
+
+    uint16_t next = (uint16_t)((streak << HZ3_S303_STREAK_SHIFT) | st);
+    if (next != cur) {
+        atomic_compare_exchange_strong_explicit(&g_s303_unit_state[unit], &cur, next,
+                                                memory_order_relaxed, memory_order_relaxed);
+    }
+}
+
+void hz3_s303_thp_tick(void) {
+    uint32_t tick = atomic_fetch_add_explicit(&g_s303_tick, 1, memory_order_relaxed);
+    if ((tick & (HZ3_S303_THP_TICK_EPOCHS - 1)) != 0) {
+        return;
+    }
+    if (!hz3_arena_get_base()) {
+        return;
+    }
+    if (atomic_exchange_explicit(&g_s303_busy, 1, memory_order_acquire) != 0) {
+        return;  // another thread is scanning
+    }
+#if HZ3_S303_THP_STATS
+    HZ3_DTOR_ATEXIT_REGISTER_ONCE(g_s303, hz3_s303_atexit_dump);
+    HZ3_S303_STAT_INC(g_s303_scans);
+#endif
+
+    uint32_t units = atomic_load_explicit(&g_s303_unit_hwm, memory_order_acquire);
+    uint32_t cursor = (g_s303_cursor < units) ? g_s303_cursor : 0;
+    uint32_t budget = (units < (uint32_t)HZ3_S303_THP_SCAN_BUDGET)
+                          ? units : (uint32_t)HZ3_S303_THP_SCAN_BUDGET;
+    for (uint32_t n = 0; n < budget; n++) {
+        hz3_s303_visit(cursor);
+        if (++cursor >= units) {
+            cursor = 0;
+        }
+    }
+    g_s303_cursor = cursor;
+
+    atomic_store_explicit(&g_s303_busy, 0, memory_order_release);
+}
+
+void hz3_s303_thp_on_carve(void* seg_base, uint32_t idx) {
+    uint32_t unit = idx / HZ3_S303_SLOTS_PER_UNIT;
+    atomic_store_explicit(&g_s303_unit_state[unit], 0, memory_order_relaxed);
+    // Carves are serialized by g_hz3_arena_lock; the scanner only reads.
+    if (unit >= atomic_load_explicit(&g_s303_unit_hwm, memory_order_relaxed)) {
+        atomic_store_explicit(&g_s303_unit_hwm, unit + 1, memory_order_release);
+    }
+#if HZ3_S303_THP_CARVE_NOHUGE
+    // MAP_FIXED carve resets VMA advice; start every segment on base pages.
+    if (madvise(seg_base, HZ3_SEG_SIZE, MADV_NOHUGEPAGE) == 0) {
+        HZ3_S303_STAT_INC(g_s303_carve_nohuge);
+    }
+#else
+    (void)seg_base;
+#endif
+}
+
+#endif  // HZ3_S303_THP_SEG
@@ -0,0 +1,268 @@
+#define _GNU_SOURCE
+
+#include "hz3_s306_knob_ctl.h"
+
+#if HZ3_S306_KNOB_CTL
+
+#include "hz3_sc.h"
+#include "hz3_dtor_stats.h"
+
+// ============================================================================
+// S306: KnobCtlBox - every medium class, every epoch
+// ============================================================================
+//
+// Per tick and sc (misses = refills since the last tick):
+//   burst  = EWMA(misses * refill_batch)            objects supplied per epoch
+//   batch  = ceil(burst / TARGET_REFILLS)           clamp [REFILL_MIN, REFILL_MAX]
+//   target += batch        if misses >= MISS_HI     (additive increase)
+//   target /= 2            after IDLE_EPOCHS ticks with misses == 0
+//   target >= batch                                 (trim must not undo a refill)
+// then sum(target * size) > CACHE_BUDGET_KB halves the largest holder until it
+// fits. Epochs are counted in slow-path events, so a class that stays idle
+// while the thread keeps ticking is losing demand to other classes.
+
+#define HZ3_S306_KNOB_TARGET 0u
+#define HZ3_S306_KNOB_BATCH  1u
+
+#define HZ3_S306_WHY_MISS   0u
+#define HZ3_S306_WHY_IDLE   1u
+#define HZ3_S306_WHY_BURST  2u
+#define HZ3_S306_WHY_BUDGET 3u
+
+// burst is kept in 1/16 objects; the EWMA weight is 1/4.
+#define HZ3_S306_BURST_SHIFT 4u
+#define HZ3_S306_SUPPLY_CAP  (1u << 20)
+
+_Static_assert(HZ3_NUM_SC <= 32, "S306 busy mask is 32-bit");
+
+#if HZ3_S306_STATS
+HZ3_DTOR_STAT(g_s306_ticks);
+HZ3_DTOR_STAT(g_s306_target_up);
+HZ3_DTOR_STAT(g_s306_target_down);
+HZ3_DTOR_STAT(g_s306_batch_up);
+HZ3_DTOR_STAT(g_s306_batch_down);
+HZ3_DTOR_STAT(g_s306_budget_cuts);
+HZ3_DTOR_ATEXIT_FLAG(g_s306);
+
+static void hz3_s306_atexit_dump(void) {
+    fprintf(stderr, "[HZ3_S306] ticks=%u target_up=%u target_down=%u batch_up=%u "
+                    "batch_down=%u budget_cuts=%u\n",
+            HZ3_DTOR_STAT_LOAD(g_s306_ticks), HZ3_DTOR_STAT_LOAD(g_s306_target_up),
+            HZ3_DTOR_STAT_LOAD(g_s306_target_down), HZ3_DTOR_STAT_LOAD(g_s306_batch_up),
+            HZ3_DTOR_STAT_LOAD(g_s306_batch_down), HZ3_DTOR_STAT_LOAD(g_s306_budget_cuts));
+}
+#define HZ3_S306_STAT_INC(name) HZ3_DTOR_STAT_INC(name)
+#else
+#define HZ3_S306_STAT_INC(name) ((void)0)
+#endif
+
+#if HZ3_S306_TRACE
+// Process-wide ring of knob changes. Writers claim a slot with fetch_add and
+// fill it without further ordering: the dump runs at exit and tolerates a
+// torn entry from a thread that is still ticking.
+typedef struct {
+    uint32_t tick;
+    uint8_t  shard;
+    uint8_t  sc;
+    uint8_t  knob;
+    uint8_t  why;
+    uint8_t  old_val;
+    uint8_t  new_val;
+    uint16_t misses;  // saturated
+} Hz3S306TraceEntry;
+
+static Hz3S306TraceEntry g_s306_trace[HZ3_S306_TRACE_RING];
+static _Atomic(uint32_t) g_s306_trace_seq = 0;
+HZ3_DTOR_ATEXIT_FLAG(g_s306_trace);
+
+static void hz3_s306_trace_dump(void) {
+    static const char* const knob_names[] = {"bin_target", "refill_batch"};
+    static const char* const why_names[] = {"miss", "idle", "burst", "budget"};
+    uint32_t seq = atomic_load_explicit(&g_s306_trace_seq, memory_order_acquire);
+    uint32_t n = (seq < HZ3_S306_TRACE_RING) ? seq : HZ3_S306_TRACE_RING;
+    fprintf(stderr, "[HZ3_S306_TRACE] changes=%u shown=%u\n", seq, n);
+    for (uint32_t i = seq - n; i != seq; i++) {
+        const Hz3S306TraceEntry* e = &g_s306_trace[i & (HZ3_S306_TRACE_RING - 1)];
+        fprintf(stderr, "[HZ3_S306_TRACE] tick=%u shard=%u sc=%u %s %u->%u why=%s misses=%u\n",
+                e->tick, e->shard, e->sc, knob_names[e->knob & 1u], e->old_val, e->new_val,
+                why_names[e->why & 3u], e->misses);
+    }
+}
+
+static void hz3_s306_trace(int sc, uint32_t knob, uint32_t why,
+                           uint32_t old_val, uint32_t new_val, uint32_t misses) {
+    HZ3_DTOR_ATEXIT_REGISTER_ONCE(g_s306_trace, hz3_s306_trace_dump);
+    uint32_t slot = atomic_fetch_add_explicit(&g_s306_trace_seq, 1, memory_order_relaxed);
+    Hz3S306TraceEntry* e = &g_s306_trace[slot & (HZ3_S306_TRACE_RING - 1)];
+    e->tick = t_hz3_cache.s306_ticks;
+    e->shard = t_hz3_cache.my_shard;
+    e->sc = (uint8_t)sc;
+    e->knob = (uint8_t)knob;
+    e->why = (uint8_t)why;
+    e->old_val = (uint8_t)old_val;
+    e->new_val = (uint8_t)new_val;
+    e->misses = (uint16_t)((misses > UINT16_MAX) ? UINT16_MAX : misses);
+}
+#else
+static inline void hz3_s306_trace(int sc, uint32_t knob, uint32_t why,
+                                  uint32_t old_val, uint32_t new_val, uint32_t misses) {
+    (void)sc;
+    (void)knob;
+    (void)why;
+    (void)old_val;
+    (void)new_val;
+    (void)misses;
+}
+#endif
+
+static uint32_t hz3_s306_batch_from_burst(uint32_t burst) {
+    uint32_t objs = burst >> HZ3_S306_BURST_SHIFT;
+    uint32_t batch = (objs + HZ3_S306_TARGET_REFILLS - 1u) / HZ3_S306_TARGET_REFILLS;
+    if (batch < HZ3_S306_REFILL_MIN) {
+        batch = HZ3_S306_REFILL_MIN;
+    }
+    if (batch > HZ3_S306_REFILL_MAX) {
+        batch = HZ3_S306_REFILL_MAX;
+    }
+    return batch;
+}
+
+// Halve the largest bin_target * size holders until the thread fits the budget.
+// Classes that refilled this tick (busy bit set) are cut only after the rest.
+static void hz3_s306_enforce_budget(uint32_t busy, const uint32_t* misses) {
+    const size_t budget = (size_t)HZ3_S306_CACHE_BUDGET_KB * 1024u;
+    Hz3Knobs* k = &t_hz3_cache.knobs;
+    size_t total = 0;
+    for (int sc = 0; sc < HZ3_NUM_SC; sc++) {
+        total += (size_t)k->bin_target[sc] * hz3_sc_to_size(sc);
+    }
+    while (total > budget) {
+        int victim = -1;
+        for (int pass = 0; pass < 2 && victim < 0; pass++) {
+            size_t victim_bytes = 0;
+            for (int sc = 0; sc < HZ3_NUM_SC; sc++) {
+                if (k->bin_target[sc] <= k->refill_batch[sc]) {
+                    continue;
+                }
+                if (pass == 0 && (busy & (1u << sc))) {
+                    continue;
+                }
+                size_t bytes = (size_t)k->bin_target[sc] * hz3_sc_to_size(sc);
+                if (bytes > victim_bytes) {
+                    victim = sc;
+                    victim_bytes = bytes;
+                }
+            }
+        }
+        if (victim < 0) {
+            break;  // every class is at its refill floor
+        }
+        uint32_t old_target = k->bin_target[victim];
+        uint32_t new_target = old_target / 2u;
+        if (new_target < k->refill_batch[victim]) {
+            new_target = k->refill_batch[victim];
+        }
+        k->bin_target[victim] = (uint8_t)new_target;
+        total -= (size_t)(old_target - new_target) * hz3_sc_to_size(victim);
+        HZ3_S306_STAT_INC(g_s306_budget_cuts);
+        hz3_s306_trace(victim, HZ3_S306_KNOB_TARGET, HZ3_S306_WHY_BUDGET,
+                       old_target, new_target, misses[victim]);
+    }
+}
+
+void hz3_s306_knob_ctl_tick(void) {
+    if (!t_hz3_cache.initialized) {
+        return;
+    }
+#if HZ3_S306_STATS
+    HZ3_DTOR_ATEXIT_REGISTER_ONCE(g_s306, hz3_s306_atexit_dump);
+#endif
+    HZ3_S306_STAT_INC(g_s306_ticks);
+
+    Hz3Knobs* k = &t_hz3_cache.knobs;
+    const int first = (t_hz3_cache.s306_ticks == 0);
+    t_hz3_cache.s306_ticks++;
+    uint32_t busy = 0;
+    uint32_t misses_sc[HZ3_NUM_SC];
+
+    for (int sc = 0; sc < HZ3_NUM_SC; sc++) {
+        uint32_t cur = t_hz3_cache.stats.refill_calls[sc];
+        uint32_t prev = t_hz3_cache.s306_prev_refills[sc];
+        // HZ3_STATS_DUMP zeroes the counters at thread exit.
+        uint32_t misses = (cur >= prev) ? (cur - prev) : cur;
+        t_hz3_cache.s306_prev_refills[sc] = cur;
+        misses_sc[sc] = misses;
+
+        uint32_t old_batch = k->refill_batch[sc];
+        uint32_t old_target = k->bin_target[sc];
+
+        // 1. Burst EWMA; the first tick seeds it so the default batch holds.
+        uint32_t burst = t_hz3_cache.s306_burst[sc];
+        if (first) {
+            burst = (old_batch * HZ3_S306_TARGET_REFILLS) << HZ3_S306_BURST_SHIFT;
+        }
+        uint32_t supplied = misses * old_batch;
+        if (misses > HZ3_S306_SUPPLY_CAP || supplied > HZ3_S306_SUPPLY_CAP) {
+            supplied = HZ3_S306_SUPPLY_CAP;
+        }
+        burst = burst - (burst >> 2) + ((supplied << HZ3_S306_BURST_SHIFT) >> 2);
+        t_hz3_cache.s306_burst[sc] = burst;
+
+        // No refills = no evidence about the burst: keep the batch, let the EWMA decay.
+        uint32_t new_batch = (misses != 0) ? hz3_s306_batch_from_burst(burst) : old_batch;
+
+        // 2. AIMD on bin_target.
+        uint32_t new_target = old_target;
+        uint32_t why = HZ3_S306_WHY_MISS;
+        if (misses == 0) {
+            if (t_hz3_cache.s306_idle[sc] < UINT8_MAX) {
+                t_hz3_cache.s306_idle[sc]++;
+            }
+            if (t_hz3_cache.s306_idle[sc] >= HZ3_S306_IDLE_EPOCHS) {
+                t_hz3_cache.s306_idle[sc] = 0;
+                new_target = old_target / 2u;
+                why = HZ3_S306_WHY_IDLE;
+            }
+        } else {
+            t_hz3_cache.s306_idle[sc] = 0;
+            busy |= 1u << sc;
+            if (misses >= HZ3_S306_MISS_HI) {
+                new_target = old_target + new_batch;
+                if (new_target > HZ3_S306_TARGET_MAX) {
+                    new_target = HZ3_S306_TARGET_MAX;
+                }
+            }
+        }
+        if (new_target < new_batch) {
+            new_target = new_batch;
+            if (new_target > old_target) {
+                why = HZ3_S306_WHY_BURST;
+            }
+        }
+
+        if (new_batch != old_batch) {
+            k->refill_batch[sc] = (uint8_t)new_batch;
+            if (new_batch > old_batch) {
+                HZ3_S306_STAT_INC(g_s306_batch_up);
+            } else {
+                HZ3_S306_STAT_INC(g_s306_batch_down);
+            }
+            hz3_s306_trace(sc, HZ3_S306_KNOB_BATCH, HZ3_S306_WHY_BURST,
+                           old_batch, new_batch, misses);
+        }
+        if (new_target != old_target) {
+            k->bin_target[sc] = (uint8_t)new_target;
+            if (new_target > old_target) {
+                HZ3_S306_STAT_INC(g_s306_target_up);
+            } else {
+                HZ3_S306_STAT_INC(g_s306_target_down);
+            }
+            hz3_s306_trace(sc, HZ3_S306_KNOB_TARGET, why, old_target, new_target, misses);
+        }
+    }
+
+    // 3. Budget over the whole medium cache of this thread.
+    hz3_s306_enforce_budget(busy, misses_sc);
+}
+
+#endif  // HZ3_S306_KNOB_CTL
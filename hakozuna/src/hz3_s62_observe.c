@@ -82,7 +82,7 @@ static void hz3_s62_snapshot_best_effort(void) {
         }
         scanned_segs++;
 
-        void* slot_base = (char*)arena_base + ((size_t)i << HZ3_SEG_SHIFT);
+        void* slot_base = hz3_arena_slot_base(i);
         Hz3SegHdr* hdr = (Hz3SegHdr*)slot_base;
 
         if (hdr->magic != HZ3_SEG_HDR_MAGIC) {
@@ -99,7 +99,7 @@ void hz3_s62_purge(void) {
         scanned_segs++;
 
         // Calculate slot base address
-        void* slot_base = (char*)arena_base + ((size_t)i << HZ3_SEG_SHIFT);
+        void* slot_base = hz3_arena_slot_base(i);
         Hz3SegHdr* hdr = (Hz3SegHdr*)slot_base;
 
         // Safety check: verify segment header
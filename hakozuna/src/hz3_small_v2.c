@@ -12,6 +12,7 @@
 #include "hz3_owner_stash.h"
 #include "hz3_s62_stale_check.h"
 #include "hz3_s85_small_v2_slow_stats.h"
+#include "hz3_s301_heap_profile.h"
 #include "hz3_sc.h"
 #include "hz3_seg_hdr.h"
 #include "hz3_segment.h"
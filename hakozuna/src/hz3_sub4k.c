@@ -9,6 +9,7 @@
 #include "hz3_segment.h"
 #include "hz3_tcache.h"
 #include "hz3_watch_ptr.h"
+#include "hz3_s301_heap_profile.h"
 
 #include <pthread.h>
 
@@ -289,10 +290,20 @@ void* hz3_sub4k_alloc(size_t size) {
         return obj;
     }
 
+#if HZ3_S301_HEAP_PROFILE
+    // S301: charge this refill to the sampling countdown (slow path only).
+    void* s301_sample = hz3_s301_heap_profile_on_refill(
+        (size_t)HZ3_SUB4K_REFILL_BATCH * hz3_sub4k_sc_to_size(sc), hz3_sub4k_sc_to_size(sc));
+    if (s301_sample) {
+        return s301_sample;
+    }
+#endif
+
     hz3_sub4k_central_init();
     void* batch[HZ3_SUB4K_REFILL_BATCH];
     int got = hz3_sub4k_central_pop_batch(t_hz3_cache.my_shard, sc, batch, HZ3_SUB4K_REFILL_BATCH);
     if (got > 0) {
+        hz3_s301_heap_profile_refill_short(HZ3_SUB4K_REFILL_BATCH, got, hz3_sub4k_sc_to_size(sc));
         for (int i = 1; i < got; i++) {
             hz3_binref_push(binref, batch[i]);
         }
@@ -306,6 +317,12 @@ void* hz3_sub4k_alloc(size_t size) {
     if (!run) {
         return NULL;
     }
+#if HZ3_S301_HEAP_PROFILE
+    // S301: a run carves (2 pages / size) objects, not REFILL_BATCH.
+    hz3_s301_heap_profile_adjust(
+        (int64_t)(((HZ3_PAGE_SIZE * 2u) / hz3_sub4k_sc_to_size(sc)) * hz3_sub4k_sc_to_size(sc)) -
+        (int64_t)HZ3_SUB4K_REFILL_BATCH * (int64_t)hz3_sub4k_sc_to_size(sc));
+#endif
 
     hz3_sub4k_fill_binref(binref, sc, run);
     obj = hz3_binref_pop(binref);
@@ -323,10 +340,20 @@ void* hz3_sub4k_alloc(size_t size) {
         return obj;
     }
 
+#if HZ3_S301_HEAP_PROFILE
+    // S301: charge this refill to the sampling countdown (slow path only).
+    void* s301_sample = hz3_s301_heap_profile_on_refill(
+        (size_t)HZ3_SUB4K_REFILL_BATCH * hz3_sub4k_sc_to_size(sc), hz3_sub4k_sc_to_size(sc));
+    if (s301_sample) {
+        return s301_sample;
+    }
+#endif
+
     hz3_sub4k_central_init();
     void* batch[HZ3_SUB4K_REFILL_BATCH];
     int got = hz3_sub4k_central_pop_batch(t_hz3_cache.my_shard, sc, batch, HZ3_SUB4K_REFILL_BATCH);
     if (got > 0) {
+        hz3_s301_heap_profile_refill_short(HZ3_SUB4K_REFILL_BATCH, got, hz3_sub4k_sc_to_size(sc));
         for (int i = 1; i < got; i++) {
             hz3_bin_push(bin, batch[i]);
         }
@@ -340,6 +367,12 @@ void* hz3_sub4k_alloc(size_t size) {
     if (!run) {
         return NULL;
     }
+#if HZ3_S301_HEAP_PROFILE
+    // S301: a run carves (2 pages / size) objects, not REFILL_BATCH.
+    hz3_s301_heap_profile_adjust(
+        (int64_t)(((HZ3_PAGE_SIZE * 2u) / hz3_sub4k_sc_to_size(sc)) * hz3_sub4k_sc_to_size(sc)) -
+        (int64_t)HZ3_SUB4K_REFILL_BATCH * (int64_t)hz3_sub4k_sc_to_size(sc));
+#endif
 
     hz3_sub4k_fill_bin(bin, sc, run);
     obj = hz3_bin_pop(bin);
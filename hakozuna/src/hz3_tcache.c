@@ -16,6 +16,7 @@
 #include "hz3_tag.h"
 #include "hz3_medium_debug.h"
 #include "hz3_watch_ptr.h"
+#include "hz3_s301_heap_profile.h"
 #include "hz3_owner_lease.h"
 #include "hz3_owner_stash.h"
 #include "hz3_large.h"
@@ -54,6 +55,9 @@
 #if HZ3_S65_MEDIUM_RECLAIM
 #include "hz3_s65_medium_reclaim.h"
 #endif
+#if HZ3_S306_KNOB_CTL
+#include "hz3_s306_knob_ctl.h"
+#endif
 
 #include <string.h>
 #include <stdio.h>
@@ -71,6 +75,7 @@
 #include "hz3_tcache_s203_alloc_stats.inc"
 #include "hz3_tcache_s204_larson_diag.inc"
 #include "hz3_tcache_state.inc"
+#include "hz3_tcache_s304_shards.inc"
 #include "hz3_tcache_s62_atexit.inc"
 #include "hz3_tcache_destructor.inc"
 #include "hz3_tcache_init.inc"
@@ -21,6 +21,10 @@
 #if HZ3_S55_RETENTION_FROZEN
 #include "hz3_retention_policy.h"
 #endif
+#if HZ3_S305_REALLOC_STATS
+#include "hz3_dtor_stats.h"
+#include <stdio.h>
+#endif
 
 static inline int hz3_tcache_collision_active(void) {
 #if HZ3_LANE_SPLIT
@@ -59,16 +63,14 @@ static inline void hz3_tcache_current_seg_set(Hz3SegMeta* meta, int collision_ac
 // Day 3: Slow path with segment reuse
 // ============================================================================
 
-static inline void* hz3_medium_run_commit_with_bin(Hz3SegMeta* meta,
-                                                   int sc,
-                                                   int start_page,
-                                                   size_t pages,
-                                                   uint32_t bin,
-                                                   uint16_t tag) {
-#if HZ3_S49_SEGMENT_PACKING
-    hz3_pack_on_alloc(t_hz3_cache.my_shard, meta);
-#endif
-
+// Write every per-page tag of a run (sc_tag, PTAG16, PTAG32, S113 bin_plus1).
+static inline void* hz3_medium_run_tag_with_bin(Hz3SegMeta* meta,
+                                                int sc,
+                                                int start_page,
+                                                size_t pages,
+                                                uint32_t bin,
+                                                uint16_t tag) {
+    (void)sc;  // PTAG16 dispatch only
 #if HZ3_S110_META_ENABLE
     const uint16_t bin_plus1 = (uint16_t)(bin + 1);
 #endif
@@ -110,7 +112,19 @@ static inline void* hz3_medium_run_commit_with_bin(Hz3SegMeta* meta,
         }
     }
 #endif
+    return run_base;
+}
 
+static inline void* hz3_medium_run_commit_with_bin(Hz3SegMeta* meta,
+                                                   int sc,
+                                                   int start_page,
+                                                   size_t pages,
+                                                   uint32_t bin,
+                                                   uint16_t tag) {
+#if HZ3_S49_SEGMENT_PACKING
+    hz3_pack_on_alloc(t_hz3_cache.my_shard, meta);
+#endif
+    void* run_base = hz3_medium_run_tag_with_bin(meta, sc, start_page, pages, bin, tag);
 #if HZ3_OOM_SHOT
     atomic_fetch_add_explicit(&g_medium_page_alloc_sc[sc], 1, memory_order_relaxed);
 #endif
@@ -356,6 +370,102 @@ void* hz3_slow_alloc_from_segment(int sc) {
     return result;
 }
 
+#if HZ3_S305_REALLOC_INPLACE
+// ============================================================================
+// S305: ReallocInPlaceBox - resize a live medium run within its segment
+// ============================================================================
+// Same locking as the refill path: free_bits/free_pages are my_shard-only, so
+// a run owned by another shard is never resized here (caller copies instead).
+
+#if HZ3_S305_REALLOC_STATS
+HZ3_DTOR_STAT(g_s305_grow_ok);
+HZ3_DTOR_STAT(g_s305_grow_blocked);
+HZ3_DTOR_STAT(g_s305_shrink);
+HZ3_DTOR_STAT(g_s305_remote);
+HZ3_DTOR_ATEXIT_FLAG(g_s305);
+
+static void hz3_s305_atexit_dump(void) {
+    fprintf(stderr, "[HZ3_S305_REALLOC] grow_ok=%u grow_blocked=%u shrink=%u remote=%u\n",
+            HZ3_DTOR_STAT_LOAD(g_s305_grow_ok), HZ3_DTOR_STAT_LOAD(g_s305_grow_blocked),
+            HZ3_DTOR_STAT_LOAD(g_s305_shrink), HZ3_DTOR_STAT_LOAD(g_s305_remote));
+}
+#define HZ3_S305_STAT_INC(name) HZ3_DTOR_STAT_INC(name)
+#else
+#define HZ3_S305_STAT_INC(name) ((void)0)
+#endif
+
+int hz3_medium_resize_inplace(void* ptr, int old_sc, int new_sc) {
+#if HZ3_S305_REALLOC_STATS
+    HZ3_DTOR_ATEXIT_REGISTER_ONCE(g_s305, hz3_s305_atexit_dump);
+#endif
+    hz3_tcache_ensure_init();
+    Hz3SegMeta* meta = hz3_segmap_get(ptr);
+    if (!meta || meta->owner != t_hz3_cache.my_shard) {
+        HZ3_S305_STAT_INC(g_s305_remote);
+        return 0;
+    }
+
+    const size_t old_pages = hz3_sc_to_pages(old_sc);
+    const size_t new_pages = hz3_sc_to_pages(new_sc);
+    const size_t start_page = ((uintptr_t)ptr - (uintptr_t)meta->seg_base) >> HZ3_PAGE_SHIFT;
+    if (((uintptr_t)ptr & (HZ3_PAGE_SIZE - 1)) != 0 ||
+        start_page + old_pages > HZ3_PAGES_PER_SEG) {
+        return 0;  // not a run start
+    }
+
+    // Steady-state heaps keep neighbour runs in bins, so most growth is
+    // blocked: reject on an unlocked read before taking the owner locks.
+    if (new_pages > old_pages &&
+        (start_page + new_pages > HZ3_PAGES_PER_SEG ||
+         !hz3_bitmap_range_free(meta->free_bits, start_page + old_pages,
+                                new_pages - old_pages))) {
+        HZ3_S305_STAT_INC(g_s305_grow_blocked);
+        return 0;
+    }
+
+    Hz3OwnerLeaseToken lease_token = hz3_owner_lease_acquire(t_hz3_cache.my_shard);
+    Hz3OwnerExclToken excl_token = hz3_owner_excl_acquire(t_hz3_cache.my_shard);
+    const uint32_t bin = (uint32_t)hz3_bin_index_medium(new_sc);
+    const uint16_t tag = hz3_tag_make_large(new_sc);
+    int ok = 0;
+
+    if (new_pages > old_pages) {
+        const size_t tail = start_page + old_pages;
+        const size_t extra = new_pages - old_pages;
+        if (tail + extra <= HZ3_PAGES_PER_SEG &&
+            meta->free_pages >= extra &&
+#if HZ3_S47_SEGMENT_QUARANTINE
+            !hz3_s47_is_draining(t_hz3_cache.my_shard, meta->seg_base) &&
+#endif
+            hz3_bitmap_range_free(meta->free_bits, tail, extra)) {
+            hz3_bitmap_mark_used(meta->free_bits, tail, extra);
+            meta->free_pages -= (uint16_t)extra;
+#if HZ3_S49_SEGMENT_PACKING
+            hz3_pack_on_alloc(t_hz3_cache.my_shard, meta);
+#endif
+            (void)hz3_medium_run_tag_with_bin(meta, new_sc, (int)start_page, new_pages, bin, tag);
+            HZ3_S305_STAT_INC(g_s305_grow_ok);
+            ok = 1;
+        } else {
+            HZ3_S305_STAT_INC(g_s305_grow_blocked);
+        }
+    } else {
+        // Retag the head first: hz3_segment_free_run() clears the tail's tags.
+        (void)hz3_medium_run_tag_with_bin(meta, new_sc, (int)start_page, new_pages, bin, tag);
+        hz3_segment_free_run(meta, start_page + new_pages, old_pages - new_pages);
+#if HZ3_S49_SEGMENT_PACKING
+        hz3_pack_on_free(t_hz3_cache.my_shard, meta);
+#endif
+        HZ3_S305_STAT_INC(g_s305_shrink);
+        ok = 1;
+    }
+
+    hz3_owner_excl_release(excl_token);
+    hz3_owner_lease_release(lease_token);
+    return ok;
+}
+#endif  // HZ3_S305_REALLOC_INPLACE
+
 #if HZ3_S300_OVERALIGNED_MEDIUM_RUNS
 static void* hz3_medium_aligned_alloc_from_segment_locked(int sc,
                                                           size_t alignment,
@@ -508,13 +508,14 @@ void hz3_retention_observe_event(void) {
     // NOTE: This is a best-effort snapshot; failures return 0 (do not fail-fast in OBSERVE).
 #if HZ3_SMALL_V2_PTAG_ENABLE
     if (g_hz3_page_tag) {
-        size_t bytes = (size_t)HZ3_ARENA_MAX_PAGES * sizeof(_Atomic(uint16_t));
+        // Committed slices only (S302: one per published arena).
+        size_t bytes = (size_t)hz3_arena_slots() * HZ3_PAGES_PER_SEG * sizeof(_Atomic(uint16_t));
         ptag16_resident_bytes = hz3_mincore_resident_bytes((const void*)g_hz3_page_tag, bytes);
     }
 #endif
 #if HZ3_PTAG_DSTBIN_ENABLE
     if (g_hz3_page_tag32) {
-        size_t bytes = (size_t)HZ3_ARENA_MAX_PAGES * sizeof(_Atomic(uint32_t));
+        size_t bytes = (size_t)hz3_arena_slots() * HZ3_PAGES_PER_SEG * sizeof(_Atomic(uint32_t));
         ptag32_resident_bytes = hz3_mincore_resident_bytes((const void*)g_hz3_page_tag32, bytes);
     }
 #endif
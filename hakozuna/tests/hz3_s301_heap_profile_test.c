@@ -0,0 +1,191 @@
+// hz3_s301_heap_profile_test.c - S301 live-heap estimate vs known live bytes
+// Run under LD_PRELOAD of a scale lib built with HZ3_S301_HEAP_PROFILE=1
+// (make -C hakozuna test_s301_heap_profile).
+//
+// Each phase keeps LIVE_BYTES of one size class (or a mix) live, dumps the
+// profile through hz3_heap_profile_dump() and compares the header byte total
+// with the sum of malloc_usable_size() (refills are charged in class-size
+// bytes). After the phase frees everything the estimate must fall back to
+// (almost) nothing. Sampling noise is ~1/sqrt(LIVE_BYTES / 512K) = 6%.
+// Medium sizes (4K..64K) must stay page aligned even when the slow path hands
+// out a sample from the large box.
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define LIVE_BYTES ((size_t)128 << 20)
+#define TOLERANCE_PCT 20
+#define MAX_OBJS (LIVE_BYTES / 48)
+#define PAGE 4096u
+#define MEDIUM_MAX (64u << 10)
+
+typedef int (*dump_fn)(const char*);
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+    do {                                       \
+        if (!(cond)) {                         \
+            fprintf(stderr, "FAIL: %s\n", msg); \
+            failures++;                        \
+        }                                      \
+    } while (0)
+
+static dump_fn g_dump;
+static void** g_objs;
+static char g_path[64];
+static size_t g_misaligned;
+
+// Header "heap profile: N: B [N: B] @ heap_v2/1" -> B, or -1.
+static long long dump_bytes(void) {
+    if (g_dump(g_path) != 0) {
+        return -1;
+    }
+    FILE* f = fopen(g_path, "r");
+    if (!f) {
+        return -1;
+    }
+    unsigned long long count = 0, bytes = 0;
+    int ok = fscanf(f, "heap profile: %llu: %llu", &count, &bytes) == 2;
+    fclose(f);
+    unlink(g_path);
+    return ok ? (long long)bytes : -1;
+}
+
+typedef struct {
+    size_t begin;
+    size_t end;
+} free_range_t;
+
+// Sampled objects sit at fixed offsets of a refill cycle, so the freed half is
+// picked by hash, not by parity.
+static int picked(size_t i) {
+    return (int)(((uint64_t)i * 0x9E3779B97F4A7C15ull) >> 63);
+}
+
+// Remote free of half the objects: they go back through stash / xfer /
+// central, so the owner's next refills come back short of their batch.
+static void* remote_free_half(void* arg) {
+    free_range_t* r = (free_range_t*)arg;
+    for (size_t i = r->begin; i < r->end; i++) {
+        if (picked(i)) {
+            free(g_objs[i]);
+            g_objs[i] = NULL;
+        }
+    }
+    return NULL;
+}
+
+static size_t fill(size_t n, size_t* live, size_t target, const size_t* sizes, int nsizes,
+                   const char* name) {
+    while (*live < target && n < MAX_OBJS) {
+        size_t size = sizes[n % (size_t)nsizes];
+        void* p = malloc(size);
+        if (!p) {
+            fprintf(stderr, "FAIL: %s alloc\n", name);
+            failures++;
+            break;
+        }
+        if (size >= PAGE && size <= MEDIUM_MAX && ((uintptr_t)p & (PAGE - 1u)) != 0) {
+            g_misaligned++;
+        }
+        memset(p, 0x5A, size);
+        *live += malloc_usable_size(p);
+        g_objs[n++] = p;
+    }
+    return n;
+}
+
+static void run_phase(const char* name, const size_t* sizes, int nsizes, int reuse) {
+    size_t live = 0;
+    size_t n = fill(0, &live, reuse ? LIVE_BYTES / 2 : LIVE_BYTES, sizes, nsizes, name);
+    if (reuse) {
+        free_range_t range = {0, n};
+        pthread_t th;
+        CHECK(pthread_create(&th, NULL, remote_free_half, &range) == 0, "pthread_create");
+        pthread_join(th, NULL);
+        live = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (g_objs[i]) {
+                live += malloc_usable_size(g_objs[i]);
+            }
+        }
+        n = fill(n, &live, LIVE_BYTES, sizes, nsizes, name);
+    }
+
+    long long est = dump_bytes();
+    long long err_pct = (est < 0) ? -1 : (est - (long long)live) * 100 / (long long)live;
+    printf("  %-8s live=%zu est=%lld err=%+lld%%\n", name, live, est, err_pct);
+    CHECK(est >= 0, "dump readable");
+    CHECK(err_pct >= -TOLERANCE_PCT && err_pct <= TOLERANCE_PCT, "estimate within tolerance");
+
+    for (size_t i = 0; i < n; i++) {
+        free(g_objs[i]);  // NULL for remote-freed slots
+    }
+    long long after = dump_bytes();
+    CHECK(after >= 0 && after < (long long)(live / 20), "estimate drops after free");
+}
+
+typedef struct {
+    const char* name;
+    const size_t* sizes;
+    int nsizes;
+    int reuse;
+} phase_t;
+
+// Fresh thread per phase: objects a phase frees into its own tcache would be
+// handed out again without a refill, and only refills are charged.
+static void* phase_thread(void* arg) {
+    const phase_t* ph = (const phase_t*)arg;
+    run_phase(ph->name, ph->sizes, ph->nsizes, ph->reuse);
+    return NULL;
+}
+
+int main(void) {
+    g_dump = (dump_fn)dlsym(RTLD_DEFAULT, "hz3_heap_profile_dump");
+    if (!g_dump) {
+        fprintf(stderr, "FAIL: hz3_heap_profile_dump not found (lib built with S301?)\n");
+        return 1;
+    }
+    snprintf(g_path, sizeof(g_path), "/tmp/hz3_s301_test.%ld.heap", (long)getpid());
+    // mmap, not malloc: the pointer array must not show up in the profile.
+    g_objs = (void**)mmap(NULL, MAX_OBJS * sizeof(void*), PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (g_objs == MAP_FAILED) {
+        fprintf(stderr, "FAIL: object array\n");
+        return 1;
+    }
+
+    static const size_t small[] = {64};
+    static const size_t small_odd[] = {1000};
+    static const size_t sub4k[] = {3000};
+    static const size_t medium[] = {20480};
+    static const size_t mixed[] = {48, 200, 1000, 3000, 9000, 20000, 60000};
+    const phase_t phases[] = {
+        {"64B", small, 1, 0},       {"1000B", small_odd, 1, 0}, {"3000B", sub4k, 1, 0},
+        {"20KB", medium, 1, 0},     {"mixed", mixed, 7, 0},     {"64B/r", small, 1, 1},
+        {"1000B/r", small_odd, 1, 1}, {"3000B/r", sub4k, 1, 1}, {"20KB/r", medium, 1, 1},
+        {"mixed/r", mixed, 7, 1},
+    };
+    for (size_t i = 0; i < sizeof(phases) / sizeof(phases[0]); i++) {
+        pthread_t th;
+        CHECK(pthread_create(&th, NULL, phase_thread, (void*)&phases[i]) == 0, "pthread_create");
+        pthread_join(th, NULL);
+    }
+
+    munmap(g_objs, MAX_OBJS * sizeof(void*));
+    CHECK(g_misaligned == 0, "medium objects page aligned");
+    if (failures) {
+        fprintf(stderr, "hz3_s301_heap_profile_test: %d FAILURES\n", failures);
+        return 1;
+    }
+    printf("hz3_s301_heap_profile_test ok\n");
+    return 0;
+}
@@ -0,0 +1,170 @@
+// hz3_s303_thp_sparse_test.c - S303 ThpSegBox dense -> sparse transition
+// Run under LD_PRELOAD of a scale lib built with HZ3_S303_THP_SEG=1,
+// HZ3_S134_EPOCH_ON_SMALL_SLOW=1 and HZ3_S303_THP_TICK_EPOCHS=1
+// (make -C hakozuna test_s303_thp_sparse).
+//
+// Fill medium units with 20KB objects until a unit is advised MADV_HUGEPAGE,
+// then free them all. S65 purge_only madvises the runs in place (Hz3SegMeta
+// free_pages does not move), so the unit can only go sparse if S303 sees the
+// purge; it must flip to MADV_NOHUGEPAGE. Advice is read from the VmFlags of
+// /proc/self/smaps ("hg" / "nh"). Epochs are driven by fresh small allocations.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OBJS 1600
+#define OBJ_SIZE 20480  // 5 pages: a purged run keeps only the link page resident
+#define UNIT_SIZE ((uintptr_t)2 << 20)
+#define EPOCH_ALLOCS (256 * 1024)  // ~1 small refill slow event per 256 objects
+#define MAX_EPOCHS 48
+
+static void* g_objs[OBJS];
+static void** g_keep;
+static size_t g_nkeep = 0;
+
+// 'h' = MADV_HUGEPAGE, 'n' = MADV_NOHUGEPAGE, '-' = neither, '?' = not found.
+static char vma_advice(const void* p) {
+    FILE* f = fopen("/proc/self/smaps", "r");
+    if (!f) {
+        return '?';
+    }
+    uintptr_t addr = (uintptr_t)p;
+    char line[512];
+    int in = 0;
+    char advice = '?';
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long lo, hi;
+        char sep;
+        if (sscanf(line, "%lx-%lx%c", &lo, &hi, &sep) == 3 && sep == ' ') {
+            in = (addr >= lo && addr < hi);
+            continue;
+        }
+        if (in && strncmp(line, "VmFlags:", 8) == 0) {
+            advice = strstr(line, " hg") ? 'h' : (strstr(line, " nh") ? 'n' : '-');
+            break;
+        }
+    }
+    fclose(f);
+    return advice;
+}
+
+static uintptr_t g_units[OBJS];
+static int g_nunits = 0;
+static uintptr_t g_dense[OBJS];
+static int g_ndense = 0;
+
+static void collect_units(void) {
+    for (int i = 0; i < OBJS; i++) {
+        uintptr_t unit = (uintptr_t)g_objs[i] & ~(UNIT_SIZE - 1);
+        int dup = 0;
+        for (int k = 0; k < g_nunits && !dup; k++) {
+            dup = (g_units[k] == unit);
+        }
+        if (!dup) {
+            g_units[g_nunits++] = unit;
+        }
+    }
+}
+
+// Units advised 'h' while full: remembered so the sparse check only counts them.
+static int collect_dense(void) {
+    g_ndense = 0;
+    for (int k = 0; k < g_nunits; k++) {
+        if (vma_advice((void*)g_units[k]) == 'h') {
+            g_dense[g_ndense++] = g_units[k];
+        }
+    }
+    return g_ndense;
+}
+
+static int count_dense_now(char advice) {
+    int count = 0;
+    for (int k = 0; k < g_ndense; k++) {
+        if (vma_advice((void*)g_dense[k]) == advice) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// One epoch worth of small-path refills (HZ3_EPOCH_INTERVAL slow events).
+static int tick_epoch(void) {
+    if (g_nkeep + EPOCH_ALLOCS > (size_t)MAX_EPOCHS * EPOCH_ALLOCS) {
+        return 0;
+    }
+    for (int i = 0; i < EPOCH_ALLOCS; i++) {
+        void* p = malloc(16);
+        if (!p) {
+            return 0;
+        }
+        *(volatile char*)p = 1;
+        g_keep[g_nkeep++] = p;
+    }
+    return 1;
+}
+
+static int thp_available(void) {
+    FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (!f) {
+        return 0;
+    }
+    char buf[128] = {0};
+    int ok = fgets(buf, sizeof(buf), f) != NULL && strstr(buf, "[never]") == NULL;
+    fclose(f);
+    return ok;
+}
+
+int main(void) {
+    if (!thp_available()) {
+        printf("hz3_s303_thp_sparse_test skipped (THP unavailable)\n");
+        return 0;
+    }
+    g_keep = (void**)malloc((size_t)MAX_EPOCHS * EPOCH_ALLOCS * sizeof(void*));
+    if (!g_keep) {
+        fprintf(stderr, "FAIL: keep array\n");
+        return 1;
+    }
+
+    for (int i = 0; i < OBJS; i++) {
+        g_objs[i] = malloc(OBJ_SIZE);
+        if (!g_objs[i]) {
+            fprintf(stderr, "FAIL: medium alloc\n");
+            return 1;
+        }
+        memset(g_objs[i], 0x5A, OBJ_SIZE);
+    }
+
+    collect_units();
+    int huge = 0;
+    int dense_epochs = 0;
+    while ((huge = collect_dense()) == 0 && tick_epoch()) {
+        dense_epochs++;
+    }
+    if (huge == 0) {
+        fprintf(stderr, "FAIL: no dense unit advised MADV_HUGEPAGE after %d epochs\n", dense_epochs);
+        return 1;
+    }
+
+    for (int i = 0; i < OBJS; i++) {
+        free(g_objs[i]);
+    }
+    int nohuge = 0;
+    int sparse_epochs = 0;
+    while ((nohuge = count_dense_now('n')) == 0 && tick_epoch()) {
+        sparse_epochs++;
+    }
+    if (nohuge == 0) {
+        fprintf(stderr, "FAIL: freed units stayed MADV_HUGEPAGE after %d epochs (huge=%d)\n",
+                sparse_epochs, count_dense_now('h'));
+        return 1;
+    }
+
+    for (size_t i = 0; i < g_nkeep; i++) {
+        free(g_keep[i]);
+    }
+    free(g_keep);
+    printf("hz3_s303_thp_sparse_test ok (huge=%d after %d epochs, nohuge=%d after %d epochs)\n",
+           huge, dense_epochs, nohuge, sparse_epochs);
+    return 0;
+}
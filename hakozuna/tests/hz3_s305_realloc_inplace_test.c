@@ -0,0 +1,160 @@
+// hz3_s305_realloc_inplace_test.c - S305 medium realloc grow / shrink in place
+// Run under LD_PRELOAD of a scale lib built with HZ3_S305_REALLOC_INPLACE=1
+// (make -C hakozuna test_s305_realloc_inplace).
+//
+// - shrink: a 64KB run shrunk to 4KB keeps its pointer and hands the tail
+//   pages back to the segment,
+// - grow in place: growing it back (first to 16KB, then 64KB) reclaims those
+//   free tail pages and keeps the pointer,
+// - blocked grow: a 4KB run whose next page is another live run must move
+//   (malloc + copy + free) and leave the neighbour untouched,
+// - remote: a run resized by a thread that does not own it is copied.
+// Every step checks that the old prefix survives; malloc_usable_size() shows
+// the run really changed class (without S305 a shrink keeps the 64KB run).
+#define _GNU_SOURCE
+#include <malloc.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PAGE 4096u
+#define MEDIUM_MAX (64u << 10)
+#define NEIGHBOURS 64
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+    do {                                       \
+        if (!(cond)) {                         \
+            fprintf(stderr, "FAIL: %s\n", msg); \
+            failures++;                        \
+        }                                      \
+    } while (0)
+
+static void fill(unsigned char* p, size_t n, unsigned seed) {
+    for (size_t i = 0; i < n; i++) {
+        p[i] = (unsigned char)(seed + i * 7u);
+    }
+}
+
+static int intact(const unsigned char* p, size_t n, unsigned seed) {
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] != (unsigned char)(seed + i * 7u)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void test_shrink_then_grow(void) {
+    unsigned char* p = malloc(MEDIUM_MAX);
+    CHECK(p != NULL, "64KB alloc");
+    if (!p) {
+        return;
+    }
+    fill(p, MEDIUM_MAX, 1);
+
+    unsigned char* q = realloc(p, PAGE);
+    CHECK(q == p, "shrink 64KB -> 4KB stays in place");
+    CHECK(q && intact(q, PAGE, 1), "shrink keeps the prefix");
+    CHECK(q && malloc_usable_size(q) == PAGE, "shrink retags the run to 4KB");
+    if (!q) {
+        return;
+    }
+
+    // Nothing has been allocated since the shrink, so the tail pages are free.
+    unsigned char* r = realloc(q, 4 * PAGE);
+    CHECK(r == q, "grow 4KB -> 16KB into free tail pages stays in place");
+    CHECK(r && intact(r, PAGE, 1), "grow to 16KB keeps the prefix");
+    CHECK(r && malloc_usable_size(r) == 4 * PAGE, "grow retags the run to 16KB");
+    if (!r) {
+        return;
+    }
+    fill(r, 4 * PAGE, 2);
+
+    unsigned char* s = realloc(r, MEDIUM_MAX);
+    CHECK(s == r, "grow 16KB -> 64KB into free tail pages stays in place");
+    CHECK(s && intact(s, 4 * PAGE, 2), "grow to 64KB keeps the prefix");
+    CHECK(s && malloc_usable_size(s) == MEDIUM_MAX, "grow retags the run to 64KB");
+    if (s) {
+        memset(s, 0x33, MEDIUM_MAX);  // whole regrown run is writable
+    }
+    free(s);
+}
+
+// The runs of one refill batch are carved back to back: find a live 4KB run
+// whose next page is another live run, so growing it cannot stay in place.
+static void test_blocked_grow(void) {
+    unsigned char* objs[NEIGHBOURS];
+    for (int i = 0; i < NEIGHBOURS; i++) {
+        objs[i] = malloc(PAGE);
+        CHECK(objs[i] != NULL, "4KB alloc");
+        if (!objs[i]) {
+            return;
+        }
+        fill(objs[i], PAGE, 10u + (unsigned)i);
+    }
+    int a = -1, b = -1;
+    for (int i = 0; i < NEIGHBOURS && a < 0; i++) {
+        for (int j = 0; j < NEIGHBOURS; j++) {
+            if (objs[j] == objs[i] + PAGE) {
+                a = i;
+                b = j;
+                break;
+            }
+        }
+    }
+    CHECK(a >= 0, "two adjacent 4KB runs");
+    if (a >= 0) {
+        unsigned char* old = objs[a];
+        unsigned char* moved = realloc(old, 2 * PAGE);
+        CHECK(moved != NULL, "blocked grow returns memory");
+        CHECK(moved != old, "blocked grow falls back to copy");
+        CHECK(moved && intact(moved, PAGE, 10u + (unsigned)a), "blocked grow copies the prefix");
+        CHECK(intact(objs[b], PAGE, 10u + (unsigned)b), "neighbour run untouched");
+        if (moved) {
+            memset(moved, 0x44, 2 * PAGE);
+        }
+        objs[a] = moved;
+    }
+    for (int i = 0; i < NEIGHBOURS; i++) {
+        free(objs[i]);
+    }
+}
+
+static void* remote_grow(void* arg) {
+    unsigned char* p = (unsigned char*)arg;
+    unsigned char* q = realloc(p, 8 * PAGE);
+    CHECK(q != NULL, "remote grow returns memory");
+    CHECK(q != p, "remote grow is copied");
+    CHECK(q && intact(q, PAGE, 99), "remote grow keeps the prefix");
+    return q;
+}
+
+static void test_remote(void) {
+    unsigned char* p = malloc(PAGE);
+    CHECK(p != NULL, "4KB alloc for remote");
+    if (!p) {
+        return;
+    }
+    fill(p, PAGE, 99);
+    pthread_t th;
+    void* q = NULL;
+    CHECK(pthread_create(&th, NULL, remote_grow, p) == 0, "pthread_create");
+    pthread_join(th, &q);
+    free(q);
+}
+
+int main(void) {
+    test_shrink_then_grow();
+    test_blocked_grow();
+    test_remote();
+    if (failures) {
+        fprintf(stderr, "hz3_s305_realloc_inplace_test: %d FAILURES\n", failures);
+        return 1;
+    }
+    printf("hz3_s305_realloc_inplace_test ok\n");
+    return 0;
+}
@@ -0,0 +1,122 @@
+// hz3_s306_minirefill_epoch_test.c - S306 sees sc 5..7 refills served by S236
+// Run under LD_PRELOAD of a scale lib built with HZ3_S306_KNOB_CTL=1,
+// HZ3_S306_STATS=1 and HZ3_S306_TRACE=1 (make -C hakozuna test_s306_minirefill).
+//
+// A producer thread allocates batches at 24K..32K (sc 5..7) and a consumer
+// frees each batch cross-thread, so the producer's bins run dry every round and
+// are refilled from its inbox / central by the S236 minirefill, not
+// hz3_alloc_slow(). Those refills must tick the epoch and feed the controller:
+// the workload runs in a child and the parent checks the child's atexit dumps
+// for S306 ticks and a knob change on sc 5..7.
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define BATCH 64
+#define ROUNDS 20000
+#define MIN_TICKS 8  // >= 1 minirefill per round and class; without them ~1 tick
+
+static int failures = 0;
+
+#define CHECK(cond, msg)                       \
+    do {                                       \
+        if (!(cond)) {                         \
+            fprintf(stderr, "FAIL: %s\n", msg); \
+            failures++;                        \
+        }                                      \
+    } while (0)
+
+static void* g_objs[BATCH];
+static pthread_barrier_t g_bar;
+
+static void* consumer(void* arg) {
+    (void)arg;
+    for (int r = 0; r < ROUNDS; r++) {
+        pthread_barrier_wait(&g_bar);  // batch ready
+        for (int i = 0; i < BATCH; i++) {
+            free(g_objs[i]);
+        }
+        pthread_barrier_wait(&g_bar);  // batch freed
+    }
+    return NULL;
+}
+
+static void workload(void) {
+    pthread_t th;
+    pthread_barrier_init(&g_bar, NULL, 2);
+    if (pthread_create(&th, NULL, consumer, NULL) != 0) {
+        _exit(2);
+    }
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < BATCH; i++) {
+            size_t size = (size_t)(24 + (i % 3) * 4) << 10;  // 24K / 28K / 32K
+            g_objs[i] = malloc(size);
+            if (!g_objs[i]) {
+                _exit(2);
+            }
+            *(volatile char*)g_objs[i] = (char)r;
+        }
+        pthread_barrier_wait(&g_bar);
+        pthread_barrier_wait(&g_bar);
+    }
+    pthread_join(th, NULL);
+}
+
+int main(void) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        fprintf(stderr, "FAIL: pipe\n");
+        return 1;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "FAIL: fork\n");
+        return 1;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        dup2(fds[1], 2);
+        close(fds[1]);
+        workload();
+        exit(0);  // atexit dumps go to the pipe
+    }
+    close(fds[1]);
+
+    FILE* in = fdopen(fds[0], "r");
+    char line[512];
+    unsigned ticks = 0;
+    int saw_stats = 0;
+    int sc_changes = 0;
+    while (in && fgets(line, sizeof(line), in)) {
+        const char* p;
+        unsigned sc;
+        if ((p = strstr(line, "[HZ3_S306] ticks=")) != NULL) {
+            saw_stats = (sscanf(p, "[HZ3_S306] ticks=%u", &ticks) == 1);
+        } else if ((p = strstr(line, " sc=")) != NULL && strstr(line, "[HZ3_S306_TRACE] tick=") &&
+                   sscanf(p, " sc=%u", &sc) == 1 && sc >= 5 && sc <= 7) {
+            sc_changes++;
+        }
+    }
+    if (in) {
+        fclose(in);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0, "workload child exited cleanly");
+    CHECK(saw_stats, "S306 stats dump present (lib built with HZ3_S306_STATS=1)");
+    CHECK(ticks >= MIN_TICKS, "minirefill refills tick the epoch");
+    CHECK(sc_changes > 0, "controller moved an sc 5..7 knob");
+
+    if (failures) {
+        fprintf(stderr, "hz3_s306_minirefill_epoch_test: %d FAILURES (ticks=%u sc5_7_changes=%d)\n",
+                failures, ticks, sc_changes);
+        return 1;
+    }
+    printf("hz3_s306_minirefill_epoch_test ok (ticks=%u sc5_7_changes=%d)\n", ticks, sc_changes);
+    return 0;
+}
@@ -7,6 +7,7 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #else
+#include <pthread.h>
 #include <sched.h>
 #include <sys/mman.h>
 #include <unistd.h>
@@ -21,4 +22,7 @@
 
 #include "hz7_state.inc"
 
-#include "../common/hz7_common.inc"
+#include "hz7_route.inc"
+#include "hz7_span.inc"
+#include "hz7_big.inc"
+#include "hz7_tail.inc"
@@ -13,6 +13,7 @@ out="${out_dir}/hz7_smoke"
 remote_out="${out_dir}/hz7_remote_smoke"
 remote_natural_out="${out_dir}/hz7_remote_natural_smoke"
 mt_out="${out_dir}/hz7_mt_smoke"
+owner_out="${out_dir}/hz7_owner_smoke"
 stats_out="${out_dir}/hz7_stats_smoke"
 cpp_obj="${out_dir}/hz7_cpp_hz7.o"
 cpp_out="${out_dir}/hz7_cpp_smoke"
@@ -44,22 +45,24 @@ build_cpp_smoke() {
     -c "${hz7_root}/hz7.c" \
     -o "${cpp_obj}"
 
-  "${cxx}" -std=c++11 -O2 -Wall -Wextra -Werror \
+  "${cxx}" -std=c++11 -O2 -Wall -Wextra -Werror -pthread \
     "${cpp_obj}" \
     "${hz7_root}/tests/hz7_cpp_smoke.cpp" \
     -o "${cpp_out}"
 }
 
-build_c_smoke "hz7_smoke" "${hz7_root}/tests/hz7_smoke.c" "${out}"
+build_c_smoke "hz7_smoke" "${hz7_root}/tests/hz7_smoke.c" "${out}" -pthread
 build_c_smoke "hz7_remote_smoke" "${hz7_root}/tests/hz7_remote_smoke.c" "${remote_out}" -pthread
 build_c_smoke "hz7_remote_natural_smoke" "${hz7_root}/tests/hz7_remote_natural_smoke.c" "${remote_natural_out}" -pthread -DH7_REMOTE_NATURAL_PRESET=1
 build_c_smoke "hz7_mt_smoke" "${hz7_root}/tests/hz7_mt_smoke.c" "${mt_out}" -pthread
-build_c_smoke "hz7_stats_smoke" "${hz7_root}/tests/hz7_stats_smoke.c" "${stats_out}"
+build_c_smoke "hz7_owner_smoke" "${hz7_root}/tests/hz7_owner_smoke.c" "${owner_out}" -pthread
+build_c_smoke "hz7_stats_smoke" "${hz7_root}/tests/hz7_stats_smoke.c" "${stats_out}" -pthread
 build_cpp_smoke
 
 run_smoke "hz7_smoke" "${out}"
 run_smoke "hz7_remote_smoke" "${remote_out}"
 run_smoke "hz7_remote_natural_smoke" "${remote_natural_out}"
 run_smoke "hz7_mt_smoke" "${mt_out}"
+run_smoke "hz7_owner_smoke" "${owner_out}"
 run_smoke "hz7_stats_smoke" "${stats_out}"
 run_smoke "hz7_cpp_smoke" "${cpp_out}"
@@ -0,0 +1,171 @@
+#include "../hz7.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+typedef DWORD H7ThreadReturn;
+#define H7_THREAD_CALL WINAPI
+#else
+#include <pthread.h>
+typedef void* H7ThreadReturn;
+#define H7_THREAD_CALL
+#endif
+
+enum {
+  H7_OWNER_SMOKE_COUNT = 256,
+  H7_OWNER_SMOKE_KEEP = 16,
+  H7_OWNER_SMOKE_CHURN = 8
+};
+
+typedef struct H7OwnerSmoke {
+  void* owned[H7_OWNER_SMOKE_COUNT];
+  void* kept[H7_OWNER_SMOKE_KEEP];
+  int failed;
+} H7OwnerSmoke;
+
+static int h7_expect(int cond, const char* label) {
+  if (!cond) {
+    fprintf(stderr, "hz7 owner smoke failed: %s\n", label);
+    return 0;
+  }
+  return 1;
+}
+
+/* Frees the main thread's objects into its current span, then exits while
+   still holding objects of its own. */
+static H7ThreadReturn H7_THREAD_CALL h7_owner_remote_worker(void* user) {
+  H7OwnerSmoke* smoke = (H7OwnerSmoke*)user;
+  void* local[H7_OWNER_SMOKE_KEEP * 2];
+  size_t i;
+  for (i = 0; i < H7_OWNER_SMOKE_COUNT; ++i) {
+    h7_free(smoke->owned[i]);
+  }
+  h7_free(smoke->owned[0]);
+  if (!h7_expect(h7_route(smoke->owned[0]) == H7_ROUTE_INVALID,
+                 "remote double free stays invalid")) {
+    smoke->failed = 1;
+  }
+  for (i = 0; i < H7_OWNER_SMOKE_KEEP * 2; ++i) {
+    local[i] = h7_malloc(128);
+    if (!h7_expect(local[i] != 0, "worker alloc")) {
+      smoke->failed = 1;
+      return 0;
+    }
+  }
+  for (i = 0; i < H7_OWNER_SMOKE_KEEP; ++i) {
+    h7_free(local[i]);
+    smoke->kept[i] = local[H7_OWNER_SMOKE_KEEP + i];
+  }
+  return 0;
+}
+
+static H7ThreadReturn H7_THREAD_CALL h7_owner_churn_worker(void* user) {
+  void* ptrs[64];
+  size_t i;
+  (void)user;
+  for (i = 0; i < 64u; ++i) {
+    ptrs[i] = h7_malloc(128);
+  }
+  for (i = 0; i < 64u; ++i) {
+    h7_free(ptrs[i]);
+  }
+  return 0;
+}
+
+static int h7_run_thread(H7ThreadReturn(H7_THREAD_CALL* fn)(void*),
+                         void* user) {
+#ifdef _WIN32
+  HANDLE thread = CreateThread(0, 0, fn, user, 0, 0);
+  DWORD wait_rc;
+  if (!thread) {
+    return 0;
+  }
+  wait_rc = WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+  return wait_rc == WAIT_OBJECT_0;
+#else
+  pthread_t thread;
+  if (pthread_create(&thread, 0, fn, user) != 0) {
+    return 0;
+  }
+  return pthread_join(thread, 0) == 0;
+#endif
+}
+
+int main(void) {
+  H7OwnerSmoke smoke;
+  H7Stats stats;
+  size_t spans_before;
+  size_t i;
+
+  memset(&smoke, 0, sizeof(smoke));
+  for (i = 0; i < H7_OWNER_SMOKE_COUNT; ++i) {
+    smoke.owned[i] = h7_malloc(64);
+    if (!h7_expect(smoke.owned[i] != 0, "owner alloc")) {
+      return 1;
+    }
+  }
+
+  if (!h7_expect(h7_run_thread(h7_owner_remote_worker, &smoke),
+                 "remote worker thread") ||
+      !h7_expect(!smoke.failed, "remote worker")) {
+    return 1;
+  }
+
+  /* The remote frees sit on the owner's span until the owner drains them. */
+  spans_before = h7_stats().span_count;
+  for (i = 0; i < H7_OWNER_SMOKE_COUNT; ++i) {
+    smoke.owned[i] = h7_malloc(64);
+    if (!h7_expect(smoke.owned[i] != 0, "owner realloc") ||
+        !h7_expect(h7_route(smoke.owned[i]) == H7_ROUTE_VALID,
+                   "owner realloc route valid")) {
+      return 1;
+    }
+  }
+  if (!h7_expect(h7_stats().span_count == spans_before,
+                 "owner reuses remote-freed slots")) {
+    return 1;
+  }
+
+  /* Objects kept by an exited thread stay valid and freeable. */
+  for (i = 0; i < H7_OWNER_SMOKE_KEEP; ++i) {
+    if (!h7_expect(h7_route(smoke.kept[i]) == H7_ROUTE_VALID,
+                   "orphaned object route valid")) {
+      return 1;
+    }
+    h7_free(smoke.kept[i]);
+  }
+
+  /* Spans handed back at thread exit are adopted by the next thread. */
+  if (!h7_expect(h7_run_thread(h7_owner_churn_worker, 0), "churn thread")) {
+    return 1;
+  }
+  spans_before = h7_stats().span_count;
+  for (i = 1; i < H7_OWNER_SMOKE_CHURN; ++i) {
+    if (!h7_expect(h7_run_thread(h7_owner_churn_worker, 0), "churn thread")) {
+      return 1;
+    }
+  }
+  if (!h7_expect(h7_stats().span_count == spans_before,
+                 "thread churn does not grow spans")) {
+    return 1;
+  }
+
+  for (i = 0; i < H7_OWNER_SMOKE_COUNT; ++i) {
+    h7_free(smoke.owned[i]);
+  }
+  stats = h7_stats();
+  if (!h7_expect(stats.active_bytes == 0, "active bytes after owner smoke") ||
+      !h7_expect(stats.route_register_fail == 0,
+                 "route_register_fail after owner smoke")) {
+    return 1;
+  }
+
+  printf("hz7-owner-smoke ok\n");
+  return 0;
+}
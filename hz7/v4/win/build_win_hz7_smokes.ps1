@@ -18,6 +18,7 @@ $SmokeSource = Join-Path $Hz7Root "tests\hz7_smoke.c"
 $RemoteSmokeSource = Join-Path $Hz7Root "tests\hz7_remote_smoke.c"
 $RemoteNaturalSmokeSource = Join-Path $Hz7Root "tests\hz7_remote_natural_smoke.c"
 $MtSmokeSource = Join-Path $Hz7Root "tests\hz7_mt_smoke.c"
+$OwnerSmokeSource = Join-Path $Hz7Root "tests\hz7_owner_smoke.c"
 $StatsSmokeSource = Join-Path $Hz7Root "tests\hz7_stats_smoke.c"
 $CppSmokeSource = Join-Path $Hz7Root "tests\hz7_cpp_smoke.cpp"
 $Hz7Source = Join-Path $Hz7Root "hz7.c"
@@ -25,6 +26,7 @@ $OutputPath = Join-Path $OutDir "hz7_smoke.exe"
 $RemoteOutputPath = Join-Path $OutDir "hz7_remote_smoke.exe"
 $RemoteNaturalOutputPath = Join-Path $OutDir "hz7_remote_natural_smoke.exe"
 $MtOutputPath = Join-Path $OutDir "hz7_mt_smoke.exe"
+$OwnerOutputPath = Join-Path $OutDir "hz7_owner_smoke.exe"
 $StatsOutputPath = Join-Path $OutDir "hz7_stats_smoke.exe"
 $CppOutputPath = Join-Path $OutDir "hz7_cpp_smoke.exe"
 
@@ -34,6 +36,9 @@ if (-not (Test-Path $SmokeSource)) {
 if (-not (Test-Path $MtSmokeSource)) {
     throw "MT smoke source not found: $MtSmokeSource"
 }
+if (-not (Test-Path $OwnerSmokeSource)) {
+    throw "Owner smoke source not found: $OwnerSmokeSource"
+}
 if (-not (Test-Path $RemoteSmokeSource)) {
     throw "Remote smoke source not found: $RemoteSmokeSource"
 }
@@ -95,6 +100,7 @@ $SmokeTargets = @(
     @{ Name = "hz7_remote_smoke.exe"; Source = $RemoteSmokeSource; Output = $RemoteOutputPath },
     @{ Name = "hz7_remote_natural_smoke.exe"; Source = $RemoteNaturalSmokeSource; Output = $RemoteNaturalOutputPath; ExtraFlags = @("/DH7_REMOTE_NATURAL_PRESET=1") },
     @{ Name = "hz7_mt_smoke.exe"; Source = $MtSmokeSource; Output = $MtOutputPath },
+    @{ Name = "hz7_owner_smoke.exe"; Source = $OwnerSmokeSource; Output = $OwnerOutputPath },
     @{ Name = "hz7_stats_smoke.exe"; Source = $StatsSmokeSource; Output = $StatsOutputPath },
     @{ Name = "hz7_cpp_smoke.exe"; Source = $CppSmokeSource; Output = $CppOutputPath }
 )
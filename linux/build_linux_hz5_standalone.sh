@@ -56,6 +56,8 @@ PRELOAD_MIDPAGE_SUPERFAST=0
 PRELOAD_MIDPAGE_TAGGED_FREE=0
 PRELOAD_TLS_INITIAL_EXEC=0
 PRELOAD_SPEED_LINKFLAGS=0
+LINUX_RUNTIME_PROFILE=0
+LINUX_PROFILE_ADAPTIVE=0
 LINUX_OWNERHUB_R1=0
 LINUX_OWNERHUB_R2=0
 LINUX_OWNERHUB_R3=0
@@ -646,6 +648,12 @@ fi
 if [[ "$PRELOAD_MIDPAGE_TAGGED_FREE" -eq 1 ]]; then
   COMMON_FLAGS+=(-DBENCHLAB_HZ5_PRELOAD_MIDPAGE_TAGGED_FREE=1)
 fi
+if [[ "$LINUX_RUNTIME_PROFILE" -eq 1 ]]; then
+  COMMON_FLAGS+=(-DBENCHLAB_HZ5_RUNTIME_PROFILE=1)
+fi
+if [[ "$LINUX_PROFILE_ADAPTIVE" -eq 1 ]]; then
+  COMMON_FLAGS+=(-DBENCHLAB_HZ5_PROFILE_ADAPTIVE=1)
+fi
 if [[ "$PRELOAD_TLS_INITIAL_EXEC" -eq 1 ]]; then
   COMMON_FLAGS+=(-DBENCHLAB_HZ5_PRELOAD_TLS_INITIAL_EXEC=1)
   COMMON_FLAGS+=(-ftls-model=initial-exec)
@@ -661,6 +669,8 @@ HZ5_SRCS=(
   "${HZ5_DIR}/core/hz5_tcache.c"
   "${HZ5_DIR}/core/hz5_stats.c"
   "${HZ5_DIR}/policy/hz5_policy.c"
+  "${HZ5_DIR}/policy/hz5_profile.c"
+  "${HZ5_DIR}/policy/hz5_profile_adapt.c"
   "${HZ5_DIR}/policy/hz5_trace.c"
   "${HZ5_DIR}/route/hz5_route.c"
   "${HZ5_DIR}/ownerhub/hz5_ownerhub.c"
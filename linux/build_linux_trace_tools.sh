@@ -0,0 +1,157 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+ARCH="auto"
+OUT_DIR=""
+APIS="crt"
+HZ3_LIB="${HZ3_SO:-${ROOT_DIR}/libhakozuna_hz3_scale.so}"
+H8_LIB="${HZ8_SO:-${ROOT_DIR}/hakozuna-hz8/libhakozuna_hz8_preload.so}"
+
+usage() {
+  cat <<'EOF'
+Usage:
+  ./linux/build_linux_trace_tools.sh [options]
+
+Builds the allocation trace recorder (LD_PRELOAD) and the trace replayer.
+
+Options:
+  --arch <arch>      override detected arch (default: auto)
+  --out-dir DIR      output directory for the trace tools
+  --api LIST         comma-separated replay backends (default: crt)
+                       crt   malloc/free; pair with LD_PRELOAD or run_compare.sh
+                       hz3   hz3_* direct API, linked against --hz3-lib
+                       h8    h8_* direct API, linked against --h8-lib
+                       hz12  hz12_* direct API, built from hakozuna-hz12/src
+  --hz3-lib PATH     hz3 shared library (default: ./libhakozuna_hz3_scale.so)
+  --h8-lib PATH      hz8 shared library (default: hakozuna-hz8/libhakozuna_hz8_preload.so)
+  --help             show this message
+
+Outputs:
+  libbench_trace_record.so
+  bench_trace_replay_<api>
+EOF
+}
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --arch)
+      [[ $# -ge 2 ]] || { echo "missing value for --arch" >&2; exit 1; }
+      ARCH="$2"
+      shift 2
+      ;;
+    --out-dir)
+      [[ $# -ge 2 ]] || { echo "missing value for --out-dir" >&2; exit 1; }
+      OUT_DIR="$2"
+      shift 2
+      ;;
+    --api)
+      [[ $# -ge 2 ]] || { echo "missing value for --api" >&2; exit 1; }
+      APIS="$2"
+      shift 2
+      ;;
+    --hz3-lib)
+      [[ $# -ge 2 ]] || { echo "missing value for --hz3-lib" >&2; exit 1; }
+      HZ3_LIB="$2"
+      shift 2
+      ;;
+    --h8-lib)
+      [[ $# -ge 2 ]] || { echo "missing value for --h8-lib" >&2; exit 1; }
+      H8_LIB="$2"
+      shift 2
+      ;;
+    --help|-h)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+if [[ "$ARCH" == "auto" ]]; then
+  case "$(uname -m)" in
+    aarch64|arm64) ARCH="arm64" ;;
+    x86_64|amd64) ARCH="x86_64" ;;
+    *) ARCH="$(uname -m)" ;;
+  esac
+fi
+
+OUT_DIR="${OUT_DIR:-${ROOT_DIR}/bench/out/linux/${ARCH}}"
+RECORD_SRC="${ROOT_DIR}/bench/bench_trace_record.c"
+REPLAY_SRC="${ROOT_DIR}/bench/bench_trace_replay.c"
+CFLAGS=(-O3 -Wall -Wextra -Werror -std=c11 -D_GNU_SOURCE -I"$ROOT_DIR/bench")
+
+command -v gcc >/dev/null 2>&1 || {
+  echo "gcc not found in PATH" >&2
+  exit 1
+}
+
+require_lib() {
+  local name="$1"
+  local path="$2"
+  [[ -f "$path" ]] || {
+    echo "$name library not found: $path" >&2
+    exit 1
+  }
+}
+
+build_replay() {
+  local api="$1"
+  local bin="${OUT_DIR}/bench_trace_replay_${api}"
+  local lib_dir
+  echo "[linux] building trace replayer ($api): $bin"
+  case "$api" in
+    crt)
+      gcc "${CFLAGS[@]}" -pthread "$REPLAY_SRC" -o "$bin"
+      ;;
+    hz3)
+      require_lib hz3 "$HZ3_LIB"
+      lib_dir="$(cd "$(dirname "$HZ3_LIB")" && pwd)"
+      gcc "${CFLAGS[@]}" -DBENCH_TRACE_USE_HZ3=1 \
+        -I"$ROOT_DIR/hakozuna/include" -pthread \
+        "$REPLAY_SRC" "$HZ3_LIB" -Wl,-rpath,"$lib_dir" -ldl -o "$bin"
+      ;;
+    h8)
+      require_lib h8 "$H8_LIB"
+      lib_dir="$(cd "$(dirname "$H8_LIB")" && pwd)"
+      gcc "${CFLAGS[@]}" -DBENCH_TRACE_USE_H8=1 \
+        -I"$ROOT_DIR/hakozuna-hz8/include" -pthread \
+        "$REPLAY_SRC" "$H8_LIB" -Wl,-rpath,"$lib_dir" -ldl -o "$bin"
+      ;;
+    hz12)
+      # Same source list and flags as the hz12 retirement-turnover lane.
+      local HZ12_DIR="${ROOT_DIR}/hakozuna-hz12"
+      local HZ12_INCLUDES HZ12_LIB_SOURCES HZ12_LANE_CFLAGS
+      source "${HZ12_DIR}/linux/hz12_sources.sh"
+      local hz12_include_flags=()
+      local include_dir
+      for include_dir in "${HZ12_INCLUDES[@]}"; do
+        hz12_include_flags+=("-I${include_dir}")
+      done
+      gcc "${CFLAGS[@]}" -DBENCH_TRACE_USE_HZ12=1 "${HZ12_LANE_CFLAGS[@]}" \
+        "${hz12_include_flags[@]}" -pthread \
+        "$REPLAY_SRC" "${HZ12_LIB_SOURCES[@]}" -ldl -o "$bin"
+      ;;
+    *)
+      echo "unknown replay api: $api" >&2
+      exit 1
+      ;;
+  esac
+}
+
+mkdir -p "$OUT_DIR"
+
+echo "[linux] arch: $ARCH"
+echo "[linux] building trace recorder: ${OUT_DIR}/libbench_trace_record.so"
+gcc "${CFLAGS[@]}" -fPIC -shared -pthread \
+  "$RECORD_SRC" -ldl -o "${OUT_DIR}/libbench_trace_record.so"
+
+IFS=',' read -r -a api_list <<< "$APIS"
+for api in "${api_list[@]}"; do
+  build_replay "$api"
+done
+echo "[linux] trace tools output: $OUT_DIR"
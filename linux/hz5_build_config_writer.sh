@@ -47,6 +47,8 @@ hz5_write_build_config() {
     echo "preload_midpage_tagged_free=${PRELOAD_MIDPAGE_TAGGED_FREE}"
     echo "preload_tls_initial_exec=${PRELOAD_TLS_INITIAL_EXEC}"
     echo "preload_speed_linkflags=${PRELOAD_SPEED_LINKFLAGS}"
+    echo "linux_runtime_profile=${LINUX_RUNTIME_PROFILE}"
+    echo "linux_profile_adaptive=${LINUX_PROFILE_ADAPTIVE}"
     echo "linux_ownerhub_r1=${LINUX_OWNERHUB_R1}"
     echo "linux_ownerhub_r2=${LINUX_OWNERHUB_R2}"
     echo "linux_ownerhub_r3=${LINUX_OWNERHUB_R3}"
@@ -10,6 +10,19 @@ hz5_try_parse_midpage_build_arg() {
         HZ5_STANDALONE_EXACT_ONLY=0
         HZ5_PARSE_SHIFT=1
         ;;
+      --linux-runtime-profile)
+        BUILD_PRELOAD_FULL=1
+        LINUX_RUNTIME_PROFILE=1
+        HZ5_STANDALONE_EXACT_ONLY=0
+        HZ5_PARSE_SHIFT=1
+        ;;
+      --linux-profile-adaptive)
+        BUILD_PRELOAD_FULL=1
+        LINUX_RUNTIME_PROFILE=1
+        LINUX_PROFILE_ADAPTIVE=1
+        HZ5_STANDALONE_EXACT_ONLY=0
+        HZ5_PARSE_SHIFT=1
+        ;;
       --linux-smallfront-s1)
         BUILD_PRELOAD_FULL=1
         LINUX_SMALLFRONT_S1=1
@@ -35,6 +35,13 @@ hz5_try_apply_profile_alias() {
       enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_takefirst_base 2
       LINUX_LARGEFRONT_SOURCE_BATCH_COUNT=16
       ;;
+    --linux-hz5-profile-runtime)
+      enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_runtime_base
+      ;;
+    --linux-hz5-profile-adaptive)
+      enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_runtime_base
+      LINUX_PROFILE_ADAPTIVE=1
+      ;;
     --linux-hz5-profile-pagerun64-large128|--linux-hz5-profile-large128-rss)
       enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_large128_batch_base 4
       ;;
@@ -235,6 +235,14 @@ enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pa
   LINUX_LARGEFRONT_SOURCE_BATCH_COUNT="$1"
 }
 
+# One build for the saved pagerun64/large128 family: free order, LargeFront
+# source batch / take-first, and MidPage retain cap come from HZ5_PROFILE.
+enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_runtime_base() {
+  enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_base 2
+  PRELOAD_FREE_MIDPAGE_FIRST=0
+  LINUX_RUNTIME_PROFILE=1
+}
+
 enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_large128_batch16_rbatch_base() {
   enable_midpage_m4packet_freefirst_tlslink_coarse_bands_rsscheckpoint_m6remote_pagerun64_large128_batch_base 16
   LINUX_LARGEFRONT_REMOTE_BATCH=1
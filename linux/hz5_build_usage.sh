@@ -14,6 +14,14 @@ Options:
   --linux-hz5-profile-pagerun64-cross128
                      saved profile alias: PageRun64 + LargeFront takefirst
                      + source batch16 for cross128-style rows
+  --linux-hz5-profile-runtime
+                     one preload library for pagerun64-main, pagerun64-cross128,
+                     large128-rss and large128-source16; pick at startup with
+                     HZ5_PROFILE=<name> or HZ5_PROFILE_FILE=<path>
+  --linux-hz5-profile-adaptive
+                     --linux-hz5-profile-runtime plus the adaptive controller:
+                     switches between those presets at run time from live
+                     LargeFront/MidPage/LowPage stats (HZ5_PROFILE_ADAPT=0 off)
   --linux-hz5-profile-pagerun64-large128
                      saved profile alias: PageRun64 + LargeFront takefirst
                      + source batch4 + Large-first free route for
@@ -598,6 +606,14 @@ Options:
   --linux-preload-full
                      build an experimental full LD_PRELOAD front-end; disables
                      standalone exact-only gating for this output directory
+  --linux-runtime-profile
+                     read free order, LargeFront source batch/take-first and
+                     MidPage retain cap from HZ5_PROFILE at init; implies
+                     --linux-preload-full
+  --linux-profile-adaptive
+                     re-select the runtime profile preset from slow-path
+                     route stats with hysteresis; implies
+                     --linux-runtime-profile
   --linux-smallfront-s1
                      build HZ5-SmallFront-S1 for ordinary malloc <= 2048;
                      implies --linux-preload-full and disables exact-only gate
@@ -52,6 +52,31 @@ hz5_validate_build_config() {
     exit 1
   fi
 
+  if [[ "$LINUX_RUNTIME_PROFILE" -eq 1 ]]; then
+    if [[ "$BUILD_PRELOAD_FULL" -eq 0 || "$LINUX_LARGEFRONT_L1" -eq 0 ]]; then
+      echo "--linux-runtime-profile requires preload-full with LargeFront" >&2
+      exit 1
+    fi
+    if [[ "$PRELOAD_FREE_MID_FIRST" -eq 1 || \
+          "$PRELOAD_FREE_MIDPAGE_FIRST" -eq 1 || \
+          "$PRELOAD_FREE_MIDPAGE_LARGE_FIRST" -eq 1 || \
+          "$PRELOAD_FREE_LARGE_FIRST" -eq 1 ]]; then
+      echo "runtime profile owns the preload free order" >&2
+      exit 1
+    fi
+    if [[ "$LINUX_LARGEFRONT_DRAIN_TAKE_FIRST" -eq 1 || \
+          "$LINUX_LARGEFRONT_ADAPTIVE128" -eq 1 || \
+          "$LINUX_LARGEFRONT_POLICY_L1A" -eq 1 ]]; then
+      echo "runtime profile owns LargeFront take-first and source batch" >&2
+      exit 1
+    fi
+  fi
+
+  if [[ "$LINUX_PROFILE_ADAPTIVE" -eq 1 && "$LINUX_RUNTIME_PROFILE" -eq 0 ]]; then
+    echo "--linux-profile-adaptive requires --linux-runtime-profile" >&2
+    exit 1
+  fi
+
   if [[ "$LINUX_MIDFRONT_MAX_BYTES" -lt 2049 || \
         "$LINUX_MIDFRONT_MAX_BYTES" -gt 65536 ]]; then
     echo "midfront max bytes must be in 2049..65536" >&2